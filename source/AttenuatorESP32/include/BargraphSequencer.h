@@ -0,0 +1,127 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/*
+ * Keyframe sequencer for bargraph animations, shared by the Neutrona Wand, Single-Shot Blaster and both Attenuator
+ * builds. This file must be kept identical in every one of those projects (the CI compile check compares the copies).
+ * An animation is a track of BargraphKeyframe entries stored in flash. Each frame holds a mask of the lit elements
+ * (bit 0 is the first element in display order, before any orientation mapping), a hold time added on top of the
+ * base delay, and a cue byte which the caller may use for anything that happens alongside the frame.
+ * Tracks loop until stopped and may be stepped in either direction. The sequencer only keeps the playback position;
+ * the caller owns the timer and draws the elements in changed(), so a track must begin on a clear display (or one
+ * matching its previous frame).
+ */
+struct BargraphKeyframe {
+  uint32_t i_mask;
+  uint8_t i_hold;
+  uint8_t i_cue;
+};
+
+class BargraphSequencer {
+  public:
+    // Starts a track from the given frame. Every element of that first frame will be reported as changed.
+    void play(const BargraphKeyframe *p_new_track, uint8_t i_frames, uint8_t i_start = 0) {
+      p_track = p_new_track;
+      i_track_frames = i_frames;
+      i_frame = i_start % i_frames;
+      i_mask_prev = 0;
+      loadFrame();
+    }
+
+    void stop() {
+      p_track = nullptr;
+      i_mask = 0;
+      i_mask_prev = 0;
+    }
+
+    bool isPlaying(const BargraphKeyframe *p_check_track) const {
+      return p_track != nullptr && p_track == p_check_track;
+    }
+
+    // Moves on to the next frame, wrapping to the start of the track.
+    void next() {
+      if(p_track != nullptr) {
+        i_mask_prev = i_mask;
+        i_frame = (i_frame + 1) % i_track_frames;
+        loadFrame();
+      }
+    }
+
+    // Moves back to the previous frame, wrapping to the end of the track. Used to play a ramp in reverse.
+    void prev() {
+      if(p_track != nullptr) {
+        i_mask_prev = i_mask;
+        i_frame = (i_frame + i_track_frames - 1) % i_track_frames;
+        loadFrame();
+      }
+    }
+
+    // Playback speed as a multiplier of the base delay passed to hold(); 1 is normal speed.
+    void setSpeed(uint8_t i_multiplier) {
+      i_speed = i_multiplier > 0 ? i_multiplier : 1;
+    }
+
+    // Time (ms) to hold the current frame: the base delay divided by the playback speed, plus the frame's own hold.
+    uint16_t hold(uint16_t i_base_delay) const {
+      uint16_t i_scaled = i_base_delay / i_speed;
+
+      if(i_scaled < BARGRAPH_SEQUENCER_MIN_DELAY) {
+        i_scaled = BARGRAPH_SEQUENCER_MIN_DELAY;
+      }
+
+      return i_scaled + i_hold;
+    }
+
+    uint8_t frame() const {
+      return i_frame;
+    }
+
+    uint32_t mask() const {
+      return i_mask;
+    }
+
+    // Elements which differ from the previous frame; each should be set or cleared to match mask().
+    uint32_t changed() const {
+      return i_mask ^ i_mask_prev;
+    }
+
+    uint8_t cue() const {
+      return i_cue;
+    }
+
+  private:
+    static const uint8_t BARGRAPH_SEQUENCER_MIN_DELAY = 2;
+
+    const BargraphKeyframe *p_track = nullptr;
+    uint8_t i_track_frames = 0;
+    uint8_t i_frame = 0;
+    uint8_t i_speed = 1;
+    uint32_t i_mask = 0;
+    uint32_t i_mask_prev = 0;
+    uint8_t i_hold = 0;
+    uint8_t i_cue = 0;
+
+    void loadFrame() {
+      i_mask = pgm_read_dword(&p_track[i_frame].i_mask);
+      i_hold = pgm_read_byte(&p_track[i_frame].i_hold);
+      i_cue = pgm_read_byte(&p_track[i_frame].i_cue);
+    }
+};
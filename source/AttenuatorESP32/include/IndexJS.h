@@ -633,4 +633,8 @@ function musicPrev() {
 function musicLoop() {
   sendCommand("/music/loop");
 }
+
+function musicShuffle() {
+  sendCommand("/music/shuffle");
+}
 )=====";
@@ -27,148 +27,69 @@
 #define TXD2 17
 SerialTransfer packComs;
 
-// Types of packets to be sent.
-enum PACKET_TYPE : uint8_t {
-  PACKET_UNKNOWN = 0,
-  PACKET_COMMAND = 1,
-  PACKET_DATA = 2,
-  PACKET_PACK = 3,
-  PACKET_WAND = 4,
-  PACKET_SMOKE = 5,
-  PACKET_SYNC = 6
-};
+struct CommandPacket sendCmd;
+struct CommandPacket recvCmd;
+
+struct MessagePacket sendData;
+struct MessagePacket recvData;
 
-// For command signals (1 byte ID, 2 byte optional data).
-struct __attribute__((packed)) CommandPacket {
-  uint8_t s;
-  uint8_t c;
-  uint16_t d1; // Reserved for values over 255 (eg. current music track)
-  uint8_t e;
+/*
+ * Serial link speed negotiation.
+ * The link always starts at 9600 baud. Every handshake reply advertises a bitmask of the faster rates this
+ * device supports, and the pack may answer with a handshake naming the single rate to be used. The link
+ * drops back to 9600 on repeated CRC/framing errors, or whenever the pack is considered missing.
+ */
+enum BAUD_RATE_OPTIONS : uint8_t {
+  BAUD_RATE_DEFAULT = 0, // 9600
+  BAUD_RATE_57600 = 1,
+  BAUD_RATE_115200 = 2
 };
 
-struct CommandPacket sendCmd;
-struct CommandPacket recvCmd;
+const uint8_t i_baud_rates_supported = BAUD_RATE_57600 | BAUD_RATE_115200;
+const uint8_t i_baud_error_limit = 3; // Consecutive receive errors allowed before the link falls back to 9600.
+uint8_t i_pack_baud_rate = BAUD_RATE_DEFAULT; // Currently active rate for the link to the pack.
+uint8_t i_pack_link_errors = 0; // Consecutive receive errors seen at the active rate.
+
+struct PackPrefs packConfig;
+
+struct WandPrefs wandConfig;
+
+struct SmokePrefs smokeConfig;
+
+// Music track order to be sent to the pack with A_MUSIC_PLAYLIST.
+uint16_t i_music_playlist[MUSIC_PLAYLIST_SIZE] = {};
+uint8_t i_music_playlist_length = 0;
+
+struct AttenuatorSyncData attenuatorSyncData;
 
-// For generic data communication (1 byte ID, 4 byte array).
-struct __attribute__((packed)) MessagePacket {
-  uint8_t s;
-  uint8_t m;
-  uint8_t d[3]; // Reserved for multiple, arbitrary byte values.
-  uint8_t e;
+// Size in bytes of each AttenuatorSyncData field, in the same order as above.
+const uint8_t i_sync_field_sizes[SYNC_FIELD_COUNT] = {
+  ATTENUATOR_SYNC_FIELDS(PROTOCOL_SYNC_SIZE)
 };
 
-struct MessagePacket sendData;
-struct MessagePacket recvData;
+struct SyncDeltaPacket syncDelta; // Field mask followed by only the changed AttenuatorSyncData fields.
+
+// Stages of the Proton Pack main loop, as timed by its optional profiler (order must match the pack).
+const uint8_t i_loop_profile_stages = 10;
+const char* const loop_profile_stage_names[i_loop_profile_stages] = {
+  "audio", "powerMeter", "wandSerial", "serial1", "inputs",
+  "packState", "cyclotron", "powercell", "ledShow", "loopTotal"
+};
 
-struct __attribute__((packed)) PackPrefs {
-  uint8_t defaultSystemModePack;
-  uint8_t defaultYearThemePack;
-  uint8_t currentYearThemePack;
-  uint8_t defaultSystemVolume;
-  uint8_t packVibration;
-  uint8_t ribbonCableAlarm;
-  uint8_t cyclotronDirection;
-  uint8_t demoLightMode;
-  uint8_t protonStreamEffects;
-  uint8_t overheatStrobeNF;
-  uint8_t overheatSyncToFan;
-  uint8_t overheatLightsOff;
-  uint8_t ledCycLidCount;
-  uint8_t ledCycLidHue;
-  uint8_t ledCycLidSat;
-  uint8_t ledCycLidCenter;
-  uint8_t ledCycLidFade;
-  uint8_t ledCycLidSimRing;
-  uint8_t ledCycInnerPanel;
-  uint8_t ledCycCakeCount;
-  uint8_t ledCycCakeHue;
-  uint8_t ledCycCakeSat;
-  uint8_t ledCycCakeGRB;
-  uint8_t ledCycCavCount;
-  uint8_t ledCycCavType;
-  uint8_t ledVGCyclotron;
-  uint8_t ledPowercellCount;
-  uint8_t ledInvertPowercell;
-  uint8_t ledPowercellHue;
-  uint8_t ledPowercellSat;
-  uint8_t ledVGPowercell;
-} packConfig;
-
-struct __attribute__((packed)) WandPrefs {
-  uint8_t ledWandCount;
-  uint8_t ledWandHue;
-  uint8_t ledWandSat;
-  uint8_t rgbVentEnabled;
-  uint8_t spectralModesEnabled;
-  uint8_t overheatEnabled;
-  uint8_t defaultFiringMode;
-  uint8_t wandVibration;
-  uint8_t wandSoundsToPack;
-  uint8_t quickVenting;
-  uint8_t autoVentLight;
-  uint8_t wandBeepLoop;
-  uint8_t wandBootError;
-  uint8_t defaultYearModeWand;
-  uint8_t defaultYearModeCTS;
-  uint8_t numBargraphSegments;
-  uint8_t invertWandBargraph;
-  uint8_t bargraphOverheatBlink;
-  uint8_t bargraphIdleAnimation;
-  uint8_t bargraphFireAnimation;
-} wandConfig;
-
-struct __attribute__((packed)) SmokePrefs {
-  // Pack
-  uint8_t smokeEnabled;
-  uint8_t overheatContinuous5;
-  uint8_t overheatContinuous4;
-  uint8_t overheatContinuous3;
-  uint8_t overheatContinuous2;
-  uint8_t overheatContinuous1;
-  uint8_t overheatDuration5;
-  uint8_t overheatDuration4;
-  uint8_t overheatDuration3;
-  uint8_t overheatDuration2;
-  uint8_t overheatDuration1;
-  // Wand
-  uint8_t overheatLevel5;
-  uint8_t overheatLevel4;
-  uint8_t overheatLevel3;
-  uint8_t overheatLevel2;
-  uint8_t overheatLevel1;
-  uint8_t overheatDelay5;
-  uint8_t overheatDelay4;
-  uint8_t overheatDelay3;
-  uint8_t overheatDelay2;
-  uint8_t overheatDelay1;
-} smokeConfig;
-
-struct __attribute__((packed)) AttenuatorSyncData {
-  uint8_t systemMode;
-  uint8_t ionArmSwitch;
-  uint8_t cyclotronLidState;
-  uint8_t systemYear;
-  uint8_t packOn;
-  uint8_t powerLevel;
-  uint8_t streamMode;
-  uint8_t wandPresent;
-  uint8_t barrelExtended;
-  uint8_t wandFiring;
-  uint8_t overheatingNow;
-  uint8_t speedMultiplier;
-  uint8_t spectralColour;
-  uint8_t spectralSaturation;
-  uint8_t masterMuted;
-  uint8_t masterVolume;
-  uint8_t effectsVolume;
-  uint8_t musicVolume;
-  uint8_t musicPlaying;
-  uint8_t musicPaused;
-  uint8_t trackLooped;
-  uint16_t currentTrack;
-  uint16_t musicCount;
-  uint16_t packVoltage;
-} attenuatorSyncData;
+// Summary of the pack main loop profiler, in microseconds per stage.
+struct __attribute__((packed)) LoopProfileData {
+  uint16_t stageAvg[i_loop_profile_stages];
+  uint16_t stageMax[i_loop_profile_stages];
+  uint16_t ledFramesDeferred;
+  uint16_t ledFramesForced;
+  uint32_t ledFramesSkipped;
+} loopProfileData;
+
+// Counters for the pack's links to the wand and to this device.
+struct __attribute__((packed)) LinkStatsData {
+  struct LinkStats wand;
+  struct LinkStats serial1;
+} linkStatsData;
 
 /*
  * Serial API Communication Handlers
@@ -203,7 +124,7 @@ void attenuatorSerialSendData(uint8_t i_message) {
 
   sendData.s = A_COM_START;
   sendData.m = i_message;
-  sendData.s = A_COM_END;
+  sendData.e = A_COM_END;
 
   // Set all elements of the data array to 0
   memset(sendData.d, 0, sizeof(sendData.d));
@@ -236,12 +157,191 @@ void attenuatorSerialSendData(uint8_t i_message) {
       packComs.sendData(i_send_size, (uint8_t) PACKET_SMOKE);
     break;
 
+    case A_MUSIC_PLAYLIST:
+      #if defined(DEBUG_SERIAL_COMMS)
+        debug("Sending Music Playlist");
+      #endif
+
+      // The whole order goes in one packet, with the track count the pack checks it against.
+      sendData.d[0] = i_music_playlist_length;
+
+      i_send_size = packComs.txObj(sendData);
+      i_send_size = packComs.txObj(i_music_playlist, i_send_size, i_music_playlist_length * sizeof(uint16_t));
+      packComs.sendData(i_send_size, (uint8_t) PACKET_DATA);
+    break;
+
     default:
       // No-op for all other communications.
     break;
   }
 }
 
+// Updates the local state from the latest AttenuatorSyncData values.
+void applySyncData() {
+  // Sync all required variables.
+  switch(attenuatorSyncData.systemYear) {
+    case 1:
+      SYSTEM_YEAR = SYSTEM_1984;
+    break;
+    case 2:
+      SYSTEM_YEAR = SYSTEM_1989;
+    break;
+    case 3:
+      SYSTEM_YEAR = SYSTEM_AFTERLIFE;
+    default:
+    break;
+    case 4:
+      SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
+    break;
+  }
+
+  switch(attenuatorSyncData.streamMode) {
+    case 1:
+    default:
+      STREAM_MODE = PROTON;
+    break;
+    case 2:
+      STREAM_MODE = STASIS;
+    break;
+    case 3:
+      STREAM_MODE = SLIME;
+    break;
+    case 4:
+      STREAM_MODE = MESON;
+    break;
+    case 5:
+      STREAM_MODE = SPECTRAL;
+    break;
+    case 6:
+      STREAM_MODE = HOLIDAY_HALLOWEEN;
+    break;
+    case 7:
+      STREAM_MODE = HOLIDAY_CHRISTMAS;
+    break;
+    case 8:
+      STREAM_MODE = SPECTRAL_CUSTOM;
+    break;
+  }
+
+  POWER_LEVEL_PREV = POWER_LEVEL;
+  switch(attenuatorSyncData.powerLevel) {
+    case 1:
+    default:
+      POWER_LEVEL = LEVEL_1;
+    break;
+    case 2:
+      POWER_LEVEL = LEVEL_2;
+    break;
+    case 3:
+      POWER_LEVEL = LEVEL_3;
+    break;
+    case 4:
+      POWER_LEVEL = LEVEL_4;
+    break;
+    case 5:
+      POWER_LEVEL = LEVEL_5;
+    break;
+  }
+
+  // Common actions to all hardware.
+  b_pack_on = attenuatorSyncData.packOn == 1;
+  b_firing = attenuatorSyncData.wandFiring == 1;
+  b_overheating = attenuatorSyncData.overheatingNow == 1;
+  i_speed_multiplier = attenuatorSyncData.speedMultiplier;
+  i_spectral_custom_colour = attenuatorSyncData.spectralColour;
+  i_spectral_custom_saturation = attenuatorSyncData.spectralSaturation;
+
+  // Specific to the ESP32 and Web UI
+  SYSTEM_MODE = attenuatorSyncData.systemMode == 1 ? MODE_SUPER_HERO : MODE_ORIGINAL;
+  RED_SWITCH_MODE = attenuatorSyncData.ionArmSwitch == 2 ? SWITCH_ON : SWITCH_OFF;
+  BARREL_STATE = attenuatorSyncData.barrelExtended == 1 ? BARREL_EXTENDED : BARREL_RETRACTED;
+  b_wand_present = attenuatorSyncData.wandPresent == 1;
+  b_cyclotron_lid_on = attenuatorSyncData.cyclotronLidState == 1;
+  f_batt_volts = (float) attenuatorSyncData.packVoltage / 100;
+  i_volume_master_percentage = attenuatorSyncData.masterVolume;
+  i_volume_effects_percentage = attenuatorSyncData.effectsVolume;
+  i_volume_music_percentage = attenuatorSyncData.musicVolume;
+  i_music_track_current = attenuatorSyncData.currentTrack;
+  i_music_track_count = attenuatorSyncData.musicCount;
+  b_repeat_track = attenuatorSyncData.trackLooped == 2;
+  b_music_shuffled = attenuatorSyncData.musicShuffled == 2;
+  b_playing_music = attenuatorSyncData.musicPlaying == 1;
+  b_music_paused = attenuatorSyncData.musicPaused == 1;
+  b_master_muted = attenuatorSyncData.masterMuted == 2;
+
+  if(i_music_track_count > 0) {
+    i_music_track_min = i_music_track_offset; // First music track possible (eg. 500)
+    i_music_track_max = i_music_track_offset + i_music_track_count - 1; // 500 + N - 1 to be inclusive of the offset value.
+  }
+}
+
+// Copies the fields carried by a PACKET_SYNC_DELTA into the AttenuatorSyncData struct.
+bool mergeSyncDelta(uint16_t i_bytes_read) {
+  uint8_t *p_sync = (uint8_t *) &attenuatorSyncData;
+  uint16_t i_length = 0;
+  uint8_t i_offset = 0;
+
+  // Make sure the payload holds exactly the fields named in the mask before changing anything.
+  for(uint8_t i = 0; i < SYNC_FIELD_COUNT; i++) {
+    if(syncDelta.fields & (1UL << i)) {
+      i_length += i_sync_field_sizes[i];
+    }
+  }
+
+  if(i_length + sizeof(syncDelta.fields) != i_bytes_read) {
+    return false;
+  }
+
+  i_length = 0;
+
+  for(uint8_t i = 0; i < SYNC_FIELD_COUNT; i++) {
+    uint8_t i_size = i_sync_field_sizes[i];
+
+    if(syncDelta.fields & (1UL << i)) {
+      memcpy(p_sync + i_offset, syncDelta.d + i_length, i_size);
+      i_length += i_size;
+    }
+
+    i_offset += i_size;
+  }
+
+  return true;
+}
+
+uint32_t baudRateValue(uint8_t i_rate) {
+  switch(i_rate) {
+    case BAUD_RATE_115200:
+      return 115200;
+    break;
+
+    case BAUD_RATE_57600:
+      return 57600;
+    break;
+
+    default:
+      return 9600;
+    break;
+  }
+}
+
+// Changes the rate of the UART to the pack once anything queued at the old rate has been fully sent.
+void setPackBaudRate(uint8_t i_rate) {
+  if(i_rate == i_pack_baud_rate) {
+    return;
+  }
+
+  #if defined(DEBUG_SERIAL_COMMS)
+    debug("Pack link switching to " + String(baudRateValue(i_rate)));
+  #endif
+
+  Serial2.flush();
+  Serial2.updateBaudRate(baudRateValue(i_rate));
+  packComs.reset(); // Discard any partial packet received at the old rate.
+
+  i_pack_baud_rate = i_rate;
+  i_pack_link_errors = 0;
+}
+
 // Forward function declaration.
 bool handleCommand(uint8_t i_command, uint16_t i_value);
 
@@ -256,6 +356,8 @@ bool checkPack() {
     #endif
 
     if(i_packet_id > 0) {
+      i_pack_link_errors = 0; // Any good packet proves the link is working at the active rate.
+
       if(ms_packsync.isRunning() && !b_wait_for_pack) {
         // If the timer is still running and Pack is connected, consider any request as proof of life.
         ms_packsync.restart();
@@ -372,107 +474,53 @@ bool checkPack() {
           debug("Pack Sync Packet Received");
 
           packComs.rxObj(attenuatorSyncData);
+          applySyncData();
 
-          // Sync all required variables.
-          switch(attenuatorSyncData.systemYear) {
-            case 1:
-              SYSTEM_YEAR = SYSTEM_1984;
-            break;
-            case 2:
-              SYSTEM_YEAR = SYSTEM_1989;
-            break;
-            case 3:
-              SYSTEM_YEAR = SYSTEM_AFTERLIFE;
-            default:
-            break;
-            case 4:
-              SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
-            break;
-          }
+          return true; // Indicates a status change.
+        break;
 
-          switch(attenuatorSyncData.streamMode) {
-            case 1:
-            default:
-              STREAM_MODE = PROTON;
-            break;
-            case 2:
-              STREAM_MODE = STASIS;
-            break;
-            case 3:
-              STREAM_MODE = SLIME;
-            break;
-            case 4:
-              STREAM_MODE = MESON;
-            break;
-            case 5:
-              STREAM_MODE = SPECTRAL;
-            break;
-            case 6:
-              STREAM_MODE = HOLIDAY_HALLOWEEN;
-            break;
-            case 7:
-              STREAM_MODE = HOLIDAY_CHRISTMAS;
-            break;
-            case 8:
-              STREAM_MODE = SPECTRAL_CUSTOM;
-            break;
+        case PACKET_SYNC_DELTA:
+          if(b_wait_for_pack) {
+            // Can't proceed if the Pack isn't connected; prevents phantom actions from occurring.
+            return false;
           }
 
-          POWER_LEVEL_PREV = POWER_LEVEL;
-          switch(attenuatorSyncData.powerLevel) {
-            case 1:
-            default:
-              POWER_LEVEL = LEVEL_1;
-            break;
-            case 2:
-              POWER_LEVEL = LEVEL_2;
-            break;
-            case 3:
-              POWER_LEVEL = LEVEL_3;
-            break;
-            case 4:
-              POWER_LEVEL = LEVEL_4;
-            break;
-            case 5:
-              POWER_LEVEL = LEVEL_5;
-            break;
-          }
+          // Only the fields which changed since the last sync are sent.
+          packComs.rxObj(syncDelta);
 
-          // Common actions to all hardware.
-          b_pack_on = attenuatorSyncData.packOn == 1;
-          b_firing = attenuatorSyncData.wandFiring == 1;
-          b_overheating = attenuatorSyncData.overheatingNow == 1;
-          i_speed_multiplier = attenuatorSyncData.speedMultiplier;
-          i_spectral_custom_colour = attenuatorSyncData.spectralColour;
-          i_spectral_custom_saturation = attenuatorSyncData.spectralSaturation;
-
-          // Specific to the ESP32 and Web UI
-          SYSTEM_MODE = attenuatorSyncData.systemMode == 1 ? MODE_SUPER_HERO : MODE_ORIGINAL;
-          RED_SWITCH_MODE = attenuatorSyncData.ionArmSwitch == 2 ? SWITCH_ON : SWITCH_OFF;
-          BARREL_STATE = attenuatorSyncData.barrelExtended == 1 ? BARREL_EXTENDED : BARREL_RETRACTED;
-          b_wand_present = attenuatorSyncData.wandPresent == 1;
-          b_cyclotron_lid_on = attenuatorSyncData.cyclotronLidState == 1;
-          f_batt_volts = (float) attenuatorSyncData.packVoltage / 100;
-          i_volume_master_percentage = attenuatorSyncData.masterVolume;
-          i_volume_effects_percentage = attenuatorSyncData.effectsVolume;
-          i_volume_music_percentage = attenuatorSyncData.musicVolume;
-          i_music_track_current = attenuatorSyncData.currentTrack;
-          i_music_track_count = attenuatorSyncData.musicCount;
-          b_repeat_track = attenuatorSyncData.trackLooped == 2;
-          b_playing_music = attenuatorSyncData.musicPlaying == 1;
-          b_music_paused = attenuatorSyncData.musicPaused == 1;
-          b_master_muted = attenuatorSyncData.masterMuted == 2;
-
-          if(i_music_track_count > 0) {
-            i_music_track_min = i_music_track_offset; // First music track possible (eg. 500)
-            i_music_track_max = i_music_track_offset + i_music_track_count - 1; // 500 + N - 1 to be inclusive of the offset value.
+          if(mergeSyncDelta(packComs.bytesRead)) {
+            applySyncData();
+            return true; // Indicates a status change.
           }
+        break;
 
-          return true; // Indicates a status change.
+        case PACKET_PROFILE:
+          // Only sent by a pack built with its loop profiler enabled.
+          #if defined(DEBUG_SERIAL_COMMS)
+            debug("Loop Profile Received");
+          #endif
+
+          b_received_loop_profile = true;
+          packComs.rxObj(loopProfileData);
+        break;
+
+        case PACKET_LINK_STATS:
+          #if defined(DEBUG_SERIAL_COMMS)
+            debug("Link Stats Received");
+          #endif
+
+          b_received_link_stats = true;
+          packComs.rxObj(linkStatsData);
         break;
       }
     }
   }
+  else if(i_pack_baud_rate != BAUD_RATE_DEFAULT && packComs.status <= CRC_ERROR) {
+    if(++i_pack_link_errors >= i_baud_error_limit) {
+      // The faster link is unreliable, so return to the default rate.
+      setPackBaudRate(BAUD_RATE_DEFAULT);
+    }
+  }
 
   return false; // Returns false if still here.
 }
@@ -483,8 +531,13 @@ bool handleCommand(uint8_t i_command, uint16_t i_value) {
   switch(i_command) {
     case A_HANDSHAKE:
       if(!b_wait_for_pack) {
-        // The pack is asking us if we are still here. Respond back.
-        attenuatorSerialSend(A_HANDSHAKE);
+        if(i_value == BAUD_RATE_57600 || i_value == BAUD_RATE_115200) {
+          // The pack has selected a faster rate, so switch now and respond at the new rate.
+          setPackBaudRate(i_value);
+        }
+
+        // The pack is asking us if we are still here. Respond back, listing the faster rates we support.
+        attenuatorSerialSend(A_HANDSHAKE, i_baud_rates_supported);
       }
       else {
         // Who the heck is this pack!? Demand a sync!
@@ -503,7 +556,14 @@ bool handleCommand(uint8_t i_command, uint16_t i_value) {
       b_state_changed = true;
       ms_packsync.start(i_sync_disconnect_delay);
 
-      attenuatorSerialSend(A_SYNC_END); // Signal end of sync.
+      // Older pack firmware sends no hash, so only a different non-zero value counts as a mismatch.
+      b_protocol_mismatch = (i_value != 0 && i_value != i_protocol_hash);
+
+      if(b_protocol_mismatch) {
+        debug("Protocol mismatch: pack firmware was built from a different Communication.h");
+      }
+
+      attenuatorSerialSend(A_SYNC_END, i_protocol_hash); // Signal end of sync, along with the protocol we were built for.
     break;
 
     case A_WAND_CONNECTED:
@@ -545,6 +545,23 @@ String getSmokeConfig() {
   return equipSettings;
 }
 
+// Adds the health counters for one of the pack's serial links to the JSON body.
+void addLinkStats(const char* name, struct LinkStats &stats) {
+  jsonBody["link"][name]["baudRate"] = baudRateValue(stats.baudRate);
+  jsonBody["link"][name]["rxPackets"] = stats.rxPackets;
+  jsonBody["link"][name]["rxCrcErrors"] = stats.rxCrcErrors;
+  jsonBody["link"][name]["rxPayloadErrors"] = stats.rxPayloadErrors;
+  jsonBody["link"][name]["rxStopByteErrors"] = stats.rxStopByteErrors;
+  jsonBody["link"][name]["rxStaleErrors"] = stats.rxStaleErrors;
+  jsonBody["link"][name]["rxBadMarkers"] = stats.rxBadMarkers;
+  jsonBody["link"][name]["txBytes"] = stats.txBytes;
+  jsonBody["link"][name]["retransmits"] = stats.retransmits;
+  jsonBody["link"][name]["failures"] = stats.failures;
+  jsonBody["link"][name]["rttLast"] = stats.rttLast; // us
+  jsonBody["link"][name]["rttMax"] = stats.rttMax; // us
+  jsonBody["link"][name]["protocolMatch"] = stats.protocolMatch; // 0 = Not reported, 1 = Same, 2 = Different
+}
+
 String getEquipmentStatus() {
   // Prepare a JSON object with information we have gleamed from the system.
   String equipStatus;
@@ -570,6 +587,7 @@ String getEquipmentStatus() {
     jsonBody["temperature"] = (b_overheating ? "Venting" : "Normal");
     jsonBody["musicPlaying"] = b_playing_music;
     jsonBody["musicPaused"] = b_music_paused;
+    jsonBody["musicShuffled"] = b_music_shuffled;
     jsonBody["musicCurrent"] = i_music_track_current;
     jsonBody["musicStart"] = i_music_track_min;
     jsonBody["musicEnd"] = i_music_track_max;
@@ -580,6 +598,25 @@ String getEquipmentStatus() {
     jsonBody["wandAmps"] = f_wand_amps;
     jsonBody["apClients"] = i_ap_client_count;
     jsonBody["wsClients"] = i_ws_client_count;
+    jsonBody["protocol"] = (b_protocol_mismatch ? "Mismatch" : "OK");
+
+    if(b_received_loop_profile) {
+      // Per-stage loop timing (us) from a pack built with the loop profiler enabled.
+      for(uint8_t i = 0; i < i_loop_profile_stages; i++) {
+        jsonBody["loopProfile"][loop_profile_stage_names[i]]["avg"] = loopProfileData.stageAvg[i];
+        jsonBody["loopProfile"][loop_profile_stage_names[i]]["max"] = loopProfileData.stageMax[i];
+      }
+
+      jsonBody["loopProfile"]["ledFramesDeferred"] = loopProfileData.ledFramesDeferred;
+      jsonBody["loopProfile"]["ledFramesForced"] = loopProfileData.ledFramesForced;
+      jsonBody["loopProfile"]["ledFramesSkipped"] = loopProfileData.ledFramesSkipped;
+    }
+
+    if(b_received_link_stats) {
+      // Serial link health as counted by the pack since power on.
+      addLinkStats("wand", linkStatsData.wand);
+      addLinkStats("serial1", linkStatsData.serial1);
+    }
   }
 
   // Serialize JSON object to string.
@@ -587,6 +624,21 @@ String getEquipmentStatus() {
   return equipStatus;
 }
 
+String getLinkStatus() {
+  // Prepare a JSON object with only the serial link health counters from the pack.
+  String linkStatus;
+  jsonBody.clear();
+
+  if(!b_wait_for_pack && b_received_link_stats) {
+    addLinkStats("wand", linkStatsData.wand);
+    addLinkStats("serial1", linkStatsData.serial1);
+  }
+
+  // Serialize JSON object to string.
+  serializeJson(jsonBody, linkStatus);
+  return linkStatus;
+}
+
 String getWifiSettings() {
   // Prepare a JSON object with information stored in preferences (or a blank default).
   String wifiNetwork;
@@ -657,6 +709,11 @@ void handleGetStatus(AsyncWebServerRequest *request) {
   request->send(200, "application/json", getEquipmentStatus());
 }
 
+void handleGetLinkStatus(AsyncWebServerRequest *request) {
+  // Return the pack's serial link counters as a stringified JSON object.
+  request->send(200, "application/json", getLinkStatus());
+}
+
 void handleGetWifi(AsyncWebServerRequest *request) {
   // Return current system status as a stringified JSON object.
   request->send(200, "application/json", getWifiSettings());
@@ -787,6 +844,40 @@ void handleLoopMusicTrack(AsyncWebServerRequest *request) {
   request->send(200, "application/json", status);
 }
 
+void handleShuffleMusic(AsyncWebServerRequest *request) {
+  debug("Web: Toggle Music Shuffle");
+  attenuatorSerialSend(A_MUSIC_SHUFFLE_TOGGLE);
+  request->send(200, "application/json", status);
+}
+
+void handleSetMusicPlaylist(AsyncWebServerRequest *request) {
+  String c_music_tracks = "";
+
+  if(request->hasParam("tracks")) {
+    // Get the parameter "tracks" if it exists, as a comma-separated list of track numbers (eg. "503,501,507").
+    c_music_tracks = request->getParam("tracks")->value();
+  }
+
+  // With no tracks given the pack goes back to playing every track.
+  i_music_playlist_length = 0;
+
+  while(c_music_tracks.length() > 0 && i_music_playlist_length < MUSIC_PLAYLIST_SIZE) {
+    int i_comma = c_music_tracks.indexOf(',');
+    uint16_t i_music_track = (i_comma < 0 ? c_music_tracks : c_music_tracks.substring(0, i_comma)).toInt();
+
+    c_music_tracks = i_comma < 0 ? "" : c_music_tracks.substring(i_comma + 1);
+
+    if(i_music_track >= i_music_track_min && i_music_track <= i_music_track_max) {
+      i_music_playlist[i_music_playlist_length++] = i_music_track;
+    }
+  }
+
+  attenuatorSerialSendData(A_MUSIC_PLAYLIST);
+
+  debug("Web: Music Playlist Tracks: " + String(i_music_playlist_length));
+  request->send(200, "application/json", status);
+}
+
 void handleSelectMusicTrack(AsyncWebServerRequest *request) {
   String c_music_track = "";
 
@@ -1375,6 +1466,7 @@ void setupRouting() {
   httpServer.on("/eeprom/pack", HTTP_PUT, handleSavePackEEPROM);
   httpServer.on("/eeprom/wand", HTTP_PUT, handleSaveWandEEPROM);
   httpServer.on("/status", HTTP_GET, handleGetStatus);
+  httpServer.on("/status/link", HTTP_GET, handleGetLinkStatus);
   httpServer.on("/restart", HTTP_DELETE, handleRestart);
   httpServer.on("/pack/on", HTTP_PUT, handlePackOn);
   httpServer.on("/pack/off", HTTP_PUT, handlePackOff);
@@ -1395,6 +1487,8 @@ void setupRouting() {
   httpServer.on("/music/select", HTTP_PUT, handleSelectMusicTrack);
   httpServer.on("/music/prev", HTTP_PUT, handlePrevMusicTrack);
   httpServer.on("/music/loop", HTTP_PUT, handleLoopMusicTrack);
+  httpServer.on("/music/shuffle", HTTP_PUT, handleShuffleMusic);
+  httpServer.on("/music/playlist", HTTP_PUT, handleSetMusicPlaylist);
   httpServer.on("/wifi/settings", HTTP_GET, handleGetWifi);
 
   // Body Handlers
@@ -43,6 +43,8 @@
 // Local Files
 #include "Configuration.h"
 #include "Communication.h"
+#include "BargraphDriver.h"
+#include "BargraphSequencer.h"
 #include "Header.h"
 #include "Bargraph.h"
 #include "Colours.h"
@@ -276,6 +278,9 @@ void SerialCommsTask(void *parameter) {
       if(ms_packsync.justFinished()) {
         // The pack just went missing, so treat as disconnected.
         b_wait_for_pack = true;
+
+        // Any new connection will start out at the default rate.
+        setPackBaudRate(BAUD_RATE_DEFAULT);
         ms_packsync.start(i_sync_initial_delay);
       }
 
@@ -55,6 +55,60 @@ enum BARGRAPH_PATTERNS BARGRAPH_PATTERN;
 enum BARGRAPH_STATES { BG_OFF, BG_ON, BG_EMPTY, BG_MID, BG_FULL };
 enum BARGRAPH_STATES BARGRAPH_STATE;
 
+/*
+ * Keyframe tracks for the bilateral/mirrored patterns, played by the bargraph sequencer (see BargraphSequencer.h).
+ * Both step between the ends and the middle of the display; each hold time is added to the base delay.
+ * - Outer-Inner: A pair of single elements.
+ * - Inner Pulse: Every element between the pair, beginning from the middle (BARGRAPH_TRACK_INNER_PULSE_START).
+ * The frames are built from the number of elements, so the tracks follow any change to i_bargraph_elements.
+ */
+static_assert(i_bargraph_elements % 2 == 0 && i_bargraph_elements >= 6 && i_bargraph_elements <= 32, "Bargraph tracks need an even number of elements, from 6 to 32.");
+
+const uint8_t BARGRAPH_TRACK_FRAMES = i_bargraph_elements - 2;
+const uint8_t BARGRAPH_TRACK_MIDDLE = i_bargraph_elements / 2 - 1; // Frame with the middle elements lit.
+const uint8_t BARGRAPH_TRACK_INNER_PULSE_START = BARGRAPH_TRACK_MIDDLE;
+const uint8_t BARGRAPH_TRACK_FRAMES_MAX = 30; // Frames for the longest bargraph (32 elements); later entries are not played.
+
+// Distance of the lit pair from the ends: inward up to the middle frame, then back out.
+constexpr uint8_t bargraphTrackStep(uint8_t i_frame) {
+  return i_frame >= BARGRAPH_TRACK_FRAMES ? 0 : (i_frame <= BARGRAPH_TRACK_MIDDLE ? i_frame : BARGRAPH_TRACK_FRAMES - i_frame);
+}
+
+// Holds grow towards the middle and shrink on the way back out.
+constexpr uint8_t bargraphTrackHold(uint8_t i_frame) {
+  return i_frame >= BARGRAPH_TRACK_FRAMES ? 0 : (i_frame < BARGRAPH_TRACK_MIDDLE ? i_frame + 1 : BARGRAPH_TRACK_FRAMES - 1 - i_frame);
+}
+
+constexpr uint32_t bargraphTrackPair(uint8_t i_step) {
+  return (1UL << i_step) | (1UL << (i_bargraph_elements - 1 - i_step));
+}
+
+constexpr uint32_t bargraphTrackSpan(uint8_t i_step) {
+  return (0xFFFFFFFFUL >> (32 - (i_bargraph_elements - i_step))) & (0xFFFFFFFFUL << i_step);
+}
+
+#define BARGRAPH_TRACK_PAIR(f) {bargraphTrackPair(bargraphTrackStep(f)), bargraphTrackHold(f), 0}
+#define BARGRAPH_TRACK_SPAN(f) {bargraphTrackSpan(bargraphTrackStep(f)), bargraphTrackHold(f), 0}
+
+const BargraphKeyframe bargraphTrackOuterInner[BARGRAPH_TRACK_FRAMES_MAX] PROGMEM = {
+  BARGRAPH_TRACK_PAIR(0), BARGRAPH_TRACK_PAIR(1), BARGRAPH_TRACK_PAIR(2), BARGRAPH_TRACK_PAIR(3), BARGRAPH_TRACK_PAIR(4), BARGRAPH_TRACK_PAIR(5),
+  BARGRAPH_TRACK_PAIR(6), BARGRAPH_TRACK_PAIR(7), BARGRAPH_TRACK_PAIR(8), BARGRAPH_TRACK_PAIR(9), BARGRAPH_TRACK_PAIR(10), BARGRAPH_TRACK_PAIR(11),
+  BARGRAPH_TRACK_PAIR(12), BARGRAPH_TRACK_PAIR(13), BARGRAPH_TRACK_PAIR(14), BARGRAPH_TRACK_PAIR(15), BARGRAPH_TRACK_PAIR(16), BARGRAPH_TRACK_PAIR(17),
+  BARGRAPH_TRACK_PAIR(18), BARGRAPH_TRACK_PAIR(19), BARGRAPH_TRACK_PAIR(20), BARGRAPH_TRACK_PAIR(21), BARGRAPH_TRACK_PAIR(22), BARGRAPH_TRACK_PAIR(23),
+  BARGRAPH_TRACK_PAIR(24), BARGRAPH_TRACK_PAIR(25), BARGRAPH_TRACK_PAIR(26), BARGRAPH_TRACK_PAIR(27), BARGRAPH_TRACK_PAIR(28), BARGRAPH_TRACK_PAIR(29)
+};
+
+const BargraphKeyframe bargraphTrackInnerPulse[BARGRAPH_TRACK_FRAMES_MAX] PROGMEM = {
+  BARGRAPH_TRACK_SPAN(0), BARGRAPH_TRACK_SPAN(1), BARGRAPH_TRACK_SPAN(2), BARGRAPH_TRACK_SPAN(3), BARGRAPH_TRACK_SPAN(4), BARGRAPH_TRACK_SPAN(5),
+  BARGRAPH_TRACK_SPAN(6), BARGRAPH_TRACK_SPAN(7), BARGRAPH_TRACK_SPAN(8), BARGRAPH_TRACK_SPAN(9), BARGRAPH_TRACK_SPAN(10), BARGRAPH_TRACK_SPAN(11),
+  BARGRAPH_TRACK_SPAN(12), BARGRAPH_TRACK_SPAN(13), BARGRAPH_TRACK_SPAN(14), BARGRAPH_TRACK_SPAN(15), BARGRAPH_TRACK_SPAN(16), BARGRAPH_TRACK_SPAN(17),
+  BARGRAPH_TRACK_SPAN(18), BARGRAPH_TRACK_SPAN(19), BARGRAPH_TRACK_SPAN(20), BARGRAPH_TRACK_SPAN(21), BARGRAPH_TRACK_SPAN(22), BARGRAPH_TRACK_SPAN(23),
+  BARGRAPH_TRACK_SPAN(24), BARGRAPH_TRACK_SPAN(25), BARGRAPH_TRACK_SPAN(26), BARGRAPH_TRACK_SPAN(27), BARGRAPH_TRACK_SPAN(28), BARGRAPH_TRACK_SPAN(29)
+};
+
+#undef BARGRAPH_TRACK_PAIR
+#undef BARGRAPH_TRACK_SPAN
+
 /***** Helper Functions *****/
 
 void bargraphSetElement(int8_t i_element, bool b_power) {
@@ -84,10 +138,23 @@ void bargraphCommitChanges() {
   ht_bargraph.sendLed();
 }
 
+void bargraphDrawFrame() {
+  // This sets or clears the elements changed by the latest sequencer frame, then commits them to the bargraph.
+  uint32_t i_changed = bargraphSequencer.changed();
+  uint32_t i_mask = bargraphSequencer.mask();
+
+  for(uint8_t i = 0; i < i_bargraph_elements; i++) {
+    if((i_changed >> i) & 0x01) {
+      bargraphSetElement(i, (i_mask >> i) & 0x01);
+    }
+  }
+
+  bargraphCommitChanges();
+}
+
 void bargraphReset() {
   // Sets the bargraph into a state where it can begin running.
   i_bargraph_element = 0;
-  i_bargraph_step = 0;
   BARGRAPH_STATE = BG_ON;
   ms_bargraph.stop();
 }
@@ -108,6 +175,7 @@ void bargraphClear() {
   if(b_bargraph_present) {
     ht_bargraph.clearAll();
   }
+  bargraphSequencer.stop(); // Any track must start over on the now empty display.
   i_bargraph_element = 0;
   BARGRAPH_STATE = BG_EMPTY; // Mark last known state.
 }
@@ -179,6 +247,9 @@ void bargraphUpdate(uint8_t i_delay_divisor) {
     i_delay_divisor = 1; // Avoid divide by zero.
   }
 
+  // Keyframe tracks play faster by the same divisor.
+  bargraphSequencer.setSpeed(i_delay_divisor);
+
   if(BARGRAPH_PATTERN == BG_POWER_RAMP ||
      BARGRAPH_PATTERN == BG_POWER_DOWN ||
      BARGRAPH_PATTERN == BG_POWER_UP) {
@@ -306,86 +377,37 @@ void bargraphUpdate(uint8_t i_delay_divisor) {
 
       case BG_INNER_PULSE:
       case BG_OUTER_INNER:
-        if(BARGRAPH_STATE != BG_EMPTY && BARGRAPH_STATE != BG_MID) {
+        const BargraphKeyframe *p_track = bargraphTrackOuterInner;
+        uint8_t i_start_frame = 0;
+
+        if(BARGRAPH_PATTERN == BG_INNER_PULSE) {
+          // This pattern begins at the midpoint and steps outward first.
+          p_track = bargraphTrackInnerPulse;
+          i_start_frame = BARGRAPH_TRACK_INNER_PULSE_START;
+        }
+
+        if(bargraphSequencer.isPlaying(p_track)) {
+          bargraphSequencer.next();
+        }
+        else {
           // Make sure bargraph is empty before starting the pattern.
           bargraphClear();
-
-          // Prepare to begin on appropriate step for the pattern.
-          if(BARGRAPH_PATTERN == BG_INNER_PULSE) {
-            // This pattern begins at the ends and so it must step backwards once it reaches the midpoint.
-            i_bargraph_step = i_bargraph_steps - 1;
-          }
-          else {
-            // All other patterns (read: BG_INNER_PULSE) starts and ends its steps at the midpoint.
-            i_bargraph_step = 0;
-          }
+          bargraphSequencer.play(p_track, BARGRAPH_TRACK_FRAMES, i_start_frame);
         }
 
-        uint8_t i_element_max = i_bargraph_elements - 1;
-        uint8_t i_step_mid = i_bargraph_steps - 1;
+        bargraphDrawFrame();
 
-        // Set special values when at either end of the bargraph.
-        if(i_bargraph_step == 0) {
-          // Denote that the bargraph is now empty, meaning it likely has not yet begun or just completed.
+        if(bargraphSequencer.frame() == 0) {
+          // Denote that the bargraph is now at either end, meaning the pattern likely has not yet begun or just completed.
           BARGRAPH_STATE = BG_EMPTY;
-
-          // Illuminate the first and last elements.
-          bargraphSetElement(i_bargraph_step, 1);
-          bargraphSetElement(i_element_max, 1);
-
-          if(BARGRAPH_PATTERN == BG_OUTER_INNER) {
-            // Clear the next inner elements.
-            bargraphSetElement(i_bargraph_step + 1, 0);
-            bargraphSetElement(i_element_max - 1, 0);
-          }
-
-          bargraphCommitChanges();
         }
-        else if(i_bargraph_step == i_step_mid) {
+        else if(bargraphSequencer.frame() == BARGRAPH_TRACK_MIDDLE) {
           // Denote that we are at the midpoint step, which is technically the endpoint for these patterns.
           BARGRAPH_STATE = BG_MID;
-
-          // Illuminate the middle elements.
-          bargraphSetElement(i_step_mid, 1);
-          bargraphSetElement(i_step_mid + 1, 1);
-
-          // Clear the next middle elements.
-          bargraphSetElement(i_step_mid - 1, 0);
-          bargraphSetElement(i_step_mid + 2, 0);
-
-          bargraphCommitChanges();
-        }
-        else {
-          // This covers all steps between the starting point and endpoint for the patterns.
-
-          // Illuminate elements N steps from each end of the device.
-          bargraphSetElement(i_bargraph_step, 1);
-          bargraphSetElement(i_element_max - i_bargraph_step, 1);
-
-          // Clear the next outer elements at N-1 steps.
-          bargraphSetElement(i_bargraph_step - 1, 0);
-          bargraphSetElement(i_element_max - (i_bargraph_step - 1), 0);
-
-          // Clear the next inner elements at N+1 steps.
-          if(BARGRAPH_PATTERN == BG_OUTER_INNER) {
-            bargraphSetElement(i_bargraph_step + 1, 0);
-            bargraphSetElement(i_element_max - (i_bargraph_step + 1), 0);
-          }
-
-          bargraphCommitChanges();
-        }
-
-        if(BARGRAPH_STATE != BG_MID) {
-          // Continue the pattern until it reaches the midpoint.
-          i_bargraph_step++;
-        }
-        else {
-          // Reverse direction at the midpoint state.
-          i_bargraph_step--;
         }
 
         // Reset timer for next iteration, with slight delay as the steps increase.
-        ms_bargraph.start(i_current_delay + i_bargraph_step);
+        ms_bargraph.start(bargraphSequencer.hold(i_bargraph_delay) + (i_bargraph_elements - i_bargraph_sim_max));
       break;
     }
   }
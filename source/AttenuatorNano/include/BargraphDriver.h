@@ -0,0 +1,121 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/*
+ * HT16K33 bargraph driver with a shadow of the display RAM, shared by the Neutrona Wand, Single-Shot Blaster and
+ * both Attenuator builds. This file must be kept identical in every one of those projects (the CI compile check
+ * compares the copies).
+ * It takes the place of the HT16K33 object from the ht16k33 library, with the same calls for the LED elements:
+ * setLed() and clearLed() only change the shadow, and sendLed() then writes just the span of display RAM bytes
+ * which differ from what the device last received, as one I2C transaction (or none at all when nothing changed).
+ * The library is still used to wake and configure the device in begin().
+ */
+class BargraphDriver {
+  public:
+    void begin(uint8_t i_address) {
+      device.begin(i_address);
+      i_i2c_address = BARGRAPH_DRIVER_BASE_ADDRESS | i_address;
+
+      // The device RAM is unknown until the first update, so that one is written in full.
+      memset(i_display_ram, 0, sizeof(i_display_ram));
+      b_device_ram_valid = false;
+    }
+
+    void setLed(uint8_t i_led) {
+      if(i_led < BARGRAPH_DRIVER_LEDS) {
+        i_display_ram[i_led / 8] |= (1 << (i_led % 8));
+      }
+    }
+
+    void clearLed(uint8_t i_led) {
+      if(i_led < BARGRAPH_DRIVER_LEDS) {
+        i_display_ram[i_led / 8] &= ~(1 << (i_led % 8));
+      }
+    }
+
+    // Changes one element and writes its byte straight away, leaving any other changes for the next sendLed().
+    void setLedNow(uint8_t i_led) {
+      setLed(i_led);
+      sendRange(i_led / 8, i_led / 8);
+    }
+
+    void clearLedNow(uint8_t i_led) {
+      clearLed(i_led);
+      sendRange(i_led / 8, i_led / 8);
+    }
+
+    void clearAll() {
+      memset(i_display_ram, 0, sizeof(i_display_ram));
+      sendLed();
+    }
+
+    void sendLed() {
+      sendRange(0, BARGRAPH_DRIVER_RAM_SIZE - 1);
+    }
+
+  private:
+    static const uint8_t BARGRAPH_DRIVER_BASE_ADDRESS = 0x70;
+    static const uint8_t BARGRAPH_DRIVER_RAM_SIZE = 16; // 16 bytes of display RAM; 128 LEDs.
+    static const uint8_t BARGRAPH_DRIVER_LEDS = BARGRAPH_DRIVER_RAM_SIZE * 8;
+
+    HT16K33 device;
+    uint8_t i_i2c_address = BARGRAPH_DRIVER_BASE_ADDRESS;
+    uint8_t i_display_ram[BARGRAPH_DRIVER_RAM_SIZE] = {}; // What the display should show.
+    uint8_t i_device_ram[BARGRAPH_DRIVER_RAM_SIZE] = {}; // What the device was last sent.
+    bool b_device_ram_valid = false;
+
+    // Writes the changed bytes between the given RAM addresses (inclusive) in a single transaction.
+    void sendRange(uint8_t i_first, uint8_t i_last) {
+      if(b_device_ram_valid) {
+        while(i_first <= i_last && i_display_ram[i_first] == i_device_ram[i_first]) {
+          i_first++;
+        }
+
+        while(i_last > i_first && i_display_ram[i_last] == i_device_ram[i_last]) {
+          i_last--;
+        }
+
+        if(i_first > i_last) {
+          return; // Nothing changed.
+        }
+      }
+      else {
+        i_first = 0;
+        i_last = BARGRAPH_DRIVER_RAM_SIZE - 1;
+      }
+
+      Wire.beginTransmission(i_i2c_address);
+      Wire.write(i_first); // Display data address pointer; the device moves on to the next address after each byte.
+
+      for(uint8_t i = i_first; i <= i_last; i++) {
+        Wire.write(i_display_ram[i]);
+        i_device_ram[i] = i_display_ram[i];
+      }
+
+      if(Wire.endTransmission() != 0) {
+        // Not acknowledged, so the device may not hold what was sent; write it all again next time.
+        b_device_ram_valid = false;
+      }
+      else if(i_first == 0 && i_last == BARGRAPH_DRIVER_RAM_SIZE - 1) {
+        b_device_ram_valid = true;
+      }
+    }
+};
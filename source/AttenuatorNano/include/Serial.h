@@ -25,65 +25,20 @@
  */
 SerialTransfer packComs;
 
-// Types of packets to be sent.
-enum PACKET_TYPE : uint8_t {
-  PACKET_UNKNOWN = 0,
-  PACKET_COMMAND = 1,
-  PACKET_DATA = 2,
-  PACKET_PACK = 3,
-  PACKET_WAND = 4,
-  PACKET_SMOKE = 5,
-  PACKET_SYNC = 6
-};
-
-// For command signals (1 byte ID, 2 byte optional data).
-struct __attribute__((packed)) CommandPacket {
-  uint8_t s;
-  uint8_t c;
-  uint16_t d1; // Reserved for values over 255 (eg. current music track)
-  uint8_t e;
-};
-
 struct CommandPacket sendCmd;
 struct CommandPacket recvCmd;
 
-// For generic data communication (1 byte ID, 4 byte array).
-struct __attribute__((packed)) MessagePacket {
-  uint8_t s;
-  uint8_t m;
-  uint8_t d[3]; // Reserved for multiple, arbitrary byte values.
-  uint8_t e;
-};
-
 struct MessagePacket sendData;
 struct MessagePacket recvData;
 
-struct __attribute__((packed)) AttenuatorSyncData {
-  uint8_t systemMode;
-  uint8_t ionArmSwitch;
-  uint8_t cyclotronLidState;
-  uint8_t systemYear;
-  uint8_t packOn;
-  uint8_t powerLevel;
-  uint8_t streamMode;
-  uint8_t wandPresent;
-  uint8_t barrelExtended;
-  uint8_t wandFiring;
-  uint8_t overheatingNow;
-  uint8_t speedMultiplier;
-  uint8_t spectralColour;
-  uint8_t spectralSaturation;
-  uint8_t masterMuted;
-  uint8_t masterVolume;
-  uint8_t effectsVolume;
-  uint8_t musicVolume;
-  uint8_t musicPlaying;
-  uint8_t musicPaused;
-  uint8_t trackLooped;
-  uint16_t currentTrack;
-  uint16_t musicCount;
-  uint16_t packVoltage;
-} attenuatorSyncData;
+struct AttenuatorSyncData attenuatorSyncData;
+
+// Size in bytes of each AttenuatorSyncData field, in the same order as above.
+const uint8_t i_sync_field_sizes[SYNC_FIELD_COUNT] PROGMEM = {
+  ATTENUATOR_SYNC_FIELDS(PROTOCOL_SYNC_SIZE)
+};
+
+struct SyncDeltaPacket syncDelta; // Field mask followed by only the changed AttenuatorSyncData fields.
 
 /*
  * Serial API Communication Handlers
@@ -102,6 +57,115 @@ void attenuatorSerialSend(uint8_t i_command, uint16_t i_value = 0) {
   packComs.sendData(i_send_size, (uint8_t) PACKET_COMMAND);
 }
 
+// Updates the local state from the latest AttenuatorSyncData values.
+void applySyncData() {
+  // Sync all required variables.
+  switch(attenuatorSyncData.systemYear) {
+    case 1:
+      SYSTEM_YEAR = SYSTEM_1984;
+    break;
+    case 2:
+      SYSTEM_YEAR = SYSTEM_1989;
+    break;
+    case 3:
+      SYSTEM_YEAR = SYSTEM_AFTERLIFE;
+    default:
+    break;
+    case 4:
+      SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
+    break;
+  }
+
+  switch(attenuatorSyncData.streamMode) {
+    case 1:
+    default:
+      STREAM_MODE = PROTON;
+    break;
+    case 2:
+      STREAM_MODE = STASIS;
+    break;
+    case 3:
+      STREAM_MODE = SLIME;
+    break;
+    case 4:
+      STREAM_MODE = MESON;
+    break;
+    case 5:
+      STREAM_MODE = SPECTRAL;
+    break;
+    case 6:
+      STREAM_MODE = HOLIDAY_HALLOWEEN;
+    break;
+    case 7:
+      STREAM_MODE = HOLIDAY_CHRISTMAS;
+    break;
+    case 8:
+      STREAM_MODE = SPECTRAL_CUSTOM;
+    break;
+  }
+
+  POWER_LEVEL_PREV = POWER_LEVEL;
+  switch(attenuatorSyncData.powerLevel) {
+    case 1:
+    default:
+      POWER_LEVEL = LEVEL_1;
+    break;
+    case 2:
+      POWER_LEVEL = LEVEL_2;
+    break;
+    case 3:
+      POWER_LEVEL = LEVEL_3;
+    break;
+    case 4:
+      POWER_LEVEL = LEVEL_4;
+    break;
+    case 5:
+      POWER_LEVEL = LEVEL_5;
+    break;
+  }
+
+  // Common actions to all hardware.
+  b_pack_on = attenuatorSyncData.packOn == 1;
+  b_firing = attenuatorSyncData.wandFiring == 1;
+  b_overheating = attenuatorSyncData.overheatingNow == 1;
+  i_speed_multiplier = attenuatorSyncData.speedMultiplier;
+  i_spectral_custom_colour = attenuatorSyncData.spectralColour;
+  i_spectral_custom_saturation = attenuatorSyncData.spectralSaturation;
+}
+
+// Copies the fields carried by a PACKET_SYNC_DELTA into the AttenuatorSyncData struct.
+bool mergeSyncDelta(uint16_t i_bytes_read) {
+  uint8_t *p_sync = (uint8_t *) &attenuatorSyncData;
+  uint16_t i_length = 0;
+  uint8_t i_offset = 0;
+
+  // Make sure the payload holds exactly the fields named in the mask before changing anything.
+  for(uint8_t i = 0; i < SYNC_FIELD_COUNT; i++) {
+    if(syncDelta.fields & (1UL << i)) {
+      i_length += pgm_read_byte(&i_sync_field_sizes[i]);
+    }
+  }
+
+  if(i_length + sizeof(syncDelta.fields) != i_bytes_read) {
+    return false;
+  }
+
+  i_length = 0;
+
+  for(uint8_t i = 0; i < SYNC_FIELD_COUNT; i++) {
+    uint8_t i_size = pgm_read_byte(&i_sync_field_sizes[i]);
+
+    if(syncDelta.fields & (1UL << i)) {
+      memcpy(p_sync + i_offset, syncDelta.d + i_length, i_size);
+      i_length += i_size;
+    }
+
+    i_offset += i_size;
+  }
+
+  return true;
+}
+
 // Forward function declaration.
 bool handleCommand(uint8_t i_command, uint16_t i_value);
 
@@ -172,79 +236,22 @@ bool checkPack() {
         case PACKET_SYNC:
           // Used to sync the pack to the Attenuator.
           packComs.rxObj(attenuatorSyncData);
+          applySyncData();
+        break;
 
-          // Sync all required variables.
-          switch(attenuatorSyncData.systemYear) {
-            case 1:
-              SYSTEM_YEAR = SYSTEM_1984;
-            break;
-            case 2:
-              SYSTEM_YEAR = SYSTEM_1989;
-            break;
-            case 3:
-              SYSTEM_YEAR = SYSTEM_AFTERLIFE;
-            default:
-            break;
-            case 4:
-              SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
-            break;
+        case PACKET_SYNC_DELTA:
+          if(b_wait_for_pack) {
+            // Can't proceed if the Pack isn't connected; prevents phantom actions from occurring.
+            return false;
           }
 
-          switch(attenuatorSyncData.streamMode) {
-            case 1:
-            default:
-              STREAM_MODE = PROTON;
-            break;
-            case 2:
-              STREAM_MODE = STASIS;
-            break;
-            case 3:
-              STREAM_MODE = SLIME;
-            break;
-            case 4:
-              STREAM_MODE = MESON;
-            break;
-            case 5:
-              STREAM_MODE = SPECTRAL;
-            break;
-            case 6:
-              STREAM_MODE = HOLIDAY_HALLOWEEN;
-            break;
-            case 7:
-              STREAM_MODE = HOLIDAY_CHRISTMAS;
-            break;
-            case 8:
-              STREAM_MODE = SPECTRAL_CUSTOM;
-            break;
-          }
+          // Only the fields which changed since the last sync are sent.
+          packComs.rxObj(syncDelta);
 
-          POWER_LEVEL_PREV = POWER_LEVEL;
-          switch(attenuatorSyncData.powerLevel) {
-            case 1:
-            default:
-              POWER_LEVEL = LEVEL_1;
-            break;
-            case 2:
-              POWER_LEVEL = LEVEL_2;
-            break;
-            case 3:
-              POWER_LEVEL = LEVEL_3;
-            break;
-            case 4:
-              POWER_LEVEL = LEVEL_4;
-            break;
-            case 5:
-              POWER_LEVEL = LEVEL_5;
-            break;
+          if(mergeSyncDelta(packComs.bytesRead)) {
+            applySyncData();
+            return true; // Indicates a status change.
           }
-
-          // Common actions to all hardware.
-          b_pack_on = attenuatorSyncData.packOn == 1;
-          b_firing = attenuatorSyncData.wandFiring == 1;
-          b_overheating = attenuatorSyncData.overheatingNow == 1;
-          i_speed_multiplier = attenuatorSyncData.speedMultiplier;
-          i_spectral_custom_colour = attenuatorSyncData.spectralColour;
-          i_spectral_custom_saturation = attenuatorSyncData.spectralSaturation;
         break;
       }
     }
@@ -273,7 +280,7 @@ bool handleCommand(uint8_t i_command, uint16_t i_value) {
       b_state_changed = true;
       ms_packsync.start(i_sync_disconnect_delay);
 
-      attenuatorSerialSend(A_SYNC_END); // Signal end of sync.
+      attenuatorSerialSend(A_SYNC_END, i_protocol_hash); // Signal end of sync, along with the protocol we were built for.
     break;
 
     case A_WAND_CONNECTED:
@@ -37,6 +37,8 @@
 // Local Files
 #include "Configuration.h"
 #include "Communication.h"
+#include "BargraphDriver.h"
+#include "BargraphSequencer.h"
 #include "Header.h"
 #include "Bargraph.h"
 #include "Colours.h"
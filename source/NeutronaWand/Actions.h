@@ -99,7 +99,7 @@ void checkWandAction() {
 
     case ACTION_OVERHEATING:
       if(b_overheat_bargraph_blink == true) {
-        settingsBlinkingLights();
+        bargraphOverheatBlink();
 
         if(ms_blink_sound_timer_1.justFinished()) {
           if(b_extra_pack_sounds == true) {
@@ -30,11 +30,12 @@
  */
 #include <GPStarAudio.h>
 gpstarAudio audio;
+AudioQueue<i_last_effects_track + 1> audioQueue; // Sound effect commands waiting to be sent; see AudioQueue.h.
 
 /*
  * Audio Devices
  */
-enum AUDIO_DEVICES { A_NONE, A_GPSTAR_AUDIO, A_GPSTAR_AUDIO_ADV, A_WAV_TRIGGER };
+enum AUDIO_DEVICES { A_NONE, A_GPSTAR_AUDIO, A_GPSTAR_AUDIO_ADV, A_WAV_TRIGGER, A_DETECTING };
 enum AUDIO_DEVICES AUDIO_DEVICE;
 
 /*
@@ -49,6 +50,7 @@ const int8_t i_track_volume_abs_max = 0; // Maximum gain for effects/music is 0
 bool b_playing_music = false; // Sets whether a music track is currently playing or not.
 bool b_music_paused = false; // Sets whether a music track is currently paused or not.
 bool b_repeat_track = false; // Sets whether to repeat one music track or loop through all music tracks.
+bool b_track_reports = false; // Set once the audio board is seen sending track reports, which fill the voice tables.
 bool b_preload_tracks = false; // Sets whether to add a 50ms delay before playing any file to allow slower SD cards more time to fill the buffer.
 
 /*
@@ -61,6 +63,17 @@ millisDelay ms_check_music;
 millisDelay ms_music_next_track;
 millisDelay ms_music_status_check;
 
+/*
+ * Audio Device Detection
+ * Runs from updateAudio() rather than holding up the boot sequence. Both kinds of audio board are asked to identify
+ * themselves at once, repeating until one answers or the time allowed for a board to boot up runs out. Sound effects
+ * requested in the meantime wait in the audio queue until the device is known.
+ */
+const uint16_t i_audio_detect_timeout = 1700; // Time for an audio board to boot up and answer.
+const uint16_t i_audio_probe_delay = 250; // Time between requests for the audio boards to identify themselves.
+millisDelay ms_audio_detect;
+millisDelay ms_audio_probe;
+
 /*
  * Volume percentage values (0 to 100)
  */
@@ -84,6 +97,7 @@ int8_t i_volume_music = i_volume_abs_min - (i_volume_abs_min * i_volume_music_pe
  */
 void playEffect(uint16_t i_track_id, bool b_track_loop = false, int8_t i_track_volume = i_volume_effects, bool b_fade_in = false, uint16_t i_fade_time = 0, bool b_lock = true);
 void stopEffect(uint16_t i_track_id);
+void loopEffect(uint16_t i_track_id, bool b_track_loop);
 void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_track2_loop = false, uint16_t i_track2_offset = 0, int8_t i_track_volume = i_volume_effects, bool b_fade_in = false, uint16_t i_fade_time = 0, bool b_lock = true);
 void adjustGainEffect(uint16_t i_track_id, int8_t i_track_volume = i_volume_effects, bool b_fade = false, uint16_t i_fade_time = 0);
 void updateMasterVolume(bool startup = false);
@@ -92,6 +106,58 @@ void updateMasterVolume(bool startup = false);
  * Audio playback functions.
  */
 
+// Send the sound effect commands queued during this pass of the main loop.
+void flushAudio() {
+  if(AUDIO_DEVICE == A_DETECTING) {
+    // Hold everything until there is a device to send it to.
+    return;
+  }
+
+  for(uint8_t i = 0; i < audioQueue.size(); i++) {
+    const AudioCommand &command = audioQueue.command(i);
+
+    if(command.i_flags & AQ_STOP) {
+      audio.trackStop(command.i_track);
+    }
+
+    if(command.i_flags & AQ_GAIN) {
+      audio.trackGain(command.i_track, command.i_gain);
+    }
+
+    if(command.i_flags & AQ_PLAY) {
+      if(AUDIO_DEVICE == A_GPSTAR_AUDIO_ADV) {
+        audio.trackPlayPoly(command.i_track, command.i_flags & AQ_LOCK, b_preload_tracks ? 50 : 0);
+      }
+      else {
+        audio.trackPlayPoly(command.i_track, command.i_flags & AQ_LOCK);
+      }
+    }
+
+    if(command.i_flags & AQ_FADE) {
+      audio.trackFade(command.i_track, command.i_fade_gain, command.i_fade_time, 0);
+    }
+
+    if(command.i_flags & AQ_LOOP) {
+      audio.trackLoop(command.i_track, (command.i_flags & AQ_LOOP_ON) ? 1 : 0);
+    }
+  }
+
+  audioQueue.clear();
+}
+
+// Make sure the queue can take a command for a track, sending what it holds early if it is full.
+void reserveAudioQueue(uint16_t i_track_id) {
+  if(!audioQueue.hasRoom(i_track_id)) {
+    if(AUDIO_DEVICE == A_DETECTING) {
+      // Nothing can be sent yet, so the oldest sound gives way to the new one.
+      audioQueue.dropOldest();
+    }
+    else {
+      flushAudio();
+    }
+  }
+}
+
 // Play a sound effect using certain defaults.
 void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, bool b_fade_in, uint16_t i_fade_time, bool b_lock) {
   if(i_track_volume < i_volume_abs_min) {
@@ -105,41 +171,34 @@ void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, b
   switch(AUDIO_DEVICE) {
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
+    case A_GPSTAR_AUDIO_ADV:
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+
       if(b_fade_in) {
-        audio.trackGain(i_track_id, i_volume_abs_min);
-        audio.trackPlayPoly(i_track_id, b_lock);
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
+        audioQueue.play(i_track_id, b_track_loop, i_volume_abs_min, b_lock);
+        audioQueue.fade(i_track_id, i_track_volume, i_fade_time);
       }
       else {
-        audio.trackGain(i_track_id, i_track_volume);
-        audio.trackPlayPoly(i_track_id, b_lock);
+        audioQueue.play(i_track_id, b_track_loop, i_track_volume, b_lock);
       }
+    break;
 
-      if(b_track_loop) {
-        audio.trackLoop(i_track_id, 1);
-      }
-      else {
-        audio.trackLoop(i_track_id, 0);
-      }
+    case A_NONE:
+    default:
+      // No audio device connected.
     break;
+  }
+}
 
+void stopEffect(uint16_t i_track_id) {
+  switch(AUDIO_DEVICE) {
+    case A_WAV_TRIGGER:
+    case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
-      if(b_fade_in) {
-        audio.trackGain(i_track_id, i_volume_abs_min);
-        audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 50 : 0);
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
-      }
-      else {
-        audio.trackGain(i_track_id, i_track_volume);
-        audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 50 : 0);
-      }
-
-      if(b_track_loop) {
-        audio.trackLoop(i_track_id, 1);
-      }
-      else {
-        audio.trackLoop(i_track_id, 0);
-      }
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+      audioQueue.stop(i_track_id);
     break;
 
     case A_NONE:
@@ -149,12 +208,15 @@ void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, b
   }
 }
 
-void stopEffect(uint16_t i_track_id) {
+// Turn looping of a sound effect on or off. Once looping is off, the track stops naturally at its end.
+void loopEffect(uint16_t i_track_id, bool b_track_loop) {
   switch(AUDIO_DEVICE) {
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
-      audio.trackStop(i_track_id);
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+      audioQueue.loop(i_track_id, b_track_loop);
     break;
 
     case A_NONE:
@@ -176,6 +238,9 @@ void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_trac
 
   switch(AUDIO_DEVICE) {
     case A_GPSTAR_AUDIO_ADV:
+      // Sent straight away, so anything already queued for these tracks has to go first.
+      flushAudio();
+
       if(b_fade_in) {
         audio.trackGain(i_track_id, i_volume_abs_min);
         audio.trackGain(i_track_id2, i_track_volume);
@@ -187,6 +252,9 @@ void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_trac
         audio.trackGain(i_track_id2, i_track_volume);
         audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 5 : 0, i_track_id2, b_track2_loop, i_track2_offset);
       }
+
+      audioQueue.setActive(i_track_id, true);
+      audioQueue.setActive(i_track_id2, true);
     break;
 
     default:
@@ -400,11 +468,14 @@ void adjustGainEffect(uint16_t i_track_id, int8_t i_track_volume, bool b_fade, u
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+
       if(b_fade) {
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
+        audioQueue.fade(i_track_id, i_track_volume, i_fade_time);
       }
       else {
-        audio.trackGain(i_track_id, i_track_volume);
+        audioQueue.gain(i_track_id, i_track_volume);
       }
     break;
 
@@ -523,40 +594,40 @@ void updateEffectsVolume() {
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
       // Only continuous effects really need to be adjusted on the fly.
-      audio.trackGain(S_BEEP_8, i_volume_effects);
-      audio.trackGain(S_PACK_BEEPS_OVERHEAT, i_volume_effects);
-      audio.trackGain(S_SMASH_ERROR_LOOP, i_volume_effects);
+      adjustGainEffect(S_BEEP_8, i_volume_effects);
+      adjustGainEffect(S_PACK_BEEPS_OVERHEAT, i_volume_effects);
+      adjustGainEffect(S_SMASH_ERROR_LOOP, i_volume_effects);
 
-      audio.trackGain(S_IDLE_LOOP_GUN_1, i_volume_effects);
-      audio.trackGain(S_IDLE_LOOP_GUN_2, i_volume_effects);
-      audio.trackGain(S_IDLE_LOOP_GUN_3, i_volume_effects);
-      audio.trackGain(S_IDLE_LOOP_GUN_4, i_volume_effects);
-      audio.trackGain(S_IDLE_LOOP_GUN_5, i_volume_effects);
+      adjustGainEffect(S_IDLE_LOOP_GUN_1, i_volume_effects);
+      adjustGainEffect(S_IDLE_LOOP_GUN_2, i_volume_effects);
+      adjustGainEffect(S_IDLE_LOOP_GUN_3, i_volume_effects);
+      adjustGainEffect(S_IDLE_LOOP_GUN_4, i_volume_effects);
+      adjustGainEffect(S_IDLE_LOOP_GUN_5, i_volume_effects);
 
       // Standalone wand has additional idle effects.
       if(b_gpstar_benchtest) {
-        audio.trackGain(S_WAND_SLIME_IDLE_LOOP, i_volume_effects);
-        audio.trackGain(S_WAND_STASIS_IDLE_LOOP, i_volume_effects);
-        audio.trackGain(S_MESON_IDLE_LOOP, i_volume_effects);
+        adjustGainEffect(S_WAND_SLIME_IDLE_LOOP, i_volume_effects);
+        adjustGainEffect(S_WAND_STASIS_IDLE_LOOP, i_volume_effects);
+        adjustGainEffect(S_MESON_IDLE_LOOP, i_volume_effects);
       }
 
       if(b_firing) {
         switch(STREAM_MODE) {
           case PROTON:
           default:
-            audio.trackGain(S_GB1_1984_FIRE_LOOP_GUN, i_volume_effects);
-            audio.trackGain(S_GB1_1984_FIRE_HIGH_POWER_LOOP, i_volume_effects);
-            audio.trackGain(S_GB2_FIRE_LOOP, i_volume_effects);
-            audio.trackGain(S_FIRING_LOOP_GB1, i_volume_effects);
-            audio.trackGain(S_GB1_FIRE_HIGH_POWER_LOOP, i_volume_effects);
+            adjustGainEffect(S_GB1_1984_FIRE_LOOP_GUN, i_volume_effects);
+            adjustGainEffect(S_GB1_1984_FIRE_HIGH_POWER_LOOP, i_volume_effects);
+            adjustGainEffect(S_GB2_FIRE_LOOP, i_volume_effects);
+            adjustGainEffect(S_FIRING_LOOP_GB1, i_volume_effects);
+            adjustGainEffect(S_GB1_FIRE_HIGH_POWER_LOOP, i_volume_effects);
           break;
 
           case SLIME:
-            audio.trackGain(S_SLIME_LOOP, i_volume_effects);
+            adjustGainEffect(S_SLIME_LOOP, i_volume_effects);
           break;
 
           case STASIS:
-            audio.trackGain(S_STASIS_LOOP, i_volume_effects);
+            adjustGainEffect(S_STASIS_LOOP, i_volume_effects);
           break;
 
           case MESON:
@@ -566,19 +637,19 @@ void updateEffectsVolume() {
       }
 
       // Special volume in use.
-      audio.trackGain(S_AFTERLIFE_WAND_IDLE_1, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_IDLE_2, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_1, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_2, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_2_FADE_IN, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_1, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_2, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_2_FADE_OUT, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_BEEP_WAND_S1, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_BEEP_WAND_S2, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_BEEP_WAND_S3, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_BEEP_WAND_S4, i_volume_effects);
-      audio.trackGain(S_AFTERLIFE_BEEP_WAND_S5, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_IDLE_1, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_IDLE_2, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_1, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_2, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_2_FADE_IN, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_1, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_2, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_2_FADE_OUT, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S1, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S2, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S3, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S4, i_volume_effects);
+      adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S5, i_volume_effects);
     break;
 
     case A_NONE:
@@ -728,6 +799,11 @@ bool musicTrackStatus() {
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
+      if(b_track_reports) {
+        // Local lookup in the voice table the library keeps from the track reports.
+        return audio.isTrackPlaying(i_current_music_track);
+      }
+
       return audio.currentTrackStatus(i_current_music_track);
     break;
 
@@ -746,7 +822,10 @@ void checkMusic() {
       case A_GPSTAR_AUDIO_ADV:
         ms_check_music.start(i_music_check_delay);
 
-        musicTrackPlayingStatus();
+        if(!b_track_reports) {
+          // Without track reports, the music track status has to be requested.
+          musicTrackPlayingStatus();
+        }
 
         // Loop through all the tracks if the music is not set to repeat a track.
         if(b_playing_music && !b_repeat_track && !b_music_paused) {
@@ -801,14 +880,14 @@ void toggleMusicLoop() {
       if(!b_repeat_track) {
         b_repeat_track = true;
 
-        if(i_music_count > 0) {
+        if(i_music_count > 0 && b_playing_music) {
           audio.trackLoop(i_current_music_track, 1);
         }
       }
       else {
         b_repeat_track = false;
 
-        if(i_music_count > 0) {
+        if(i_music_count > 0 && b_playing_music) {
           audio.trackLoop(i_current_music_track, 0);
         }
       }
@@ -830,45 +909,60 @@ void toggleMusicLoop() {
  * Audio Setup Routines
  * Used to detect, update, and reset the available audio devices.
  */
-bool setupAudioDevice() {
-  // Short delay to allow the audio boards to boot up.
-  delay(1000);
-
-  char gVersion[VERSION_STRING_LEN];
-
+// Start looking for an audio device; checkAudioDevice() carries on from updateAudio().
+void setupAudioDevice() {
   Serial3.begin(57600);
 
   audio.start(Serial3);
 
-  // Ask for some Wav Trigger information.
-  audio.requestVersionString();
-  audio.requestSystemInfo();
+  AUDIO_DEVICE = A_DETECTING;
+  b_track_reports = false;
+  audioQueue.reset();
 
-  delay(10);
+  ms_audio_detect.start(i_audio_detect_timeout);
+  ms_audio_probe.start(0);
+}
 
+// Settings sent to the audio device once it has identified itself.
+void configureAudioDevice() {
   // Stop all tracks.
   audio.stopAllTracks();
 
   // Reset the sample rate offset. Only for the WAV Trigger.
   audio.samplerateOffset(0);
 
-  audio.masterGain(i_volume_abs_min); // Reset the master gain db. Range is -70 to 0. Bootup the system muted, then we reset it after the system is loaded.
-
   // Onboard amplifier on or off. Only for the WAV Trigger.
   audio.setAmpPwr(b_onboard_amp_enabled);
 
   // Enable track reporting if in bench test mode. Only for the WAV Trigger.
   audio.setReporting(b_gpstar_benchtest);
 
-  // Allow time for hello command and other data to return back.
-  delay(350);
+  // Now that the device type and its volume range are known, set the master volume.
+  updateMasterVolume(true);
+}
+
+// Check for an answer from either kind of audio board, asking again until one answers or time runs out.
+void checkAudioDevice() {
+  char gVersion[VERSION_STRING_LEN];
+  bool b_timed_out = ms_audio_detect.justFinished();
+
+  audio.update();
 
   if(audio.getVersion(gVersion)) {
-    // We found a WAV Trigger. Build the music track count.
+    // We found a WAV Trigger. Only attempt to build a music track count if it responded with RSP_SYSTEM_INFO.
     if(audio.wasSysInfoRcvd()) {
-      // Only attempt to build a music track count if the WAV Trigger responded with RSP_SYSTEM_INFO.
       buildMusicCount((uint16_t) audio.getNumTracks());
     }
+    else if(!b_timed_out) {
+      // Give it until the timeout to do so, asking again in case the first request was lost.
+      if(ms_audio_probe.justFinished()) {
+        audio.requestSystemInfo();
+
+        ms_audio_probe.start(i_audio_probe_delay);
+      }
+
+      return;
+    }
     else {
       debugln(F("Warning: RSP_SYSTEM_INFO not received!"));
     }
@@ -876,15 +970,8 @@ bool setupAudioDevice() {
     AUDIO_DEVICE = A_WAV_TRIGGER;
 
     debugln(F("Using WAV Trigger"));
-
-    return true;
   }
-
-  audio.hello();
-
-  delay(350);
-
-  if(audio.gpstarAudioHello()) {
+  else if(audio.gpstarAudioHello()) {
     if(audio.getVersionNumber() != 0) {
       AUDIO_DEVICE = A_GPSTAR_AUDIO_ADV;
     }
@@ -903,16 +990,48 @@ bool setupAudioDevice() {
     debugln(audio.getVersionNumber());
 
     buildMusicCount((uint16_t) audio.getNumTracks());
-
-    return true;
   }
-  else {
-    // No audio devices connected.
+  else if(b_timed_out) {
+    // No audio devices connected; drop any sound effects which were waiting for one.
     AUDIO_DEVICE = A_NONE;
+    audioQueue.reset();
+    ms_audio_probe.stop();
 
     debugln(F("No Audio Device"));
 
-    return false;
+    return;
+  }
+  else {
+    if(ms_audio_probe.justFinished()) {
+      // Ask for some WAV Trigger information and say hello to GPStar Audio; whichever is present will answer.
+      audio.requestVersionString();
+      audio.requestSystemInfo();
+      audio.hello();
+
+      ms_audio_probe.start(i_audio_probe_delay);
+    }
+
+    return;
+  }
+
+  ms_audio_detect.stop();
+  ms_audio_probe.stop();
+
+  configureAudioDevice();
+}
+
+// Bring the voice table in the audio queue up to date with the track reports, checking one active track per loop.
+void updateAudioVoices() {
+  uint16_t i_track_id = audioQueue.nextActive();
+
+  if(i_track_id > 0) {
+    bool b_playing = audio.isTrackPlaying(i_track_id);
+
+    if(b_playing) {
+      b_track_reports = true;
+    }
+
+    audioQueue.report(i_track_id, b_playing);
   }
 }
 
@@ -922,6 +1041,11 @@ void updateAudio() {
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
       audio.update();
+      updateAudioVoices();
+    break;
+
+    case A_DETECTING:
+      checkAudioDevice();
     break;
 
     case A_NONE:
@@ -275,15 +275,82 @@ CHSV getHue(uint8_t i_colour, uint8_t i_brightness = 255, uint8_t i_saturation =
   }
 }
 
-CRGB getHueAsRGB(uint8_t i_colour, uint8_t i_brightness = 255, bool b_grb = false) {
-  // Brightness here is a value from 0-255 as limited by byte (uint8_t) type.
+// Colour schemes which advance through their colours on each call to getHue(), so their output cannot be reused.
+bool isCyclingColour(uint8_t i_colour) {
+  switch(i_colour) {
+    case C_REDGREEN:
+    case C_ORANGEPURPLE:
+    case C_PASTEL:
+    case C_RAINBOW:
+      return true;
+    break;
+
+    default:
+      return false;
+    break;
+  }
+}
+
+// Dims a colour converted at full brightness to the same result hsv2rgb_rainbow() gives for that brightness,
+// which with FastLED's default FASTLED_SCALE8_FIXED is a plain scale8() of each channel.
+CRGB scaleHueBrightness(CRGB rgb, uint8_t i_brightness) {
+  if(i_brightness == 255) {
+    return rgb;
+  }
+
+  uint8_t i_scale = scale8_video(i_brightness, i_brightness);
+
+  if(i_scale == 0) {
+    return CRGB(0, 0, 0);
+  }
+
+  return CRGB(scale8(rgb.r, i_scale), scale8(rgb.g, i_scale), scale8(rgb.b, i_scale));
+}
 
-  // Get the initial colour using the HSV scheme.
-  CHSV hsv = getHue(i_colour, i_brightness);
+// Palette cache: the full-brightness RGB last resolved for the barrel, so static colours skip getHue() and hsv2rgb_rainbow().
+// The entry is keyed on the colour plus the custom hue/saturation for C_CUSTOM. A stream mode or year change selects
+// a different colour, which simply misses and replaces the entry.
+struct PaletteEntry {
+  bool b_valid = false;
+  uint8_t i_colour = 0;
+  uint16_t i_custom = 0; // Custom hue (high byte) and saturation (low byte) the entry was resolved with.
+  bool b_fixed_brightness = false; // Colour overrides the requested brightness (eg. C_BLACK).
+  CRGB rgb;
+} palette;
+
+// Returns a static (non-cycling) colour at the given brightness, in RGB order.
+CRGB getPaletteColour(uint8_t i_colour, uint8_t i_brightness) {
+  uint16_t i_custom = (i_colour == C_CUSTOM) ? ((i_spectral_wand_custom_colour << 8) | i_spectral_wand_custom_saturation) : 0;
+
+  if(!palette.b_valid || palette.i_colour != i_colour || palette.i_custom != i_custom) {
+    CHSV hsv = getHue(i_colour);
+
+    hsv2rgb_rainbow(hsv, palette.rgb);
+    palette.i_colour = i_colour;
+    palette.i_custom = i_custom;
+    palette.b_fixed_brightness = (hsv.val != 255);
+    palette.b_valid = true;
+  }
+
+  if(palette.b_fixed_brightness) {
+    return palette.rgb;
+  }
+
+  return scaleHueBrightness(palette.rgb, i_brightness);
+}
 
-  // Convert from HSV to RGB.
+CRGB getHueAsRGB(uint8_t i_colour, uint8_t i_brightness = 255, bool b_grb = false) {
+  // Brightness here is a value from 0-255 as limited by byte (uint8_t) type.
   CRGB rgb; // RGB Array as { r, g, b }
-  hsv2rgb_rainbow(hsv, rgb);
+
+  if(isCyclingColour(i_colour)) {
+    // Colour cycles move on with every call, so these are converted from the HSV scheme each time.
+    CHSV hsv = getHue(i_colour, i_brightness);
+    hsv2rgb_rainbow(hsv, rgb);
+  }
+  else {
+    rgb = getPaletteColour(i_colour, i_brightness);
+  }
 
   if(b_grb) {
     // Swap red/green values before returning.
@@ -315,3 +382,66 @@ CRGB getHueColour(uint8_t i_colour, WAND_BARREL_LED_COUNTS NUM_LEDS_ENUM, uint8_
     break;
   }
 }
+
+/*
+ * Barrel stream styles, as drawn by fireStreamEffect().
+ * The head of the stream is drawn in the firing colour and moves along the barrel, leaving the tail colour behind it.
+ * Each style is picked from the stream mode, year, power level and cross-streams state (see getBarrelStreamStyle()).
+ * Timings are for the 48/50 LED barrels; the 2/5 LED barrels share the fixed timings below and draw no trail.
+ */
+enum BARREL_STREAM_STYLES : uint8_t {
+  BARREL_PROTON,
+  BARREL_PROTON_1989,
+  BARREL_CROSS_STREAMS,
+  BARREL_CROSS_STREAMS_FE,
+  BARREL_SLIME,
+  BARREL_SLIME_1989,
+  BARREL_STASIS,
+  BARREL_MESON,
+  BARREL_DARK,
+  BARREL_CUSTOM,
+  BARREL_STYLE_COUNT
+};
+
+// Flags for BarrelStreamStyle.
+const uint8_t BARREL_SETS_LED_DELAY = 0x01; // Slow the LED refresh as the power level rises.
+const uint8_t BARREL_NO_RESTART = 0x02; // The stream is not restarted once it reaches the tip (the firing action does that).
+
+struct BarrelStreamStyle {
+  uint8_t i_tail_colour[5]; // Colour left behind the head, per power level.
+  int8_t i_head_delay[5]; // Added to i_firing_stream / 25 for each step of the head.
+  uint8_t i_trail_divisor; // The head is followed by a trail up to i_num_barrel_leds / divisor long, or 0 for none.
+  uint8_t i_trail_extra[5]; // Added to the trail, per power level.
+  uint8_t i_led_delay[5]; // Added to FAST_LED_UPDATE_MS, per power level, with BARREL_SETS_LED_DELAY.
+  uint8_t i_flags;
+};
+
+const BarrelStreamStyle barrelStreamStyles[BARREL_STYLE_COUNT] PROGMEM = {
+  // BARREL_PROTON: Shift the stream from red to orange on higher power levels.
+  { { C_RED, C_RED2, C_RED3, C_RED4, C_RED5 }, { 4, 3, 2, 1, 0 }, 3, { 2, 3, 6, 8, 10 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_PROTON_1989: Shift the stream from orange to red on higher power levels.
+  { { C_RED5, C_RED4, C_RED3, C_RED2, C_RED }, { 4, 3, 2, 1, 0 }, 3, { 2, 3, 6, 8, 10 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_CROSS_STREAMS
+  { { C_WHITE, C_WHITE, C_WHITE, C_WHITE, C_WHITE }, { 4, 3, 2, 1, 0 }, 3, { 2, 3, 6, 8, 10 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_CROSS_STREAMS_FE: Frozen Empire with the Cyclotron lid off.
+  { { C_CHARTREUSE, C_CHARTREUSE, C_CHARTREUSE, C_CHARTREUSE, C_CHARTREUSE }, { 4, 3, 2, 1, 0 }, 3, { 2, 3, 6, 8, 10 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_SLIME
+  { { C_DARK_GREEN, C_DARK_GREEN, C_DARK_GREEN, C_DARK_GREEN, C_DARK_GREEN }, { 2, 1, 0, -1, -2 }, 4, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_SLIME_1989
+  { { C_PASTEL_PINK, C_PASTEL_PINK, C_PASTEL_PINK, C_PASTEL_PINK, C_PASTEL_PINK }, { 2, 1, 0, -1, -2 }, 4, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_STASIS
+  { { C_BLUE, C_BLUE, C_BLUE, C_BLUE, C_BLUE }, { 2, 1, 0, -1, -2 }, 4, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_MESON: A fixed block of 4 LEDs.
+  { { C_BLACK, C_BLACK, C_BLACK, C_BLACK, C_BLACK }, { 0, -1, -1, -1, -2 }, 0, { 4, 4, 4, 4, 4 }, { 0, 0, 1, 3, 4 }, BARREL_SETS_LED_DELAY | BARREL_NO_RESTART },
+  // BARREL_DARK: Spectral and holiday streams.
+  { { C_BLACK, C_BLACK, C_BLACK, C_BLACK, C_BLACK }, { 2, 1, 0, -1, -2 }, 4, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, 0 },
+  // BARREL_CUSTOM
+  { { C_CUSTOM, C_CUSTOM, C_CUSTOM, C_CUSTOM, C_CUSTOM }, { 2, 1, 0, -1, -2 }, 4, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, 0 }
+};
+
+// Pause before the stream restarts: i_firing_stream / 10 less this for the 48/50 LED barrels, or i_firing_stream less this for the 2/5 LED barrels.
+const uint8_t i_barrel_restart_long[5] PROGMEM = { 5, 6, 7, 8, 9 };
+const uint8_t i_barrel_restart_short[5] PROGMEM = { 0, 15, 30, 45, 60 };
+
+// Each step of the head on the 2/5 LED barrels: i_firing_stream / 5 plus this.
+const uint8_t i_barrel_head_short[5] PROGMEM = { 10, 8, 6, 5, 4 };
@@ -294,7 +294,7 @@ uint8_t i_bargraph_status = 0;
  * (Optional) Barmeter 28-segment bargraph configuration and timers.
  * Part #: BL28Z-3005SA04Y
  */
-HT16K33 ht_bargraph;
+BargraphDriver ht_bargraph;
 
 /*
  * Used to change to 28-segment bargraph features.
@@ -339,6 +339,221 @@ const uint8_t i_bargraph_wamco_invert[i_bargraph_segments] PROGMEM = {64, 48, 32
 const uint8_t i_bargraph_wamco_normal[i_bargraph_segments] PROGMEM = {69, 5, 21, 37, 53, 68, 52, 36, 20, 4, 67, 51, 35, 19, 3, 2, 18, 34, 50, 66, 65, 49, 33, 17, 1, 0, 16, 32, 48, 64};
 const uint8_t i_bargraph_power_table_wamco[i_power_level_max + 1] PROGMEM = {0, 6, 12, 18, 24, 29};
 
+/*
+ * Super Hero firing animation tracks for the bargraph sequencer (see BargraphSequencer.h).
+ * A mirrored pair of segments travels from the middle to the ends and back again; the Hasbro bargraph alternates
+ * between three patterns instead. Frames are stepped by ms_bargraph_firing, which already speeds up alongside the
+ * cyclotron as the wand nears an overheat, so the hold times are unused. Each cue is the vibration added to
+ * i_vibration_level for that frame, with BARGRAPH_CUE_TIP set when the optional wand tip light should be on.
+ */
+const uint8_t BARGRAPH_CUE_TIP = 0x80;
+BargraphSequencer bargraphSequencer;
+
+const BargraphKeyframe bargraphTrackSuperHero30[] PROGMEM = {
+  // Middle to the ends.
+  {0x0000C000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00012000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00021000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00040800, 0, 110},
+  {0x00080400, 0, 110},
+  {0x00100200, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00200100, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00400080, 0, 112},
+  {0x00800040, 0, 112},
+  {0x01000020, 0, BARGRAPH_CUE_TIP | 112},
+  {0x02000010, 0, BARGRAPH_CUE_TIP | 112},
+  {0x04000008, 0, 112},
+  {0x08000004, 0, 115},
+  {0x10000002, 0, BARGRAPH_CUE_TIP | 115},
+  {0x20000001, 0, BARGRAPH_CUE_TIP | 115},
+  // Back towards the middle.
+  {0x10000002, 0, BARGRAPH_CUE_TIP | 115},
+  {0x08000004, 0, 115},
+  {0x04000008, 0, 112},
+  {0x02000010, 0, BARGRAPH_CUE_TIP | 112},
+  {0x01000020, 0, BARGRAPH_CUE_TIP | 112},
+  {0x00800040, 0, 112},
+  {0x00400080, 0, 112},
+  {0x00200100, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00100200, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00080400, 0, 110},
+  {0x00040800, 0, 110},
+  {0x00021000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00012000, 0, BARGRAPH_CUE_TIP | 110}
+};
+
+const BargraphKeyframe bargraphTrackSuperHero28[] PROGMEM = {
+  // Middle to the ends.
+  {0x00006000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00009000, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00010800, 0, 110},
+  {0x00020400, 0, 110},
+  {0x00040200, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00080100, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00100080, 0, 112},
+  {0x00200040, 0, 112},
+  {0x00400020, 0, BARGRAPH_CUE_TIP | 112},
+  {0x00800010, 0, BARGRAPH_CUE_TIP | 112},
+  {0x01000008, 0, 112},
+  {0x02000004, 0, 115},
+  {0x04000002, 0, BARGRAPH_CUE_TIP | 115},
+  {0x08000001, 0, BARGRAPH_CUE_TIP | 115},
+  // Back towards the middle.
+  {0x04000002, 0, BARGRAPH_CUE_TIP | 115},
+  {0x02000004, 0, 115},
+  {0x01000008, 0, 112},
+  {0x00800010, 0, BARGRAPH_CUE_TIP | 112},
+  {0x00400020, 0, BARGRAPH_CUE_TIP | 112},
+  {0x00200040, 0, 112},
+  {0x00100080, 0, 112},
+  {0x00080100, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00040200, 0, BARGRAPH_CUE_TIP | 110},
+  {0x00020400, 0, 110},
+  {0x00010800, 0, 110},
+  {0x00009000, 0, BARGRAPH_CUE_TIP | 110}
+};
+
+const BargraphKeyframe bargraphTrackSuperHero5[] PROGMEM = {
+  {0x00000011, 0, BARGRAPH_CUE_TIP | 110},
+  {0x0000000A, 0, 112},
+  {0x00000004, 0, BARGRAPH_CUE_TIP | 115},
+  {0x0000000A, 0, 112},
+  {0x00000011, 0, BARGRAPH_CUE_TIP | 110}
+};
+
+/*
+ * Ramp tracks for the bargraph sequencer: frame N has the bottom N segments lit, from empty to full.
+ * The start-up ramp, the ramp down when overheating or when the ribbon cable is removed, the idle animation and the
+ * Mode Original firing animation all move along these one frame at a time, in whichever direction they need.
+ * Each cue is the vibration added to i_vibration_level as the ramp climbs to that frame (0 leaves it as it is).
+ */
+const BargraphKeyframe bargraphTrackRamp30[] PROGMEM = {
+  {0x00000000, 0, 0},
+  {0x00000001, 0, 0},
+  {0x00000003, 0, 10},
+  {0x00000007, 0, 10},
+  {0x0000000F, 0, 10},
+  {0x0000001F, 0, 10},
+  {0x0000003F, 0, 10},
+  {0x0000007F, 0, 20},
+  {0x000000FF, 0, 20},
+  {0x000001FF, 0, 20},
+  {0x000003FF, 0, 20},
+  {0x000007FF, 0, 20},
+  {0x00000FFF, 0, 20},
+  {0x00001FFF, 0, 30},
+  {0x00003FFF, 0, 30},
+  {0x00007FFF, 0, 30},
+  {0x0000FFFF, 0, 30},
+  {0x0001FFFF, 0, 30},
+  {0x0003FFFF, 0, 30},
+  {0x0007FFFF, 0, 40},
+  {0x000FFFFF, 0, 40},
+  {0x001FFFFF, 0, 40},
+  {0x003FFFFF, 0, 40},
+  {0x007FFFFF, 0, 40},
+  {0x00FFFFFF, 0, 40},
+  {0x01FFFFFF, 0, 80},
+  {0x03FFFFFF, 0, 80},
+  {0x07FFFFFF, 0, 80},
+  {0x0FFFFFFF, 0, 80},
+  {0x1FFFFFFF, 0, 80},
+  {0x3FFFFFFF, 0, 80}
+};
+
+const BargraphKeyframe bargraphTrackRamp28[] PROGMEM = {
+  {0x00000000, 0, 0},
+  {0x00000001, 0, 0},
+  {0x00000003, 0, 10},
+  {0x00000007, 0, 10},
+  {0x0000000F, 0, 10},
+  {0x0000001F, 0, 10},
+  {0x0000003F, 0, 20},
+  {0x0000007F, 0, 20},
+  {0x000000FF, 0, 20},
+  {0x000001FF, 0, 20},
+  {0x000003FF, 0, 20},
+  {0x000007FF, 0, 20},
+  {0x00000FFF, 0, 20},
+  {0x00001FFF, 0, 30},
+  {0x00003FFF, 0, 30},
+  {0x00007FFF, 0, 30},
+  {0x0000FFFF, 0, 30},
+  {0x0001FFFF, 0, 30},
+  {0x0003FFFF, 0, 40},
+  {0x0007FFFF, 0, 40},
+  {0x000FFFFF, 0, 40},
+  {0x001FFFFF, 0, 40},
+  {0x003FFFFF, 0, 40},
+  {0x007FFFFF, 0, 40},
+  {0x00FFFFFF, 0, 80},
+  {0x01FFFFFF, 0, 80},
+  {0x03FFFFFF, 0, 80},
+  {0x07FFFFFF, 0, 80},
+  {0x0FFFFFFF, 0, 80}
+};
+
+const BargraphKeyframe bargraphTrackRamp5[] PROGMEM = {
+  {0x00000000, 0, 0},
+  {0x00000001, 0, 10},
+  {0x00000003, 0, 20},
+  {0x00000007, 0, 30},
+  {0x0000000F, 0, 40},
+  {0x0000001F, 0, 80}
+};
+
+/*
+ * Overheat blink tracks for the bargraph sequencer, used instead of the ramp down when the overheat blink is enabled.
+ * Five blocks of segments alternate with an empty bargraph, each frame held for half of i_settings_blink_delay.
+ */
+const BargraphKeyframe bargraphTrackOverheatBlink30[] PROGMEM = {
+  {0x1E79E79E, 0, 0},
+  {0x00000000, 0, 0}
+};
+
+const BargraphKeyframe bargraphTrackOverheatBlink28[] PROGMEM = {
+  {0x0E38E38E, 0, 0},
+  {0x00000000, 0, 0}
+};
+
+const BargraphKeyframe bargraphTrackOverheatBlink5[] PROGMEM = {
+  {0x0000001F, 0, 0},
+  {0x00000000, 0, 0}
+};
+
+/*
+ * Mode Original firing animation: the bargraph ramps towards a random frame, and on reaching it picks another.
+ * The range (lowest, highest + 1) of each pick depends on the power level and the cyclotron speed up stage (0-6),
+ * reaching further down as the wand nears an overheat. Level 5 on the 28/30 segment bargraphs is capped to the
+ * bargraph length. The 28/30 segment bargraphs only ever pick on the way down to a target; their ranges for moving
+ * up could never be reached and are not kept.
+ */
+const uint8_t i_bargraph_firing_range[i_power_level_max][7][2] PROGMEM = {
+  {{0, 7}, {0, 8}, {0, 8}, {0, 8}, {0, 9}, {0, 10}, {0, 7}},
+  {{0, 13}, {3, 13}, {3, 13}, {3, 13}, {2, 13}, {1, 13}, {0, 13}},
+  {{0, 19}, {9, 19}, {7, 19}, {5, 19}, {3, 19}, {1, 19}, {0, 19}},
+  {{0, 25}, {13, 25}, {10, 25}, {7, 25}, {4, 25}, {1, 25}, {0, 25}},
+  {{18, 30}, {18, 30}, {15, 30}, {12, 30}, {9, 30}, {6, 30}, {18, 30}}
+};
+
+// The 5 LED bargraph picks from the first set when it is full and can only move down, otherwise from the second.
+const uint8_t i_bargraph_firing_range_5_led[2][i_power_level_max][7][2] PROGMEM = {
+  {
+    {{0, 3}, {0, 3}, {0, 3}, {0, 5}, {0, 6}, {0, 6}, {0, 3}},
+    {{0, 3}, {0, 3}, {0, 6}, {0, 6}, {0, 6}, {0, 6}, {0, 3}},
+    {{1, 4}, {1, 4}, {1, 4}, {1, 6}, {1, 6}, {1, 6}, {1, 4}},
+    {{2, 6}, {2, 6}, {2, 6}, {1, 6}, {1, 6}, {1, 6}, {2, 6}},
+    {{2, 6}, {2, 6}, {2, 6}, {1, 6}, {1, 6}, {1, 6}, {2, 6}}
+  },
+  {
+    {{0, 3}, {0, 3}, {0, 3}, {0, 5}, {0, 6}, {0, 6}, {0, 3}},
+    {{0, 3}, {0, 3}, {0, 3}, {1, 6}, {0, 6}, {0, 6}, {0, 3}},
+    {{1, 4}, {1, 4}, {1, 4}, {1, 6}, {0, 6}, {0, 6}, {1, 4}},
+    {{2, 6}, {2, 6}, {2, 6}, {1, 6}, {0, 6}, {0, 6}, {2, 6}},
+    {{2, 6}, {2, 6}, {2, 6}, {1, 6}, {0, 6}, {0, 6}, {2, 6}}
+  }
+};
+
 /*
  * (Optional) Support for Video Game Accessories (coming soon)
  */
@@ -61,8 +61,11 @@
 #include "Configuration.h"
 #include "MusicSounds.h"
 #include "Communication.h"
+#include "BargraphDriver.h"
+#include "BargraphSequencer.h"
 #include "Header.h"
 #include "Colours.h"
+#include "AudioQueue.h"
 #include "Audio.h"
 #include "Preferences.h"
 
@@ -72,7 +75,7 @@ void setup() {
   Serial1.begin(9600); // Communication to the Proton Pack.
   wandComs.begin(Serial1, false);
 
-  // Setup the audio device for this controller.
+  // Start looking for the audio device for this controller; this carries on from the main loop.
   setupAudioDevice();
 
   // Change PWM frequency of pin 11 for the vibration motor, we do not want it high pitched.
@@ -228,13 +231,15 @@ void loop() {
         //digitalWriteFast(WAND_STATUS_LED_PIN, (digitalReadFast(WAND_STATUS_LED_PIN) == LOW) ? HIGH : LOW); // Blink the onboard LED on the Neutrona Wand board.
       }
 
+      updateAudio(); // Carry on looking for the audio device while waiting.
+
       checkPack(); // Check for any response from the pack while still waiting.
     break;
 
     case PACK_CONNECTED:
       // When connected to a pack, prepare to send a regular handshake to indicate presence.
       if(ms_handshake.justFinished()) {
-        wandSerialSend(W_HANDSHAKE); // Remind the pack that a wand is still present.
+        wandSerialSend(W_HANDSHAKE, i_link_capabilities); // Remind the pack that a wand is still present.
         ms_handshake.restart(); // Restart the handshake timer.
       }
 
@@ -255,6 +260,8 @@ void loop() {
       mainLoop(); // Continue on to the main loop.
     break;
   }
+
+  flushAudio(); // Send the sound effect commands queued during this loop.
 }
 
 void mainLoop() {
@@ -981,16 +988,9 @@ void startVentSequence() {
     ms_blink_sound_timer_2.start(i_blink_sound_timer_2);
   }
   else {
-    uint8_t i_segment_adjust = 2;
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      i_segment_adjust = 0;
-    }
-
-    // Reset some bargraph levels before we ramp the bargraph down.
-    i_bargraph_status_alt = i_bargraph_segments - i_segment_adjust; // For 28 and 30 segment bargraph
-    i_bargraph_status = i_bargraph_segments_5_led; // For Hasbro 5 LED bargraph.
-
-    bargraphFull();
+    // Start the ramp down from a full bargraph.
+    bargraphRampStart(bargraphRampFull());
+    b_bargraph_up = false;
 
     ms_bargraph.start(d_bargraph_ramp_interval);
   }
@@ -1451,10 +1451,9 @@ void checkSwitches() {
                   }
                 }
                 else {
-                  if(BARGRAPH_TYPE != SEGMENTS_5) {
-                    bargraphClearAlt();
-                  }
-                  else {
+                  bargraphClearAlt();
+
+                  if(BARGRAPH_TYPE == SEGMENTS_5) {
                     wandBargraphControl(0);
                   }
 
@@ -2713,11 +2712,11 @@ void soundBeepLoopStop() {
 
     if(switch_wand.on()) {
       // Set all beep looping to false so they stop naturally.
-      audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S1, false);
-      audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S2, false);
-      audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S3, false);
-      audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S4, false);
-      audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S5, false);
+      loopEffect(S_AFTERLIFE_BEEP_WAND_S1, false);
+      loopEffect(S_AFTERLIFE_BEEP_WAND_S2, false);
+      loopEffect(S_AFTERLIFE_BEEP_WAND_S3, false);
+      loopEffect(S_AFTERLIFE_BEEP_WAND_S4, false);
+      loopEffect(S_AFTERLIFE_BEEP_WAND_S5, false);
 
       if(b_extra_pack_sounds) {
         wandSerialSend(W_WAND_BEEP_STOP_LOOP);
@@ -4876,4345 +4875,1342 @@ void firePulseEffect() {
   }
 }
 
-void fireStreamEffect(CRGB c_colour) {
-  uint8_t i_firing_stream_tmp; // Stores a calculated value based on LED count.
+// Picks the barrel stream style for the current stream mode, year and cross-streams state.
+uint8_t getBarrelStreamStyle() {
+  switch(STREAM_MODE) {
+    case PROTON:
+    default:
+      if(b_firing_cross_streams == true) {
+        if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
+          return BARREL_CROSS_STREAMS_FE;
+        }
+        else {
+          return BARREL_CROSS_STREAMS;
+        }
+      }
+      else if(getSystemYearMode() == SYSTEM_1989) {
+        return BARREL_PROTON_1989;
+      }
+      else {
+        return BARREL_PROTON;
+      }
+    break;
 
-  switch(WAND_BARREL_LED_COUNT) {
-    case LEDS_50:
-      // GPStar Neutrona Barrel -> 48 LED + 2 Strobe Tips.
-      // This effect will "wrap" around the device to appear to push the stream forward.
+    case SLIME:
+      if(getSystemYearMode() == SYSTEM_1989) {
+        return BARREL_SLIME_1989;
+      }
+      else {
+        return BARREL_SLIME;
+      }
+    break;
 
-      i_firing_stream_tmp = i_firing_stream / 10; // 10ms
+    case STASIS:
+      return BARREL_STASIS;
+    break;
 
-      if(ms_firing_stream_effects.justFinished()) {
-        if(i_barrel_light - 1 >= 0 && i_barrel_light - 1 < i_num_barrel_leds) {
-          switch(STREAM_MODE) {
-            case PROTON:
-            default:
-              if(b_firing_cross_streams == true) {
-                if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
-                  barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_CHARTREUSE, WAND_BARREL_LED_COUNT);
-                  //barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 2])] = c_colour;
-                }
-                else {
-                  barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_WHITE, WAND_BARREL_LED_COUNT);
-                  //barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 2])] = c_colour;
-                }
-              }
-              else if(getSystemYearMode() == SYSTEM_1989) {
-                // Shift the stream from orange to red on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
+    case MESON:
+      return BARREL_MESON;
+    break;
 
-                  case 2:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
+    case SPECTRAL:
+    case HOLIDAY_HALLOWEEN:
+    case HOLIDAY_CHRISTMAS:
+      return BARREL_DARK;
+    break;
 
-                  case 3:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
+    case SPECTRAL_CUSTOM:
+      return BARREL_CUSTOM;
+    break;
+  }
+}
 
-                  case 4:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
+// Maps a position along the barrel (0 = base) to its LED.
+uint8_t barrelStreamLed(uint8_t i_position) {
+  switch(WAND_BARREL_LED_COUNT) {
+    case LEDS_50:
+      // GPStar Neutrona Barrel -> 48 LED + 2 Strobe Tips.
+      return PROGMEM_READU8(gpstar_neutrona_barrel[i_position]);
+    break;
 
-                  case 5:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
-              else {
-                // Shift the stream from red to orange on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
+    case LEDS_48:
+      // Frutto Technology -> 48 LED + Strobe Tip
+      return PROGMEM_READU8(frutto_barrel[i_position]);
+    break;
 
-                  case 2:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
+    case LEDS_5:
+    case LEDS_2:
+    default:
+      return i_position;
+    break;
+  }
+}
 
-                  case 3:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
+void fireStreamEffect(CRGB c_colour) {
+  if(!ms_firing_stream_effects.justFinished()) {
+    return;
+  }
 
-                  case 4:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
+  // On the 48/50 LED barrels this effect will "wrap" around the device to appear to push the stream forward.
+  bool b_long_barrel = (WAND_BARREL_LED_COUNT == LEDS_48 || WAND_BARREL_LED_COUNT == LEDS_50);
+  const BarrelStreamStyle &style = barrelStreamStyles[getBarrelStreamStyle()];
+  uint8_t i_level = (i_power_level >= i_power_level_min && i_power_level <= i_power_level_max) ? i_power_level - 1 : 0;
+  uint8_t i_flags = PROGMEM_READU8(style.i_flags);
 
-                  case 5:
-                    barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
-            break;
+  if(i_barrel_light - 1 >= 0 && i_barrel_light - 1 < i_num_barrel_leds) {
+    barrel_leds[barrelStreamLed(i_barrel_light - 1)] = getHueColour(PROGMEM_READU8(style.i_tail_colour[i_level]), WAND_BARREL_LED_COUNT);
+  }
 
-            case SLIME:
-              if(getSystemYearMode() == SYSTEM_1989) {
-                barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_PASTEL_PINK, WAND_BARREL_LED_COUNT);
-              }
-              else {
-                barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_DARK_GREEN, WAND_BARREL_LED_COUNT);
-              }
-            break;
+  if(i_barrel_light == i_num_barrel_leds) {
+    i_barrel_light = 0;
 
-            case STASIS:
-              barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_BLUE, WAND_BARREL_LED_COUNT);
-            break;
+    if((i_flags & BARREL_NO_RESTART) == 0) {
+      if(b_long_barrel) {
+        ms_firing_stream_effects.start((i_firing_stream / 10) - PROGMEM_READU8(i_barrel_restart_long[i_level]));
+      }
+      else {
+        ms_firing_stream_effects.start(i_firing_stream - PROGMEM_READU8(i_barrel_restart_short[i_level]));
+      }
+    }
+  }
+  else if(i_barrel_light < i_num_barrel_leds) {
+    barrel_leds[barrelStreamLed(i_barrel_light)] = c_colour;
 
-            case MESON:
-            case SPECTRAL:
-            case HOLIDAY_HALLOWEEN:
-            case HOLIDAY_CHRISTMAS:
-              barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
-            break;
+    if(b_long_barrel) {
+      uint8_t i_trail_divisor = PROGMEM_READU8(style.i_trail_divisor);
+      uint8_t i_trail = PROGMEM_READU8(style.i_trail_extra[i_level]);
 
-            case SPECTRAL_CUSTOM:
-              barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(C_CUSTOM, WAND_BARREL_LED_COUNT);
-            break;
-          }
+      if(i_trail_divisor > 0) {
+        i_trail = i_trail + random(0, i_num_barrel_leds / i_trail_divisor);
+      }
+
+      for(uint8_t i = i_barrel_light + 1; i < i_barrel_light + i_trail; i++) {
+        if(i < i_num_barrel_leds) {
+          barrel_leds[barrelStreamLed(i)] = c_colour;
         }
+      }
 
-        if(i_barrel_light == i_num_barrel_leds) {
-          i_barrel_light = 0;
+      if(i_flags & BARREL_SETS_LED_DELAY) {
+        i_fast_led_delay = FAST_LED_UPDATE_MS + PROGMEM_READU8(style.i_led_delay[i_level]);
+      }
 
-          uint8_t i_s_speed = 0;
+      if(STREAM_MODE == SLIME && WAND_ACTION_STATUS != ACTION_FIRING) {
+        // Slime Tether response time is a fixed value.
+        ms_firing_stream_effects.start((i_firing_stream / 25) - 3); // 1ms
 
-          switch(STREAM_MODE) {
-            case MESON:
-              // Do nothing; animation is restarted by checkWandAction();
-            break;
+        // Let Slime Tether turn on the barrel tip.
+        if(i_barrel_light + 4 == i_num_barrel_leds) {
+          wandTipOn();
+        }
+      }
+      else {
+        ms_firing_stream_effects.start((i_firing_stream / 25) + (int8_t)PROGMEM_READU8(style.i_head_delay[i_level]));
+      }
+    }
+    else {
+      ms_firing_stream_effects.start((i_firing_stream / 5) + PROGMEM_READU8(i_barrel_head_short[i_level]));
+    }
 
-            default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  i_s_speed = 5; // 5ms
-                break;
+    i_barrel_light++;
+  }
+}
 
-                case 2:
-                  i_s_speed = 6; // 4ms
-                break;
+void barrelLightsOff() {
+  ms_firing_pulse.stop();
+  ms_firing_lights.stop();
+  ms_firing_stream_effects.stop();
+  ms_firing_effect_end.stop();
+  ms_firing_lights_end.stop();
+  ms_wand_heatup_fade.stop();
+  i_barrel_light = 0;
+  i_pulse_step = 0;
+  i_heatup_counter = 0;
+  i_heatdown_counter = 100;
 
-                case 3:
-                  i_s_speed = 7; // 3ms
-                break;
+  // Turn off the barrel LEDs.
+  wandBarrelLightsOff();
 
-                case 4:
-                  i_s_speed = 8; // 2ms
-                break;
+  // Turn off the wand barrel tip LED.
+  wandTipOff();
+}
 
-                case 5:
-                  i_s_speed = 9; // 1ms
-                break;
-              }
-            break;
-          }
+void fireStreamStart(CRGB c_colour) {
+  if(ms_firing_lights.justFinished() && i_barrel_light < i_num_barrel_leds) {
+    switch(WAND_BARREL_LED_COUNT) {
+      case LEDS_50:
+        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light])] = c_colour;
 
-          if(STREAM_MODE != MESON) {
-            ms_firing_stream_effects.start(i_firing_stream_tmp - i_s_speed);
-          }
+        if(i_barrel_light + 2 < i_num_barrel_leds) {
+          barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light + 2])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
         }
-        else if(i_barrel_light < i_num_barrel_leds) {
-          barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light])] = c_colour;
+      break;
 
-          switch(STREAM_MODE) {
-            case MESON:
-              if(i_barrel_light + 1 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light + 1])] = c_colour;
-              }
+      case LEDS_48:
+        // Since this arrangement has many more LEDs available, we can make use of extra colour changes
+        // to enhance the stream effects. In this case we can darken the lead LED then follow with the
+        // primary colour for the stream chosen. Any other colour effects will follow this arrangement.
+        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light])] = c_colour;
 
-              if(i_barrel_light + 2 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light + 2])] = c_colour;
-              }
+        if(i_barrel_light + 2 < i_num_barrel_leds) {
+          barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light + 2])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
+        }
+      break;
 
-              if(i_barrel_light + 3 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light + 3])] = c_colour;
-              }
-            break;
+      case LEDS_5:
+      case LEDS_2:
+      default:
+        // Just set the current LED to the expected colour.
+        barrel_leds[i_barrel_light] = c_colour;
+      break;
+    }
 
-            case PROTON:
-            {
-              uint8_t i_t_rand = random(0, i_num_barrel_leds / 3); // from 0 to 15
+    switch(WAND_BARREL_LED_COUNT) {
+      case LEDS_48:
+      case LEDS_50:
+        // More LEDs means a faster firing rate.
+        ms_firing_lights.start(i_firing_stream / 30); // 3ms
+      break;
 
-              switch(i_power_level) {
-                case 5:
-                  i_t_rand = i_t_rand + 10;
-                break;
+      case LEDS_5:
+      case LEDS_2:
+      default:
+        // Firing at "normal" speed.
+        ms_firing_lights.start(i_firing_stream / 5); // 20ms
+      break;
+    }
 
-                case 4:
-                  i_t_rand = i_t_rand + 8;
-                break;
+    i_barrel_light++;
 
-                case 3:
-                  i_t_rand = i_t_rand + 6;
-                break;
+    if(i_barrel_light == i_num_barrel_leds) {
+      i_barrel_light = 0;
 
-                case 2:
-                  i_t_rand = i_t_rand + 3;
-                break;
+      ms_firing_lights.stop();
 
-                case 1:
-                default:
-                i_t_rand = i_t_rand + 2;
-                  // Nothing.
-                break;
-              }
+      switch(WAND_BARREL_LED_COUNT) {
+        case LEDS_48:
+        case LEDS_50:
+          // More LEDs means a faster firing rate.
+          ms_firing_stream_effects.start(i_firing_stream / 25); // 4ms
+        break;
 
-              for(uint8_t i = i_barrel_light + 1; i < i_barrel_light + i_t_rand; i++) {
-                if(i < i_num_barrel_leds) {
-                  barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i])] = c_colour;
-                }
-              }
-            }
-            break;
+        case LEDS_5:
+        default:
+          // Firing at "normal" speed.
+          ms_firing_stream_effects.start(i_firing_stream);
+        break;
+      }
+    }
+  }
+}
+
+void fireEffectEnd() {
+  // Initialize temporary colour variable to reduce code complexity.
+  colours c_temp = C_WHITE;
 
+  if(i_barrel_light < i_num_barrel_leds && ms_firing_stream_effects.isRunning()) {
+    switch(STREAM_MODE) {
+      case PROTON:
+      default:
+        if(b_firing_cross_streams == true) {
+          if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
+            c_temp = C_ORANGE;
+          }
+          else {
+            c_temp = C_YELLOW;
+          }
+        }
+        else if(getSystemYearMode() == SYSTEM_1989) {
+          // Shift the stream from orange to red on higher power levels.
+          switch(i_power_level) {
+            case 1:
             default:
-            {
-              uint8_t i_t_rand_def = random(0, i_num_barrel_leds / 4); // from 0 to 11
+              c_temp = C_LIGHT_BLUE;
+            break;
 
-              for(uint8_t i = i_barrel_light + 1; i < i_barrel_light + i_t_rand_def; i++) {
-                if(i < i_num_barrel_leds) {
-                  barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i])] = c_colour;
-                }
-              }
-            }
+            case 2:
+              c_temp = C_MID_BLUE;
             break;
-          }
 
-          switch(STREAM_MODE) {
-            case MESON:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS; // 3ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
-
-                case 2:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS; // 3ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 3:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 1; // 4ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 4:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 3; // 6ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 5:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 4; // 7ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                break;
-              }
+            case 3:
+              c_temp = C_MID_BLUE;
             break;
 
-            case PROTON:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 4); // 8ms
-                break;
-
-                case 2:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 3); // 7ms
-                break;
-
-                case 3:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                break;
-
-                case 4:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                break;
-
-                case 5:
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
-              }
+            case 4:
+              c_temp = C_BLUE;
             break;
 
-            case SLIME:
-              if(WAND_ACTION_STATUS == ACTION_FIRING) {
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                  break;
-
-                  case 2:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                  break;
-
-                  case 3:
-                    ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                  break;
-
-                  case 4:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                  break;
-
-                  case 5:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                  break;
-                }
-              }
-              else {
-                // Slime Tether response time is a fixed value.
-                ms_firing_stream_effects.start((i_firing_stream / 25) - 3); // 1ms
-
-                // Let Slime Tether turn on the barrel tip.
-                if(i_barrel_light + 4 == i_num_barrel_leds) {
-                  wandTipOn();
-                }
-              }
+            case 5:
+              c_temp = C_BLUE;
             break;
-
+          }
+        }
+        else {
+          // Shift the stream from red to orange on higher power levels.
+          switch(i_power_level) {
+            case 1:
             default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                break;
+              c_temp = C_BLUE;
+            break;
 
-                case 2:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                break;
+            case 2:
+              c_temp = C_BLUE;
+            break;
 
-                case 3:
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
+            case 3:
+              c_temp = C_LIGHT_BLUE;
+            break;
 
-                case 4:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
+            case 4:
+              c_temp = C_LIGHT_BLUE;
+            break;
 
-                case 5:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                break;
-              }
+            case 5:
+              c_temp = C_WHITE;
             break;
           }
-
-          i_barrel_light++;
         }
-      }
-    break;
+      break;
 
-    case LEDS_48:
-      // GPStar Neutrona Barrel -> 48 LED + 2 Strobe Tips.
-      // Frutto Technology -> 48 LED + Strobe Tip
-      // This effect will "wrap" around the device to appear to push the stream forward.
+      case SLIME:
+        if(getSystemYearMode() == SYSTEM_1989) {
+          c_temp = C_WHITE;
+        }
+        else {
+          c_temp = C_GREEN;
+        }
+      break;
 
-      i_firing_stream_tmp = i_firing_stream / 10; // 10ms
+      case STASIS:
+        c_temp = C_NAVY_BLUE;
+      break;
 
-      if(ms_firing_stream_effects.justFinished()) {
-        if(i_barrel_light - 1 >= 0 && i_barrel_light - 1 < i_num_barrel_leds) {
-          switch(STREAM_MODE) {
-            case PROTON:
-            default:
-              if(b_firing_cross_streams == true) {
-                if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
-                  barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_CHARTREUSE, WAND_BARREL_LED_COUNT);
-                  //barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 2])] = c_colour;
-                }
-                else {
-                  barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_WHITE, WAND_BARREL_LED_COUNT);
-                  //barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 2])] = c_colour;
-                }
-              }
-              else if(getSystemYearMode() == SYSTEM_1989) {
-                // Shift the stream from orange to red on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
+      case MESON:
+        c_temp = C_YELLOW;
+      break;
 
-                  case 2:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
+      case SPECTRAL:
+        c_temp = C_RAINBOW;
+      break;
 
-                  case 3:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
+      case HOLIDAY_HALLOWEEN:
+        c_temp = C_ORANGEPURPLE;
+      break;
 
-                  case 4:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
+      case HOLIDAY_CHRISTMAS:
+        c_temp = C_REDGREEN;
+      break;
 
-                  case 5:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
-              else {
-                // Shift the stream from red to orange on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
+      case SPECTRAL_CUSTOM:
+        if(i_spectral_wand_custom_saturation < 254) {
+          c_temp = C_BLUE;
+        }
+        else {
+          c_temp = C_WHITE;
+        }
+      break;
+    }
 
-                  case 2:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
+    fireStreamEffect(getHueColour(c_temp, WAND_BARREL_LED_COUNT));
 
-                  case 3:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
+    if(i_barrel_light < i_num_barrel_leds) {
+      ms_firing_effect_end.repeat();
+    }
+    else {
+      // Give a slight delay for the final pixel before clearing it.
+      uint8_t i_firing_stream_tmp; // Stores a calculated value based on LED count.
 
-                  case 4:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
+      uint8_t i_s_speed = 0; // Stores an additional value used for the 48-LED barrel.
 
-                  case 5:
-                    barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
+      switch(STREAM_MODE) {
+        case MESON:
+          switch(i_power_level) {
+            case 1:
+            default:
+              i_s_speed = 8;
             break;
 
-            case SLIME:
-              if(getSystemYearMode() == SYSTEM_1989) {
-                barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_PASTEL_PINK, WAND_BARREL_LED_COUNT);
-              }
-              else {
-                barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_DARK_GREEN, WAND_BARREL_LED_COUNT);
-              }
+            case 2:
+              i_s_speed = 8;
             break;
 
-            case STASIS:
-              barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_BLUE, WAND_BARREL_LED_COUNT);
+            case 3:
+              i_s_speed = 8;
             break;
 
-            case MESON:
-            case SPECTRAL:
-            case HOLIDAY_HALLOWEEN:
-            case HOLIDAY_CHRISTMAS:
-              barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
+            case 4:
+              i_s_speed = 8;
             break;
 
-            case SPECTRAL_CUSTOM:
-              barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(C_CUSTOM, WAND_BARREL_LED_COUNT);
+            case 5:
+              i_s_speed = 9;
             break;
           }
-        }
-
-        if(i_barrel_light == i_num_barrel_leds) {
-          i_barrel_light = 0;
-
-          uint8_t i_s_speed = 0;
-
-          switch(STREAM_MODE) {
-            case MESON:
-              // Do nothing; animation is restarted by checkWandAction();
-            break;
+        break;
 
+        default:
+          switch(i_power_level) {
+            case 1:
             default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  i_s_speed = 5; // 5ms
-                break;
-
-                case 2:
-                  i_s_speed = 6; // 4ms
-                break;
+              i_s_speed = 5;
+            break;
 
-                case 3:
-                  i_s_speed = 7; // 3ms
-                break;
+            case 2:
+              i_s_speed = 6;
+            break;
 
-                case 4:
-                  i_s_speed = 8; // 2ms
-                break;
+            case 3:
+              i_s_speed = 7;
+            break;
 
-                case 5:
-                  i_s_speed = 9; // 1ms
-                break;
-              }
+            case 4:
+              i_s_speed = 8;
             break;
-          }
 
-          if(STREAM_MODE != MESON) {
-            ms_firing_stream_effects.start(i_firing_stream_tmp - i_s_speed);
+            case 5:
+              i_s_speed = 9;
+            break;
           }
-        }
-        else if(i_barrel_light < i_num_barrel_leds) {
-          barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light])] = c_colour;
+        break;
+      }
 
-          switch(STREAM_MODE) {
-            case MESON:
-              if(i_barrel_light + 1 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light + 1])] = c_colour;
-              }
+      switch(WAND_BARREL_LED_COUNT) {
+        case LEDS_48:
+        case LEDS_50:
+          // More LEDs means a faster firing rate.
+          i_firing_stream_tmp = i_firing_stream / 10; // 10ms
+          i_firing_stream_tmp = i_firing_stream_tmp - i_s_speed;
+        break;
 
-              if(i_barrel_light + 2 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light + 2])] = c_colour;
-              }
+        case LEDS_5:
+        default:
+          // Firing at "normal" speed.
+          i_firing_stream_tmp = i_firing_stream;
 
-              if(i_barrel_light + 3 < i_num_barrel_leds) {
-                barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light + 3])] = c_colour;
-              }
+          switch(i_power_level) {
+            case 1:
+            default:
+              // Do nothing.
             break;
 
-            case PROTON:
-            {
-              uint8_t i_t_rand = random(0, i_num_barrel_leds / 3); // from 0 to 15
-
-              switch(i_power_level) {
-                case 5:
-                  i_t_rand = i_t_rand + 10;
-                break;
-
-                case 4:
-                  i_t_rand = i_t_rand + 8;
-                break;
-
-                case 3:
-                  i_t_rand = i_t_rand + 6;
-                break;
-
-                case 2:
-                  i_t_rand = i_t_rand + 3;
-                break;
-
-                case 1:
-                default:
-                i_t_rand = i_t_rand + 2;
-                  // Nothing.
-                break;
-              }
+            case 2:
+              i_firing_stream_tmp = i_firing_stream_tmp - 15;
+            break;
 
-              for(uint8_t i = i_barrel_light + 1; i < i_barrel_light + i_t_rand; i++) {
-                if(i < i_num_barrel_leds) {
-                  barrel_leds[PROGMEM_READU8(frutto_barrel[i])] = c_colour;
-                }
-              }
-            }
+            case 3:
+              i_firing_stream_tmp = i_firing_stream_tmp - 30;
             break;
 
-            default:
-            {
-              uint8_t i_t_rand_def = random(0, i_num_barrel_leds / 4); // from 0 to 11
+            case 4:
+              i_firing_stream_tmp = i_firing_stream_tmp - 45;
+            break;
 
-              for(uint8_t i = i_barrel_light + 1; i < i_barrel_light + i_t_rand_def; i++) {
-                if(i < i_num_barrel_leds) {
-                  barrel_leds[PROGMEM_READU8(frutto_barrel[i])] = c_colour;
-                }
-              }
-            }
-            break;
-          }
-
-          switch(STREAM_MODE) {
-            case MESON:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS; // 3ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
-
-                case 2:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS; // 3ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 3:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 1; // 4ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 4:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 3; // 6ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 5:
-                  i_fast_led_delay = FAST_LED_UPDATE_MS + 4; // 7ms
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                break;
-              }
-            break;
-
-            case PROTON:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 4); // 8ms
-                break;
-
-                case 2:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 3); // 7ms
-                break;
-
-                case 3:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                break;
-
-                case 4:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                break;
-
-                case 5:
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
-              }
-            break;
-
-            case SLIME:
-              if(WAND_ACTION_STATUS == ACTION_FIRING) {
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                  break;
-
-                  case 2:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                  break;
-
-                  case 3:
-                    ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                  break;
-
-                  case 4:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                  break;
-
-                  case 5:
-                    ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                  break;
-                }
-              }
-              else {
-                // Slime Tether response time is a fixed value.
-                ms_firing_stream_effects.start((i_firing_stream / 25) - 3); // 1ms
-
-                // Let Slime Tether turn on the barrel tip.
-                if(i_barrel_light + 4 == i_num_barrel_leds) {
-                  wandTipOn();
-                }
-              }
-            break;
-
-            default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 2); // 6ms
-                break;
-
-                case 2:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) + 1); // 5ms
-                break;
-
-                case 3:
-                  ms_firing_stream_effects.start((i_firing_stream / 25)); // 4ms
-                break;
-
-                case 4:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 1); // 3ms
-                break;
-
-                case 5:
-                  ms_firing_stream_effects.start((i_firing_stream / 25) - 2); // 2ms
-                break;
-              }
-            break;
-          }
-
-          i_barrel_light++;
-        }
-      }
-    break;
-
-    case LEDS_5:
-    case LEDS_2:
-    default:
-      i_firing_stream_tmp = i_firing_stream;
-
-      if(ms_firing_stream_effects.justFinished()) {
-        if(i_barrel_light - 1 >= 0 && i_barrel_light - 1 < i_num_barrel_leds) {
-          switch(STREAM_MODE) {
-            case PROTON:
-            default:
-              if(b_firing_cross_streams == true) {
-                if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
-                  barrel_leds[i_barrel_light - 1] = getHueColour(C_CHARTREUSE, WAND_BARREL_LED_COUNT);
-                }
-                else {
-                  barrel_leds[i_barrel_light - 1] = getHueColour(C_WHITE, WAND_BARREL_LED_COUNT);
-                }
-              }
-              else if(getSystemYearMode() == SYSTEM_1989) {
-                // Shift the stream from orange to red on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 2:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 3:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 4:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 5:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
-              else {
-                // Shift the stream from red to orange on higher power levels.
-                switch(i_power_level) {
-                  case 1:
-                  default:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 2:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED2, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 3:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED3, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 4:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED4, WAND_BARREL_LED_COUNT);
-                  break;
-
-                  case 5:
-                    barrel_leds[i_barrel_light - 1] = getHueColour(C_RED5, WAND_BARREL_LED_COUNT);
-                  break;
-                }
-              }
-            break;
-
-            case SLIME:
-              if(getSystemYearMode() == SYSTEM_1989) {
-                barrel_leds[i_barrel_light - 1] = getHueColour(C_PASTEL_PINK, WAND_BARREL_LED_COUNT);
-              }
-              else {
-                barrel_leds[i_barrel_light - 1] = getHueColour(C_DARK_GREEN, WAND_BARREL_LED_COUNT);
-              }
-            break;
-
-            case STASIS:
-              barrel_leds[i_barrel_light - 1] = getHueColour(C_BLUE, WAND_BARREL_LED_COUNT);
-            break;
-
-            case MESON:
-            case SPECTRAL:
-            case HOLIDAY_HALLOWEEN:
-            case HOLIDAY_CHRISTMAS:
-              barrel_leds[i_barrel_light - 1] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
-            break;
-
-            case SPECTRAL_CUSTOM:
-              barrel_leds[i_barrel_light - 1] = getHueColour(C_CUSTOM, WAND_BARREL_LED_COUNT);
-            break;
-          }
-        }
-
-        if(i_barrel_light == i_num_barrel_leds) {
-          i_barrel_light = 0;
-
-          switch(STREAM_MODE) {
-            case MESON:
-              // Do nothing; animation is restarted by checkWandAction();
-            break;
-
-            default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start(i_firing_stream_tmp); // 100ms
-                break;
-
-                case 2:
-                  ms_firing_stream_effects.start(i_firing_stream_tmp - 15); // 85ms
-                break;
-
-                case 3:
-                  ms_firing_stream_effects.start(i_firing_stream_tmp - 30); // 70ms
-                break;
-
-                case 4:
-                  ms_firing_stream_effects.start(i_firing_stream_tmp - 45); // 55ms
-                break;
-
-                case 5:
-                  ms_firing_stream_effects.start(i_firing_stream_tmp - 60); // 40ms
-                break;
-              }
-            break;
-          }
-        }
-        else if(i_barrel_light < i_num_barrel_leds) {
-          barrel_leds[i_barrel_light] = c_colour;
-
-          switch(STREAM_MODE) {
-            default:
-              switch(i_power_level) {
-                case 1:
-                default:
-                  ms_firing_stream_effects.start((i_firing_stream / 5) + 10); // 30ms
-                break;
-
-                case 2:
-                  ms_firing_stream_effects.start((i_firing_stream / 5) + 8); // 28ms
-                break;
-
-                case 3:
-                  ms_firing_stream_effects.start((i_firing_stream / 5) + 6); // 26ms
-                break;
-
-                case 4:
-                  ms_firing_stream_effects.start((i_firing_stream / 5) + 5); // 25ms
-                break;
-
-                case 5:
-                  ms_firing_stream_effects.start((i_firing_stream / 5) + 4); // 24ms
-                break;
-              }
-            break;
-          }
-
-          i_barrel_light++;
-        }
-      }
-    break;
-  }
-}
-
-void barrelLightsOff() {
-  ms_firing_pulse.stop();
-  ms_firing_lights.stop();
-  ms_firing_stream_effects.stop();
-  ms_firing_effect_end.stop();
-  ms_firing_lights_end.stop();
-  ms_wand_heatup_fade.stop();
-  i_barrel_light = 0;
-  i_pulse_step = 0;
-  i_heatup_counter = 0;
-  i_heatdown_counter = 100;
-
-  // Turn off the barrel LEDs.
-  wandBarrelLightsOff();
-
-  // Turn off the wand barrel tip LED.
-  wandTipOff();
-}
-
-void fireStreamStart(CRGB c_colour) {
-  if(ms_firing_lights.justFinished() && i_barrel_light < i_num_barrel_leds) {
-    switch(WAND_BARREL_LED_COUNT) {
-      case LEDS_50:
-        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light])] = c_colour;
-
-        if(i_barrel_light + 2 < i_num_barrel_leds) {
-          barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light + 2])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
-        }
-      break;
-
-      case LEDS_48:
-        // Since this arrangement has many more LEDs available, we can make use of extra colour changes
-        // to enhance the stream effects. In this case we can darken the lead LED then follow with the
-        // primary colour for the stream chosen. Any other colour effects will follow this arrangement.
-        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light])] = c_colour;
-
-        if(i_barrel_light + 2 < i_num_barrel_leds) {
-          barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light + 2])] = getHueColour(C_BLACK, WAND_BARREL_LED_COUNT);
-        }
-      break;
-
-      case LEDS_5:
-      case LEDS_2:
-      default:
-        // Just set the current LED to the expected colour.
-        barrel_leds[i_barrel_light] = c_colour;
-      break;
-    }
-
-    switch(WAND_BARREL_LED_COUNT) {
-      case LEDS_48:
-      case LEDS_50:
-        // More LEDs means a faster firing rate.
-        ms_firing_lights.start(i_firing_stream / 30); // 3ms
-      break;
-
-      case LEDS_5:
-      case LEDS_2:
-      default:
-        // Firing at "normal" speed.
-        ms_firing_lights.start(i_firing_stream / 5); // 20ms
-      break;
-    }
-
-    i_barrel_light++;
-
-    if(i_barrel_light == i_num_barrel_leds) {
-      i_barrel_light = 0;
-
-      ms_firing_lights.stop();
-
-      switch(WAND_BARREL_LED_COUNT) {
-        case LEDS_48:
-        case LEDS_50:
-          // More LEDs means a faster firing rate.
-          ms_firing_stream_effects.start(i_firing_stream / 25); // 4ms
-        break;
-
-        case LEDS_5:
-        default:
-          // Firing at "normal" speed.
-          ms_firing_stream_effects.start(i_firing_stream);
-        break;
-      }
-    }
-  }
-}
-
-void fireEffectEnd() {
-  // Initialize temporary colour variable to reduce code complexity.
-  colours c_temp = C_WHITE;
-
-  if(i_barrel_light < i_num_barrel_leds && ms_firing_stream_effects.isRunning()) {
-    switch(STREAM_MODE) {
-      case PROTON:
-      default:
-        if(b_firing_cross_streams == true) {
-          if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
-            c_temp = C_ORANGE;
-          }
-          else {
-            c_temp = C_YELLOW;
-          }
-        }
-        else if(getSystemYearMode() == SYSTEM_1989) {
-          // Shift the stream from orange to red on higher power levels.
-          switch(i_power_level) {
-            case 1:
-            default:
-              c_temp = C_LIGHT_BLUE;
-            break;
-
-            case 2:
-              c_temp = C_MID_BLUE;
-            break;
-
-            case 3:
-              c_temp = C_MID_BLUE;
-            break;
-
-            case 4:
-              c_temp = C_BLUE;
-            break;
-
-            case 5:
-              c_temp = C_BLUE;
-            break;
-          }
-        }
-        else {
-          // Shift the stream from red to orange on higher power levels.
-          switch(i_power_level) {
-            case 1:
-            default:
-              c_temp = C_BLUE;
-            break;
-
-            case 2:
-              c_temp = C_BLUE;
-            break;
-
-            case 3:
-              c_temp = C_LIGHT_BLUE;
-            break;
-
-            case 4:
-              c_temp = C_LIGHT_BLUE;
-            break;
-
-            case 5:
-              c_temp = C_WHITE;
-            break;
-          }
-        }
-      break;
-
-      case SLIME:
-        if(getSystemYearMode() == SYSTEM_1989) {
-          c_temp = C_WHITE;
-        }
-        else {
-          c_temp = C_GREEN;
-        }
-      break;
-
-      case STASIS:
-        c_temp = C_NAVY_BLUE;
-      break;
-
-      case MESON:
-        c_temp = C_YELLOW;
-      break;
-
-      case SPECTRAL:
-        c_temp = C_RAINBOW;
-      break;
-
-      case HOLIDAY_HALLOWEEN:
-        c_temp = C_ORANGEPURPLE;
-      break;
-
-      case HOLIDAY_CHRISTMAS:
-        c_temp = C_REDGREEN;
-      break;
-
-      case SPECTRAL_CUSTOM:
-        if(i_spectral_wand_custom_saturation < 254) {
-          c_temp = C_BLUE;
-        }
-        else {
-          c_temp = C_WHITE;
-        }
-      break;
-    }
-
-    fireStreamEffect(getHueColour(c_temp, WAND_BARREL_LED_COUNT));
-
-    if(i_barrel_light < i_num_barrel_leds) {
-      ms_firing_effect_end.repeat();
-    }
-    else {
-      // Give a slight delay for the final pixel before clearing it.
-      uint8_t i_firing_stream_tmp; // Stores a calculated value based on LED count.
-
-      uint8_t i_s_speed = 0; // Stores an additional value used for the 48-LED barrel.
-
-      switch(STREAM_MODE) {
-        case MESON:
-          switch(i_power_level) {
-            case 1:
-            default:
-              i_s_speed = 8;
-            break;
-
-            case 2:
-              i_s_speed = 8;
-            break;
-
-            case 3:
-              i_s_speed = 8;
-            break;
-
-            case 4:
-              i_s_speed = 8;
-            break;
-
-            case 5:
-              i_s_speed = 9;
-            break;
-          }
-        break;
-
-        default:
-          switch(i_power_level) {
-            case 1:
-            default:
-              i_s_speed = 5;
-            break;
-
-            case 2:
-              i_s_speed = 6;
-            break;
-
-            case 3:
-              i_s_speed = 7;
-            break;
-
-            case 4:
-              i_s_speed = 8;
-            break;
-
-            case 5:
-              i_s_speed = 9;
-            break;
-          }
-        break;
-      }
-
-      switch(WAND_BARREL_LED_COUNT) {
-        case LEDS_48:
-        case LEDS_50:
-          // More LEDs means a faster firing rate.
-          i_firing_stream_tmp = i_firing_stream / 10; // 10ms
-          i_firing_stream_tmp = i_firing_stream_tmp - i_s_speed;
-        break;
-
-        case LEDS_5:
-        default:
-          // Firing at "normal" speed.
-          i_firing_stream_tmp = i_firing_stream;
-
-          switch(i_power_level) {
-            case 1:
-            default:
-              // Do nothing.
-            break;
-
-            case 2:
-              i_firing_stream_tmp = i_firing_stream_tmp - 15;
-            break;
-
-            case 3:
-              i_firing_stream_tmp = i_firing_stream_tmp - 30;
-            break;
-
-            case 4:
-              i_firing_stream_tmp = i_firing_stream_tmp - 45;
-            break;
-
-            case 5:
-              i_firing_stream_tmp = i_firing_stream_tmp - 60;
-            break;
-          }
-        break;
-      }
-
-      ms_firing_effect_end.start(i_firing_stream_tmp);
-      ms_firing_stream_effects.stop();
-    }
-  }
-  else {
-    switch(STREAM_MODE) {
-      case PROTON:
-      default:
-        if(b_firing_cross_streams == true) {
-          if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
-            c_temp = C_CHARTREUSE;
-          }
-          else {
-            c_temp = C_WHITE;
-          }
-        }
-        else if(getSystemYearMode() == SYSTEM_1989) {
-          // Shift the stream from orange to red on higher power levels.
-          switch(i_power_level) {
-            case 1:
-            default:
-              c_temp = C_RED5;
-            break;
-
-            case 2:
-              c_temp = C_RED4;
-            break;
-
-            case 3:
-              c_temp = C_RED3;
-            break;
-
-            case 4:
-              c_temp = C_RED2;
-            break;
-
-            case 5:
-              c_temp = C_RED;
-            break;
-          }
-        }
-        else {
-          // Shift the stream from red to orange on higher power levels.
-          switch(i_power_level) {
-            case 1:
-            default:
-              c_temp = C_RED;
-            break;
-
-            case 2:
-              c_temp = C_RED2;
-            break;
-
-            case 3:
-              c_temp = C_RED3;
-            break;
-
-            case 4:
-              c_temp = C_RED4;
-            break;
-
-            case 5:
-              c_temp = C_RED5;
-            break;
-          }
-        }
-      break;
-
-      case SLIME:
-        if(getSystemYearMode() == SYSTEM_1989) {
-          c_temp = C_PASTEL_PINK;
-        }
-        else {
-          c_temp = C_DARK_GREEN;
-        }
-      break;
-
-      case STASIS:
-        c_temp = C_BLUE;
-      break;
-
-      case MESON:
-      case SPECTRAL:
-      case HOLIDAY_HALLOWEEN:
-      case HOLIDAY_CHRISTMAS:
-        c_temp = C_BLACK;
-      break;
-
-      case SPECTRAL_CUSTOM:
-        c_temp = C_CUSTOM;
-      break;
-    }
-
-    switch(WAND_BARREL_LED_COUNT) {
-      case LEDS_50:
-        // Set the final LED back to whatever colour it is without the effect.
-        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
-      break;
-
-      case LEDS_48:
-        // Set the final LED back to whatever colour it is without the effect.
-        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
-      break;
-
-      case LEDS_5:
-      case LEDS_2:
-      default:
-        // Set the final LED back to whatever colour it is without the effect.
-        barrel_leds[i_barrel_light - 1] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
-      break;
-    }
-
-    i_barrel_light = 0;
-    ms_firing_effect_end.stop();
-    ms_firing_lights_end.start(0);
-  }
-}
-
-void fireStreamEnd(CRGB c_colour) {
-  if(i_barrel_light < i_num_barrel_leds) {
-    switch(WAND_BARREL_LED_COUNT) {
-      case LEDS_50:
-        // Set the colour for the mapped LED.
-        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light])] = c_colour;
-
-        // More LEDs means a faster firing rate.
-        ms_firing_lights_end.start(i_firing_stream / 25); // 4ms
-      break;
-
-      case LEDS_48:
-        // Set the colour for the mapped LED.
-        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light])] = c_colour;
-
-        // More LEDs means a faster firing rate.
-        ms_firing_lights_end.start(i_firing_stream / 25); // 4ms
-      break;
-
-      case LEDS_5:
-      case LEDS_2:
-      default:
-        // Set the colour for the specific LED.
-        barrel_leds[i_barrel_light] = c_colour;
-
-        // Firing at a "normal" rate
-        ms_firing_lights_end.start(i_firing_stream / 5); // 20ms
-      break;
-    }
-
-    i_barrel_light++;
-
-    if(i_barrel_light == i_num_barrel_leds) {
-      i_barrel_light = 0;
-
-      if(WAND_BARREL_LED_COUNT != LEDS_5) {
-        // Turn off wand tip in case it's still on.
-        wandTipOff();
-      }
-
-      ms_firing_lights_end.stop();
-
-      i_fast_led_delay = FAST_LED_UPDATE_MS;
-    }
-  }
-}
-
-// This is the Super Hero bargraph firing animation. Ramping up and down from the middle to the top/bottom and back to the middle again.
-void bargraphSuperHeroRampFiringAnimation() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      switch(i_bargraph_status_alt) {
-        case 0:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(14));
-          ht_bargraph.setLed(bargraphLookupTable(15));
-
-          b_bargraph_status[14] = true;
-          b_bargraph_status[15] = true;
-
-          i_bargraph_status_alt++;
-
-          if(b_bargraph_up == false) {
-            ht_bargraph.clearLed(bargraphLookupTable(13));
-            ht_bargraph.clearLed(bargraphLookupTable(16));
-
-            b_bargraph_status[13] = false;
-            b_bargraph_status[16] = false;
-          }
-
-          b_bargraph_up = true;
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 1:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(13));
-          ht_bargraph.setLed(bargraphLookupTable(16));
-
-          b_bargraph_status[13] = true;
-          b_bargraph_status[16] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(14));
-            ht_bargraph.clearLed(bargraphLookupTable(15));
-
-            b_bargraph_status[14] = false;
-            b_bargraph_status[15] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(12));
-            ht_bargraph.clearLed(bargraphLookupTable(17));
-
-            b_bargraph_status[12] = false;
-            b_bargraph_status[17] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 2:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(12));
-          ht_bargraph.setLed(bargraphLookupTable(17));
-
-          b_bargraph_status[12] = true;
-          b_bargraph_status[17] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(13));
-            ht_bargraph.clearLed(bargraphLookupTable(16));
-
-            b_bargraph_status[13] = false;
-            b_bargraph_status[16] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(11));
-            ht_bargraph.clearLed(bargraphLookupTable(18));
-
-            b_bargraph_status[11] = false;
-            b_bargraph_status[18] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 3:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(11));
-          ht_bargraph.setLed(bargraphLookupTable(18));
-
-          b_bargraph_status[11] = true;
-          b_bargraph_status[18] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(12));
-            ht_bargraph.clearLed(bargraphLookupTable(17));
-
-            b_bargraph_status[12] = false;
-            b_bargraph_status[17] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(10));
-            ht_bargraph.clearLed(bargraphLookupTable(19));
-
-            b_bargraph_status[10] = false;
-            b_bargraph_status[19] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 4:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(10));
-          ht_bargraph.setLed(bargraphLookupTable(19));
-
-          b_bargraph_status[10] = true;
-          b_bargraph_status[19] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(11));
-            ht_bargraph.clearLed(bargraphLookupTable(18));
-
-            b_bargraph_status[11] = false;
-            b_bargraph_status[18] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(9));
-            ht_bargraph.clearLed(bargraphLookupTable(20));
-
-            b_bargraph_status[9] = false;
-            b_bargraph_status[20] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 5:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(9));
-          ht_bargraph.setLed(bargraphLookupTable(20));
-
-          b_bargraph_status[9] = true;
-          b_bargraph_status[20] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(10));
-            ht_bargraph.clearLed(bargraphLookupTable(19));
-
-            b_bargraph_status[10] = false;
-            b_bargraph_status[19] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(8));
-            ht_bargraph.clearLed(bargraphLookupTable(21));
-
-            b_bargraph_status[8] = false;
-            b_bargraph_status[21] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 6:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(8));
-          ht_bargraph.setLed(bargraphLookupTable(21));
-
-          b_bargraph_status[8] = true;
-          b_bargraph_status[21] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(9));
-            ht_bargraph.clearLed(bargraphLookupTable(20));
-
-            b_bargraph_status[9] = false;
-            b_bargraph_status[20] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(7));
-            ht_bargraph.clearLed(bargraphLookupTable(22));
-
-            b_bargraph_status[7] = false;
-            b_bargraph_status[22] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 7:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(7));
-          ht_bargraph.setLed(bargraphLookupTable(22));
-
-          b_bargraph_status[7] = true;
-          b_bargraph_status[22] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(8));
-            ht_bargraph.clearLed(bargraphLookupTable(21));
-
-            b_bargraph_status[8] = false;
-            b_bargraph_status[21] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(6));
-            ht_bargraph.clearLed(bargraphLookupTable(23));
-
-            b_bargraph_status[6] = false;
-            b_bargraph_status[23] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 8:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(6));
-          ht_bargraph.setLed(bargraphLookupTable(23));
-
-          b_bargraph_status[6] = true;
-          b_bargraph_status[23] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(7));
-            ht_bargraph.clearLed(bargraphLookupTable(22));
-
-            b_bargraph_status[7] = false;
-            b_bargraph_status[22] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(5));
-            ht_bargraph.clearLed(bargraphLookupTable(24));
-
-            b_bargraph_status[5] = false;
-            b_bargraph_status[24] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 9:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(5));
-          ht_bargraph.setLed(bargraphLookupTable(24));
-
-          b_bargraph_status[5] = true;
-          b_bargraph_status[24] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(6));
-            ht_bargraph.clearLed(bargraphLookupTable(23));
-
-            b_bargraph_status[6] = false;
-            b_bargraph_status[23] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(4));
-            ht_bargraph.clearLed(bargraphLookupTable(25));
-
-            b_bargraph_status[4] = false;
-            b_bargraph_status[25] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 10:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(4));
-          ht_bargraph.setLed(bargraphLookupTable(25));
-
-          b_bargraph_status[4] = true;
-          b_bargraph_status[25] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(5));
-            ht_bargraph.clearLed(bargraphLookupTable(24));
-
-            b_bargraph_status[5] = false;
-            b_bargraph_status[24] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(3));
-            ht_bargraph.clearLed(bargraphLookupTable(26));
-
-            b_bargraph_status[3] = false;
-            b_bargraph_status[26] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 11:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(3));
-          ht_bargraph.setLed(bargraphLookupTable(26));
-
-          b_bargraph_status[3] = true;
-          b_bargraph_status[26] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(4));
-            ht_bargraph.clearLed(bargraphLookupTable(25));
-
-            b_bargraph_status[4] = false;
-            b_bargraph_status[25] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(2));
-            ht_bargraph.clearLed(bargraphLookupTable(27));
-
-            b_bargraph_status[2] = false;
-            b_bargraph_status[27] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 12:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(2));
-          ht_bargraph.setLed(bargraphLookupTable(27));
-
-          b_bargraph_status[2] = false;
-          b_bargraph_status[27] = false;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(3));
-            ht_bargraph.clearLed(bargraphLookupTable(26));
-
-            b_bargraph_status[3] = false;
-            b_bargraph_status[26] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(1));
-            ht_bargraph.clearLed(bargraphLookupTable(28));
-
-            b_bargraph_status[1] = false;
-            b_bargraph_status[28] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 13:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(1));
-          ht_bargraph.setLed(bargraphLookupTable(28));
-
-          b_bargraph_status[1] = true;
-          b_bargraph_status[28] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(2));
-            ht_bargraph.clearLed(bargraphLookupTable(27));
-
-            b_bargraph_status[2] = false;
-            b_bargraph_status[27] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(0));
-            ht_bargraph.clearLed(bargraphLookupTable(29));
-
-            b_bargraph_status[0] = false;
-            b_bargraph_status[29] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 14:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(0));
-          ht_bargraph.setLed(bargraphLookupTable(29));
-
-          b_bargraph_status[0] = true;
-          b_bargraph_status[29] = true;
-
-          ht_bargraph.clearLed(bargraphLookupTable(1));
-          ht_bargraph.clearLed(bargraphLookupTable(28));
-
-          b_bargraph_status[1] = false;
-          b_bargraph_status[28] = false;
-
-          i_bargraph_status_alt--;
-
-          b_bargraph_up = false;
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        default:
-          // We should not be here. Do nothing.
-        break;
-      }
-    }
-    else {
-      switch(i_bargraph_status_alt) {
-        case 0:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(13));
-          ht_bargraph.setLed(bargraphLookupTable(14));
-
-          b_bargraph_status[13] = true;
-          b_bargraph_status[14] = true;
-
-          i_bargraph_status_alt++;
-
-          if(b_bargraph_up == false) {
-            ht_bargraph.clearLed(bargraphLookupTable(12));
-            ht_bargraph.clearLed(bargraphLookupTable(15));
-
-            b_bargraph_status[12] = false;
-            b_bargraph_status[15] = false;
-          }
-
-          b_bargraph_up = true;
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 1:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(12));
-          ht_bargraph.setLed(bargraphLookupTable(15));
-
-          b_bargraph_status[12] = true;
-          b_bargraph_status[15] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(13));
-            ht_bargraph.clearLed(bargraphLookupTable(14));
-
-            b_bargraph_status[13] = false;
-            b_bargraph_status[14] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(11));
-            ht_bargraph.clearLed(bargraphLookupTable(16));
-
-            b_bargraph_status[11] = false;
-            b_bargraph_status[16] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 2:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(11));
-          ht_bargraph.setLed(bargraphLookupTable(16));
-
-          b_bargraph_status[11] = true;
-          b_bargraph_status[16] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(12));
-            ht_bargraph.clearLed(bargraphLookupTable(15));
-
-            b_bargraph_status[12] = false;
-            b_bargraph_status[15] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(10));
-            ht_bargraph.clearLed(bargraphLookupTable(17));
-
-            b_bargraph_status[10] = false;
-            b_bargraph_status[17] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 3:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(10));
-          ht_bargraph.setLed(bargraphLookupTable(17));
-
-          b_bargraph_status[10] = true;
-          b_bargraph_status[17] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(11));
-            ht_bargraph.clearLed(bargraphLookupTable(16));
-
-            b_bargraph_status[11] = false;
-            b_bargraph_status[16] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(9));
-            ht_bargraph.clearLed(bargraphLookupTable(18));
-
-            b_bargraph_status[9] = false;
-            b_bargraph_status[18] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 4:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(9));
-          ht_bargraph.setLed(bargraphLookupTable(18));
-
-          b_bargraph_status[9] = true;
-          b_bargraph_status[18] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(10));
-            ht_bargraph.clearLed(bargraphLookupTable(17));
-
-            b_bargraph_status[10] = false;
-            b_bargraph_status[17] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(8));
-            ht_bargraph.clearLed(bargraphLookupTable(19));
-
-            b_bargraph_status[8] = false;
-            b_bargraph_status[19] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 5:
-          vibrationWand(i_vibration_level + 110);
-
-          ht_bargraph.setLed(bargraphLookupTable(8));
-          ht_bargraph.setLed(bargraphLookupTable(19));
-
-          b_bargraph_status[8] = true;
-          b_bargraph_status[19] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(9));
-            ht_bargraph.clearLed(bargraphLookupTable(18));
-
-            b_bargraph_status[9] = false;
-            b_bargraph_status[18] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(7));
-            ht_bargraph.clearLed(bargraphLookupTable(20));
-
-            b_bargraph_status[7] = false;
-            b_bargraph_status[20] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 6:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(7));
-          ht_bargraph.setLed(bargraphLookupTable(20));
-
-          b_bargraph_status[7] = true;
-          b_bargraph_status[20] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(8));
-            ht_bargraph.clearLed(bargraphLookupTable(19));
-
-            b_bargraph_status[8] = false;
-            b_bargraph_status[19] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(6));
-            ht_bargraph.clearLed(bargraphLookupTable(21));
-
-            b_bargraph_status[6] = false;
-            b_bargraph_status[21] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 7:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(6));
-          ht_bargraph.setLed(bargraphLookupTable(21));
-
-          b_bargraph_status[6] = true;
-          b_bargraph_status[21] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(7));
-            ht_bargraph.clearLed(bargraphLookupTable(20));
-
-            b_bargraph_status[7] = false;
-            b_bargraph_status[20] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(5));
-            ht_bargraph.clearLed(bargraphLookupTable(22));
-
-            b_bargraph_status[5] = false;
-            b_bargraph_status[22] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 8:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(5));
-          ht_bargraph.setLed(bargraphLookupTable(22));
-
-          b_bargraph_status[5] = true;
-          b_bargraph_status[22] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(6));
-            ht_bargraph.clearLed(bargraphLookupTable(21));
-
-            b_bargraph_status[6] = false;
-            b_bargraph_status[21] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(4));
-            ht_bargraph.clearLed(bargraphLookupTable(23));
-
-            b_bargraph_status[4] = false;
-            b_bargraph_status[23] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 9:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(4));
-          ht_bargraph.setLed(bargraphLookupTable(23));
-
-          b_bargraph_status[4] = true;
-          b_bargraph_status[23] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(5));
-            ht_bargraph.clearLed(bargraphLookupTable(22));
-
-            b_bargraph_status[5] = false;
-            b_bargraph_status[22] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(3));
-            ht_bargraph.clearLed(bargraphLookupTable(24));
-
-            b_bargraph_status[3] = false;
-            b_bargraph_status[24] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 10:
-          vibrationWand(i_vibration_level + 112);
-
-          ht_bargraph.setLed(bargraphLookupTable(3));
-          ht_bargraph.setLed(bargraphLookupTable(24));
-
-          b_bargraph_status[3] = true;
-          b_bargraph_status[24] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(4));
-            ht_bargraph.clearLed(bargraphLookupTable(23));
-
-            b_bargraph_status[4] = false;
-            b_bargraph_status[23] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(2));
-            ht_bargraph.clearLed(bargraphLookupTable(25));
-
-            b_bargraph_status[2] = false;
-            b_bargraph_status[25] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 11:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(2));
-          ht_bargraph.setLed(bargraphLookupTable(25));
-
-          b_bargraph_status[2] = false;
-          b_bargraph_status[25] = false;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(3));
-            ht_bargraph.clearLed(bargraphLookupTable(24));
-
-            b_bargraph_status[3] = false;
-            b_bargraph_status[24] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(1));
-            ht_bargraph.clearLed(bargraphLookupTable(26));
-
-            b_bargraph_status[1] = false;
-            b_bargraph_status[26] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOff();
-        break;
-
-        case 12:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(1));
-          ht_bargraph.setLed(bargraphLookupTable(26));
-
-          b_bargraph_status[1] = true;
-          b_bargraph_status[26] = true;
-
-          if(b_bargraph_up == true) {
-            ht_bargraph.clearLed(bargraphLookupTable(2));
-            ht_bargraph.clearLed(bargraphLookupTable(25));
-
-            b_bargraph_status[2] = false;
-            b_bargraph_status[25] = false;
-
-            i_bargraph_status_alt++;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(0));
-            ht_bargraph.clearLed(bargraphLookupTable(27));
-
-            b_bargraph_status[0] = false;
-            b_bargraph_status[27] = false;
-
-            i_bargraph_status_alt--;
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        case 13:
-          vibrationWand(i_vibration_level + 115);
-
-          ht_bargraph.setLed(bargraphLookupTable(0));
-          ht_bargraph.setLed(bargraphLookupTable(27));
-
-          b_bargraph_status[0] = true;
-          b_bargraph_status[27] = true;
-
-          ht_bargraph.clearLed(bargraphLookupTable(1));
-          ht_bargraph.clearLed(bargraphLookupTable(26));
-
-          b_bargraph_status[1] = false;
-          b_bargraph_status[26] = false;
-
-          i_bargraph_status_alt--;
-
-          b_bargraph_up = false;
-
-          ht_bargraph.sendLed(); // Commit the changes.
-          wandTipOn();
-        break;
-
-        default:
-          // We should not be here. Do nothing.
-        break;
-      }
-    }
-  }
-  else {
-    // Hasbro 5 LED Bargraph.
-    switch(i_bargraph_status) {
-      case 1:
-        vibrationWand(i_vibration_level + 110);
-
-        digitalWriteFast(bargraphLookupTable(1-1), LOW);
-        digitalWriteFast(bargraphLookupTable(2-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(3-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(4-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(5-1), LOW);
-        i_bargraph_status++;
-
-        wandTipOn();
-      break;
-
-      case 2:
-        vibrationWand(i_vibration_level + 112);
-
-        digitalWriteFast(bargraphLookupTable(1-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(2-1), LOW);
-        digitalWriteFast(bargraphLookupTable(3-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(4-1), LOW);
-        digitalWriteFast(bargraphLookupTable(5-1), HIGH);
-        i_bargraph_status++;
-
-        wandTipOff();
-      break;
-
-      case 3:
-        vibrationWand(i_vibration_level + 115);
-
-        digitalWriteFast(bargraphLookupTable(1-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(2-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(3-1), LOW);
-        digitalWriteFast(bargraphLookupTable(4-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(5-1), HIGH);
-        i_bargraph_status++;
-
-        wandTipOn();
-      break;
-
-      case 4:
-        vibrationWand(i_vibration_level + 112);
-
-        digitalWriteFast(bargraphLookupTable(1-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(2-1), LOW);
-        digitalWriteFast(bargraphLookupTable(3-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(4-1), LOW);
-        digitalWriteFast(bargraphLookupTable(5-1), HIGH);
-        i_bargraph_status++;
-
-        wandTipOff();
-      break;
-
-      case 5:
-        vibrationWand(i_vibration_level + 110);
-
-        digitalWriteFast(bargraphLookupTable(1-1), LOW);
-        digitalWriteFast(bargraphLookupTable(2-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(3-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(4-1), HIGH);
-        digitalWriteFast(bargraphLookupTable(5-1), LOW);
-        i_bargraph_status = 1;
-
-        wandTipOn();
-      break;
-    }
-  }
-}
-
-// This is the Mode Original bargraph firing animation. The top portion fluctuates during firing and becomes more erratic the longer firing continues.
-void bargraphModeOriginalRampFiringAnimation() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    /*
-      // For 28 Segments
-      Power Level 5: full: 23 - 27  (5 segments)
-      Power Level 4: 3/4: 17 - 22   (6 segments)
-      Power Level 3: 1/2: 12 - 16   (5 segments)
-      Power Level 2: 1/4: 5 - 11    (7 segments)
-      Power Level 1: none: 0 - 4    (5 segments)
-    */
-
-    /*
-      // 30 Segment bargraph.
-      Power Level 5: full: 24 - 29  (6 segments)
-      Power Level 4: 3/4: 18 - 23   (6 segments)
-      Power Level 3: 1/2: 12 - 17   (6 segments)
-      Power Level 2: 1/4: 6 - 11    (6 segments)
-      Power Level 1: none: 0 - 5    (6 segments)
-    */
-
-    uint8_t i_segment_adjust = 2;
-
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      i_segment_adjust = 0;
-    }
-
-    // When firing starts, i_bargraph_status_alt resets to 0 in modeFireStart();
-    if(i_bargraph_status_alt == 0) {
-      // Set our target.
-      switch(i_power_level) {
-        case 5:
-          i_bargraph_status_alt = random(18, i_bargraph_segments - i_segment_adjust);
-        break;
-
-        case 4:
-          i_bargraph_status_alt = random(13, 25);
-        break;
-
-        case 3:
-          i_bargraph_status_alt = random(9, 19);
-        break;
-
-        case 2:
-          i_bargraph_status_alt = random(3, 13);
-        break;
-
-        case 1:
-        default:
-          // Not used in MODE_ORIGINAL.
-          //i_bargraph_status_alt = random(0, 6);
-        break;
-      }
-    }
-
-    bool b_tmp_down = true;
-
-    for(uint8_t i = 0; i < i_bargraph_segments - i_segment_adjust; i++) {
-      if(b_bargraph_status[i] != true && i < i_bargraph_status_alt) {
-        b_tmp_down = false;
-        break;
-      }
-    }
-
-    switch(i_power_level) {
-      case 5:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments - (i_segment_adjust + 1); i >= i_bargraph_status_alt; i--) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(6, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(9, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(12, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(15, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status_alt = random(18, i_bargraph_segments - i_segment_adjust);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == true) {
-              ht_bargraph.clearLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = false;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status_alt; i++) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(8, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(12, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(14, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(16, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                case 1:
-                  i_bargraph_status_alt = random(18, i_bargraph_segments - i_segment_adjust);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, i_bargraph_segments - i_segment_adjust);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == false) {
-              ht_bargraph.setLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = true;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-      break;
-
-      case 4:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = 25; i >= i_bargraph_status_alt; i--) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 25);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(4, 25);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(7, 25);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(10, 25);
-                break;
-
-                case 1:
-                  i_bargraph_status_alt = random(13, 25);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 25);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == true) {
-              ht_bargraph.clearLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = false;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status_alt; i++) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 25);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(4, 25);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(7, 25);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(10, 25);
-                break;
-
-                case 1:
-                  i_bargraph_status_alt = random(13, 25);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 25);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == false) {
-              ht_bargraph.setLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = true;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-      break;
-
-      case 3:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = 19; i >= i_bargraph_status_alt; i--) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 19);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(3, 19);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(5, 19);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(7, 19);
-                break;
-
-                case 1:
-                  i_bargraph_status_alt = random(9, 19);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 19);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == true) {
-              ht_bargraph.clearLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = false;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status_alt; i++) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 19);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(3, 19);
-                break;
-
-                case 3:
-                  i_bargraph_status_alt = random(5, 19);
-                break;
-
-                case 2:
-                  i_bargraph_status_alt = random(7, 19);
-                break;
-
-                case 1:
-                  i_bargraph_status_alt = random(9, 19);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 19);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == false) {
-              ht_bargraph.setLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = true;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-      break;
-
-      case 2:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = 13; i >= i_bargraph_status_alt; i--) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 13);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(2, 13);
-                break;
-
-                case 3:
-                case 2:
-                case 1:
-                  i_bargraph_status_alt = random(3, 13);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 13);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == true) {
-              ht_bargraph.clearLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = false;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status_alt; i++) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(1, 13);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(2, 13);
-                break;
-
-                case 3:
-                case 2:
-                case 1:
-                  i_bargraph_status_alt = random(3, 13);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 13);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == false) {
-              ht_bargraph.setLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = true;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-      break;
-
-      case 1:
-      default:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = 7; i >= i_bargraph_status_alt; i--) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(0, 10);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(0, 9);
-                break;
-
-                case 3:
-                case 2:
-                case 1:
-                  i_bargraph_status_alt = random(0, 8);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 7);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == true) {
-              ht_bargraph.clearLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = false;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status_alt; i++) {
-            if(i_bargraph_status_alt == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status_alt = random(0, 10);
-                break;
-
-                case 4:
-                  i_bargraph_status_alt = random(0, 9);
-                break;
-
-                case 3:
-                case 2:
-                case 1:
-                  i_bargraph_status_alt = random(0, 8);
-                break;
-
-                default:
-                  i_bargraph_status_alt = random(0, 7);
-                break;
-              }
-            }
-
-            if(b_bargraph_status[i] == false) {
-              ht_bargraph.setLed(bargraphLookupTable(i));
-              b_bargraph_status[i] = true;
-
-              break;
-            }
-          }
-
-          ht_bargraph.sendLed(); // Commit the changes.
-        }
-      break;
-    }
-
-    if(i_bargraph_status_alt > 22) {
-      vibrationWand(i_vibration_level + 115);
-    }
-    else if(i_bargraph_status_alt > 11) {
-      vibrationWand(i_vibration_level + 112);
-    }
-    else {
-      vibrationWand(i_vibration_level + 110);
-    }
-  }
-  else {
-    // When firing starts, i_bargraph_status resets to 0 in modeFireStart();
-    if(i_bargraph_status == 0) {
-      // Set our target.
-      switch(i_power_level) {
-        case 5:
-          i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-        break;
-
-        case 4:
-          i_bargraph_status = random(2, i_bargraph_segments_5_led);
-        break;
-
-        case 3:
-          i_bargraph_status = random(1, i_bargraph_segments_5_led - 1);
-        break;
-
-        case 2:
-          i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-        break;
-
-        case 1:
-        default:
-          i_bargraph_status = random(0, i_bargraph_segments_5_led - 3);
-        break;
-      }
-    }
-
-    bool b_tmp_down = true;
-
-    for(uint8_t i = 0; i < i_bargraph_segments_5_led; i++) {
-      if(b_bargraph_status_5[i] != true && i <= i_bargraph_status) {
-        b_tmp_down = false;
-        break;
-      }
-    }
-
-    switch(i_power_level) {
-      case 5:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments_5_led; i >= i_bargraph_status; i--) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-              }
-            }
-
-
-            if(b_bargraph_status_5[i-1] == true) {
-              wandBargraphControl(i-1);
-              break;
-            }
-          }
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status; i++) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i] == false) {
-              wandBargraphControl(i+1);
-              break;
-            }
-          }
-        }
-      break;
-
-      case 4:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments_5_led; i >= i_bargraph_status; i--) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-              }
-            }
-
-
-            if(b_bargraph_status_5[i-1] == true) {
-              wandBargraphControl(i-1);
-              break;
-            }
-          }
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status; i++) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(2, i_bargraph_segments_5_led + 1);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i] == false) {
-              wandBargraphControl(i+1);
-              break;
-            }
-          }
-        }
-      break;
-
-      case 3:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments_5_led; i >= i_bargraph_status; i--) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led - 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led - 1);
-                break;
-              }
-            }
-
-
-            if(b_bargraph_status_5[i-1] == true) {
-              wandBargraphControl(i-1);
-              break;
-            }
-          }
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status; i++) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led - 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led - 1);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i] == false) {
-              wandBargraphControl(i+1);
-              break;
-            }
-          }
-        }
-      break;
-
-      case 2:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments_5_led; i >= i_bargraph_status; i--) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-              }
-            }
-
-
-            if(b_bargraph_status_5[i-1] == true) {
-              wandBargraphControl(i-1);
-              break;
-            }
-          }
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status; i++) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(1, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i] == false) {
-              wandBargraphControl(i+1);
-              break;
-            }
-          }
-        }
-      break;
-
-      case 1:
-      default:
-        if(b_tmp_down == true) {
-          // Moving down.
-          for(uint8_t i = i_bargraph_segments_5_led; i >= i_bargraph_status; i--) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i-1] == true) {
-              wandBargraphControl(i-1);
-              break;
-            }
-          }
-        }
-        else {
-          // Need to move up.
-          for(uint8_t i = 0; i <= i_bargraph_status; i++) {
-            if(i_bargraph_status == i) {
-              switch(i_cyclotron_speed_up) {
-                case 5:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 4:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led + 1);
-                break;
-
-                case 3:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led);
-                break;
-
-                case 2:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-
-                case 1:
-                default:
-                  i_bargraph_status = random(0, i_bargraph_segments_5_led - 2);
-                break;
-              }
-            }
-
-            if(b_bargraph_status_5[i] == false) {
-              wandBargraphControl(i+1);
-              break;
-            }
-          }
-        }
-      break;
-    }
-  }
-
-  if(i_bargraph_status > 3) {
-    vibrationWand(i_vibration_level + 115);
-  }
-  else if(i_bargraph_status > 1) {
-    vibrationWand(i_vibration_level + 112);
-  }
-  else {
-    vibrationWand(i_vibration_level + 110);
-  }
-}
-
-// Bargraph ramping during firing.
-// Optional barrel LED tip strobing is controlled from here to give it a ramp effect if the Proton Pack and Neutrona Wand are going to overheat.
-void bargraphRampFiring() {
-  switch(BARGRAPH_FIRING_ANIMATION) {
-    case BARGRAPH_ANIMATION_SUPER_HERO:
-      bargraphSuperHeroRampFiringAnimation();
-    break;
-    case BARGRAPH_ANIMATION_ORIGINAL:
-    default:
-      bargraphModeOriginalRampFiringAnimation();
-
-      // Strobe the optional tip light on even barrel LED numbers.
-      if((i_barrel_light & 0x01) == 0) {
-        wandTipOn();
-      }
-      else {
-        wandTipOff();
-      }
-    break;
-  }
-
-  uint8_t i_ramp_interval = d_bargraph_ramp_interval;
-
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    // Switch to a different ramp speed if using the 28 or 30 segment bargraph.
-    i_ramp_interval = d_bargraph_ramp_interval_alt;
-  }
-
-  // If in a power level on the wand that can overheat, change the speed of the bargraph ramp during firing based on time remaining before we overheat.
-  if(ms_overheat_initiate.isRunning()) {
-    if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 6) {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        ms_bargraph_firing.start((i_ramp_interval / 8) + 2); // 7ms per segment
-      }
-      else {
-        ms_bargraph_firing.start(i_ramp_interval / 5); // 24ms per LED
-      }
-
-      cyclotronSpeedUp(6);
-    }
-    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 5) {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        ms_bargraph_firing.start((i_ramp_interval / 8) + 4); // 9ms per segment
-      }
-      else {
-        ms_bargraph_firing.start(i_ramp_interval / 4); // 30ms per LED
-      }
-
-      cyclotronSpeedUp(5);
-    }
-    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 4) {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        ms_bargraph_firing.start((i_ramp_interval / 4) + 1); // 11ms per segment
-      }
-      else {
-        ms_bargraph_firing.start(i_ramp_interval / 3); // 40ms per LED
-      }
-
-      cyclotronSpeedUp(4);
-    }
-    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 3) {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        ms_bargraph_firing.start((i_ramp_interval / 4) + 3); // 13ms per segment
-      }
-      else {
-        ms_bargraph_firing.start((i_ramp_interval / 2) - 10); // 50ms per LED
-      }
-
-      cyclotronSpeedUp(3);
-    }
-    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 2) {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        ms_bargraph_firing.start((i_ramp_interval / 4) + 5); // 15ms per segment
-      }
-      else {
-        ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+            case 5:
+              i_firing_stream_tmp = i_firing_stream_tmp - 60;
+            break;
+          }
+        break;
       }
 
-      cyclotronSpeedUp(2);
+      ms_firing_effect_end.start(i_firing_stream_tmp);
+      ms_firing_stream_effects.stop();
     }
-    else {
-      if(BARGRAPH_TYPE != SEGMENTS_5) {
-        switch(i_power_level) {
-          case 5:
-            ms_bargraph_firing.start((i_ramp_interval / 2) - 5); // 15ms per segment
-          break;
+  }
+  else {
+    switch(STREAM_MODE) {
+      case PROTON:
+      default:
+        if(b_firing_cross_streams == true) {
+          if(getSystemYearMode() == SYSTEM_FROZEN_EMPIRE && !b_pack_cyclotron_lid_on) {
+            c_temp = C_CHARTREUSE;
+          }
+          else {
+            c_temp = C_WHITE;
+          }
+        }
+        else if(getSystemYearMode() == SYSTEM_1989) {
+          // Shift the stream from orange to red on higher power levels.
+          switch(i_power_level) {
+            case 1:
+            default:
+              c_temp = C_RED5;
+            break;
 
-          case 4:
-            ms_bargraph_firing.start(i_ramp_interval / 2); // 20ms per segment
-          break;
+            case 2:
+              c_temp = C_RED4;
+            break;
 
-          case 3:
-            ms_bargraph_firing.start((i_ramp_interval / 2) + 5); // 25ms per segment
-          break;
+            case 3:
+              c_temp = C_RED3;
+            break;
 
-          case 2:
-            ms_bargraph_firing.start((i_ramp_interval / 2) + 10); // 30ms per segment
-          break;
+            case 4:
+              c_temp = C_RED2;
+            break;
 
-          case 1:
-          default:
-            ms_bargraph_firing.start((i_ramp_interval / 2) + 15); // 35ms per segment
-          break;
+            case 5:
+              c_temp = C_RED;
+            break;
+          }
         }
-      }
-      else {
-        if(BARGRAPH_FIRING_ANIMATION == BARGRAPH_ANIMATION_ORIGINAL) {
+        else {
+          // Shift the stream from red to orange on higher power levels.
           switch(i_power_level) {
-            case 5:
-              ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+            case 1:
+            default:
+              c_temp = C_RED;
             break;
 
-            case 4:
-              ms_bargraph_firing.start((i_ramp_interval / 2) + 30); // 90ms per LED
+            case 2:
+              c_temp = C_RED2;
             break;
 
             case 3:
-              ms_bargraph_firing.start(i_ramp_interval); // 120ms per LED
+              c_temp = C_RED3;
             break;
 
-            case 2:
-              ms_bargraph_firing.start(i_ramp_interval * 2); // 240ms per LED
+            case 4:
+              c_temp = C_RED4;
             break;
 
-            case 1:
-            default:
-              ms_bargraph_firing.start(i_ramp_interval * 3); // 360ms per LED
+            case 5:
+              c_temp = C_RED5;
             break;
           }
         }
+      break;
+
+      case SLIME:
+        if(getSystemYearMode() == SYSTEM_1989) {
+          c_temp = C_PASTEL_PINK;
+        }
         else {
-          ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+          c_temp = C_DARK_GREEN;
         }
-      }
-
-      i_cyclotron_speed_up = 1;
-    }
-  }
-  else {
-    if(BARGRAPH_TYPE != SEGMENTS_5) {
-      switch(i_power_level) {
-        case 5:
-          ms_bargraph_firing.start((i_ramp_interval / 2) - 7); // 13ms per segment
-        break;
-
-        case 4:
-          ms_bargraph_firing.start((i_ramp_interval / 2) - 3); // 15ms per segment
-        break;
+      break;
 
-        case 3:
-          ms_bargraph_firing.start(i_ramp_interval / 2); // 20ms per segment
-        break;
+      case STASIS:
+        c_temp = C_BLUE;
+      break;
 
-        case 2:
-          ms_bargraph_firing.start((i_ramp_interval / 2) + 7); // 25ms per segment
-        break;
+      case MESON:
+      case SPECTRAL:
+      case HOLIDAY_HALLOWEEN:
+      case HOLIDAY_CHRISTMAS:
+        c_temp = C_BLACK;
+      break;
 
-        case 1:
-        default:
-          ms_bargraph_firing.start((i_ramp_interval / 2) + 12); // 30ms per segment
-        break;
-      }
+      case SPECTRAL_CUSTOM:
+        c_temp = C_CUSTOM;
+      break;
     }
-    else {
-      if(BARGRAPH_FIRING_ANIMATION == BARGRAPH_ANIMATION_ORIGINAL) {
-        switch(i_power_level) {
-          case 5:
-            ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
-          break;
-
-          case 4:
-            ms_bargraph_firing.start((i_ramp_interval / 2) + 30); // 90ms per LED
-          break;
 
-          case 3:
-            ms_bargraph_firing.start(i_ramp_interval); // 120ms per LED
-          break;
+    switch(WAND_BARREL_LED_COUNT) {
+      case LEDS_50:
+        // Set the final LED back to whatever colour it is without the effect.
+        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light - 1])] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
+      break;
 
-          case 2:
-            ms_bargraph_firing.start(i_ramp_interval * 2); // 240ms per LED
-          break;
+      case LEDS_48:
+        // Set the final LED back to whatever colour it is without the effect.
+        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light - 1])] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
+      break;
 
-          case 1:
-          default:
-            ms_bargraph_firing.start(i_ramp_interval * 3); // 360ms per LED
-          break;
-        }
-      }
-      else {
-        ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
-      }
+      case LEDS_5:
+      case LEDS_2:
+      default:
+        // Set the final LED back to whatever colour it is without the effect.
+        barrel_leds[i_barrel_light - 1] = getHueColour(c_temp, WAND_BARREL_LED_COUNT);
+      break;
     }
+
+    i_barrel_light = 0;
+    ms_firing_effect_end.stop();
+    ms_firing_lights_end.start(0);
   }
 }
 
-void cyclotronSpeedUp(uint8_t i_switch) {
-  if(i_switch != i_cyclotron_speed_up) {
-    if(i_switch == 4) {
-      // Tell pack to start beeping before we overheat it.
-      wandSerialSend(W_BEEP_START);
+void fireStreamEnd(CRGB c_colour) {
+  if(i_barrel_light < i_num_barrel_leds) {
+    switch(WAND_BARREL_LED_COUNT) {
+      case LEDS_50:
+        // Set the colour for the mapped LED.
+        barrel_leds[PROGMEM_READU8(gpstar_neutrona_barrel[i_barrel_light])] = c_colour;
 
-      // Play overheat alert beeps before we overheat.
-      switch(getSystemYearMode()) {
-        case SYSTEM_AFTERLIFE:
-        case SYSTEM_FROZEN_EMPIRE:
-        default:
-          playEffect(S_PACK_BEEPS_OVERHEAT, true);
-        break;
+        // More LEDs means a faster firing rate.
+        ms_firing_lights_end.start(i_firing_stream / 25); // 4ms
+      break;
 
-        case SYSTEM_1984:
-        case SYSTEM_1989:
-          playEffect(S_BEEP_8, true);
-        break;
-      }
+      case LEDS_48:
+        // Set the colour for the mapped LED.
+        barrel_leds[PROGMEM_READU8(frutto_barrel[i_barrel_light])] = c_colour;
 
-      ms_warning_blink.start(i_warning_blink_delay);
+        // More LEDs means a faster firing rate.
+        ms_firing_lights_end.start(i_firing_stream / 25); // 4ms
+      break;
+
+      case LEDS_5:
+      case LEDS_2:
+      default:
+        // Set the colour for the specific LED.
+        barrel_leds[i_barrel_light] = c_colour;
+
+        // Firing at a "normal" rate
+        ms_firing_lights_end.start(i_firing_stream / 5); // 20ms
+      break;
     }
 
-    i_cyclotron_speed_up++;
+    i_barrel_light++;
 
-    // Tell the pack to speed up the Cyclotron.
-    wandSerialSend(W_CYCLOTRON_INCREASE_SPEED);
+    if(i_barrel_light == i_num_barrel_leds) {
+      i_barrel_light = 0;
+
+      if(WAND_BARREL_LED_COUNT != LEDS_5) {
+        // Turn off wand tip in case it's still on.
+        wandTipOff();
+      }
+
+      ms_firing_lights_end.stop();
+
+      i_fast_led_delay = FAST_LED_UPDATE_MS;
+    }
   }
 }
-
-void stopOverheatBeepWarnings() {
-  // Stop overheat beeps.
-  switch(getSystemYearMode()) {
-    case SYSTEM_AFTERLIFE:
-    case SYSTEM_FROZEN_EMPIRE:
-    default:
-      stopEffect(S_PACK_BEEPS_OVERHEAT);
+
+// This is the Super Hero bargraph firing animation. Ramping up and down from the middle to the top/bottom and back to the middle again.
+void bargraphSuperHeroRampFiringAnimation() {
+  const BargraphKeyframe *p_track;
+  uint8_t i_frames;
+
+  switch(BARGRAPH_TYPE) {
+    case SEGMENTS_30:
+      p_track = bargraphTrackSuperHero30;
+      i_frames = sizeof(bargraphTrackSuperHero30) / sizeof(BargraphKeyframe);
     break;
 
-    case SYSTEM_1984:
-    case SYSTEM_1989:
-      stopEffect(S_BEEP_8);
+    case SEGMENTS_28:
+      p_track = bargraphTrackSuperHero28;
+      i_frames = sizeof(bargraphTrackSuperHero28) / sizeof(BargraphKeyframe);
+    break;
+
+    case SEGMENTS_5:
+    default:
+      p_track = bargraphTrackSuperHero5;
+      i_frames = sizeof(bargraphTrackSuperHero5) / sizeof(BargraphKeyframe);
     break;
   }
-}
 
-void cyclotronSpeedRevert() {
-  // Attenuator told us to reset, so stop beeps.
-  stopOverheatBeepWarnings();
+  // The track starts over whenever the bargraph has been cleared, otherwise each call moves on by one frame.
+  if(bargraphSequencer.isPlaying(p_track)) {
+    bargraphSequencer.next();
+  }
+  else {
+    bargraphSequencer.play(p_track, i_frames);
+  }
 
-  i_cyclotron_speed_up = 1;
-}
+  vibrationWand(i_vibration_level + (bargraphSequencer.cue() & ~BARGRAPH_CUE_TIP));
 
-// Afterlife and Frozen Empire mode for the 28 and 30 segment bargraph.
-// Checks if we ramp up or down when changing power levels.
-// Forces the bargraph to redraw itself to the current power level.
-void bargraphPowerCheck2021Alt(bool b_override) {
-  if((WAND_ACTION_STATUS != ACTION_FIRING && WAND_ACTION_STATUS != ACTION_SETTINGS && WAND_ACTION_STATUS != ACTION_OVERHEATING) || b_override == true) {
-    if(i_power_level != i_power_level_prev || b_override == true) {
-      if(i_power_level > i_power_level_prev) {
-        b_bargraph_up = true;
-      }
-      else {
-        b_bargraph_up = false;
-      }
+  bargraphDrawFrame(false);
 
-      switch(i_power_level) {
-        case 5:
-          ms_bargraph_alt.start(i_bargraph_wait / 3);
-        break;
+  if(bargraphSequencer.cue() & BARGRAPH_CUE_TIP) {
+    wandTipOn();
+  }
+  else {
+    wandTipOff();
+  }
+}
 
-        case 4:
-          ms_bargraph_alt.start(i_bargraph_wait / 4);
-        break;
+// Draws the current bargraph sequencer frame. A redraw sets every segment, for when the bargraph may not show the previous frame.
+void bargraphDrawFrame(bool b_redraw) {
+  uint32_t i_mask = bargraphSequencer.mask();
 
-        case 3:
-          ms_bargraph_alt.start(i_bargraph_wait / 5);
-        break;
+  if(BARGRAPH_TYPE == SEGMENTS_5) {
+    // The Hasbro bargraph is written in full on every frame. Its LEDs are lit by pulling the pin low.
+    for(uint8_t i = 0; i < i_bargraph_segments_5_led; i++) {
+      b_bargraph_status_5[i] = (i_mask >> i) & 0x01;
+      digitalWriteFast(bargraphLookupTable(i), b_bargraph_status_5[i] ? LOW : HIGH);
+    }
+  }
+  else {
+    // Only the segments which changed since the previous frame need to be touched.
+    uint32_t i_changed = bargraphSequencer.changed();
+    uint8_t i_segments = bargraphRampFull();
 
-        case 2:
-          ms_bargraph_alt.start(i_bargraph_wait / 6);
-        break;
+    if(b_redraw) {
+      i_changed = 0xFFFFFFFF;
+    }
 
-        case 1:
-        default:
-          ms_bargraph_alt.start(i_bargraph_wait / 7);
-        break;
+    for(uint8_t i = 0; i < i_segments; i++) {
+      if((i_changed >> i) & 0x01) {
+        if((i_mask >> i) & 0x01) {
+          ht_bargraph.setLed(bargraphLookupTable(i));
+          b_bargraph_status[i] = true;
+        }
+        else {
+          ht_bargraph.clearLed(bargraphLookupTable(i));
+          b_bargraph_status[i] = false;
+        }
       }
     }
+
+    ht_bargraph.sendLed(); // Commit the changes.
   }
 }
 
-void bargraphClearAll() {
-  ht_bargraph.clearAll();
+// Returns the ramp track for the bargraph in use. It has one frame more than the bargraph has segments.
+const BargraphKeyframe *bargraphRampTrack(uint8_t &i_frames) {
+  switch(BARGRAPH_TYPE) {
+    case SEGMENTS_30:
+      i_frames = sizeof(bargraphTrackRamp30) / sizeof(BargraphKeyframe);
+      return bargraphTrackRamp30;
+    break;
 
-  for(uint8_t i = 0; i < i_bargraph_segments; i++) {
-    b_bargraph_status[i] = false;
+    case SEGMENTS_28:
+      i_frames = sizeof(bargraphTrackRamp28) / sizeof(BargraphKeyframe);
+      return bargraphTrackRamp28;
+    break;
+
+    case SEGMENTS_5:
+    default:
+      i_frames = sizeof(bargraphTrackRamp5) / sizeof(BargraphKeyframe);
+      return bargraphTrackRamp5;
+    break;
   }
 }
 
-void bargraphClearAlt() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    bargraphClearAll();
+// Returns the ramp frame with every segment lit, which is also the number of segments.
+uint8_t bargraphRampFull() {
+  uint8_t i_frames;
 
-    i_bargraph_status_alt = 0;
-  }
+  bargraphRampTrack(i_frames);
+
+  return i_frames - 1;
 }
 
-// Returns the top segment for a given power level for the 28 or 30 segment bargraphs.
-uint8_t bargraphPowerLookupTable(uint8_t index) {
-  if(BARGRAPH_TYPE == SEGMENTS_28) {
-    return PROGMEM_READU8(i_bargraph_power_table_28[index]);
+// Returns the ramp frame which shows the current power level.
+uint8_t bargraphRampLevel() {
+  if(BARGRAPH_TYPE == SEGMENTS_5) {
+    return i_power_level;
   }
-  else if(BARGRAPH_TYPE == SEGMENTS_30) {
-    return PROGMEM_READU8(i_bargraph_power_table_wamco[index]);
+  else if(i_power_level >= i_power_level_max) {
+    return bargraphRampFull();
   }
   else {
-    return 1;
+    return bargraphPowerLookupTable(i_power_level) + 1;
   }
 }
 
-// This function handles returning all bargraph lookup table values.
-uint8_t bargraphLookupTable(uint8_t index) {
-  if(BARGRAPH_TYPE == SEGMENTS_28) {
-    if(b_bargraph_invert) {
-      return PROGMEM_READU8(i_bargraph_invert[index]);
-    }
-    else {
-      return PROGMEM_READU8(i_bargraph_normal[index]);
-    }
+// Shows a frame of the ramp track straight away, whatever the bargraph showed before.
+void bargraphRampStart(uint8_t i_frame) {
+  uint8_t i_frames;
+  const BargraphKeyframe *p_track = bargraphRampTrack(i_frames);
+
+  bargraphSequencer.play(p_track, i_frames, i_frame);
+  bargraphDrawFrame(true);
+}
+
+// Moves the ramp one frame towards the target frame. Returns true once the target is shown.
+bool bargraphRampStep(uint8_t i_target) {
+  if(bargraphSequencer.frame() < i_target) {
+    bargraphSequencer.next();
   }
-  else if(BARGRAPH_TYPE == SEGMENTS_30) {
-    if(b_bargraph_invert) {
-      return PROGMEM_READU8(i_bargraph_wamco_invert[index]);
-    }
-    else {
-      return PROGMEM_READU8(i_bargraph_wamco_normal[index]);
-    }
+  else if(bargraphSequencer.frame() > i_target) {
+    bargraphSequencer.prev();
   }
   else {
-    if(b_bargraph_invert) {
-      return PROGMEM_READU8(i_bargraph_5_led_invert[index]);
-    }
-    else {
-      return PROGMEM_READU8(i_bargraph_5_led_normal[index]);
-    }
+    return true;
   }
+
+  bargraphDrawFrame(false);
+
+  return bargraphSequencer.frame() == i_target;
 }
 
-// Draw the bargraph to the current power level instantly.
-void bargraphRedraw() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    /*
-      // 28 segment bargraph
-      Power Level 5: full: 23 - 27  (5 segments)
-      Power Level 4: 3/4: 17 - 22   (6 segments)
-      Power Level 3: 1/2: 12 - 16   (5 segments)
-      Power Level 2: 1/4: 5 - 11    (7 segments)
-      Power Level 1: none: 0 - 4    (5 segments)
-    */
-
-    /*
-      // 30 Segment bargraph.
-      Power Level 5: full: 24 - 29  (6 segments)
-      Power Level 4: 3/4: 18 - 23   (6 segments)
-      Power Level 3: 1/2: 12 - 17   (6 segments)
-      Power Level 2: 1/4: 6 - 11    (6 segments)
-      Power Level 1: none: 0 - 5    (6 segments)
-    */
-
-    uint8_t i_segment_adjust = 2;
-
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      i_segment_adjust = 0;
-    }
+// Blinks the bargraph while overheating, when enabled in place of the ramp down.
+void bargraphOverheatBlink() {
+  const BargraphKeyframe *p_track;
+  uint8_t i_frames;
 
-    switch(i_power_level) {
-      case 5:
-        for(uint8_t i = 0; i < i_bargraph_segments - i_segment_adjust; i++) {
-          ht_bargraph.setLed(bargraphLookupTable(i));
-          b_bargraph_status[i] = true;
-        }
+  switch(BARGRAPH_TYPE) {
+    case SEGMENTS_30:
+      p_track = bargraphTrackOverheatBlink30;
+      i_frames = sizeof(bargraphTrackOverheatBlink30) / sizeof(BargraphKeyframe);
+    break;
 
-        ht_bargraph.sendLed(); // Commit the changes.
-        i_bargraph_status_alt = i_bargraph_segments - i_segment_adjust;
-      break;
+    case SEGMENTS_28:
+      p_track = bargraphTrackOverheatBlink28;
+      i_frames = sizeof(bargraphTrackOverheatBlink28) / sizeof(BargraphKeyframe);
+    break;
 
-      case 4:
-      case 3:
-      case 2:
-      case 1:
-      default:
-        for(uint8_t i = 0; i < i_bargraph_segments - i_segment_adjust; i++) {
-          if(i <= bargraphPowerLookupTable(i_power_level)) {
-            ht_bargraph.setLed(bargraphLookupTable(i));
-            b_bargraph_status[i] = true;
-          }
-          else {
-            ht_bargraph.clearLed(bargraphLookupTable(i));
-            b_bargraph_status[i] = false;
-          }
-        }
+    case SEGMENTS_5:
+    default:
+      p_track = bargraphTrackOverheatBlink5;
+      i_frames = sizeof(bargraphTrackOverheatBlink5) / sizeof(BargraphKeyframe);
+    break;
+  }
 
-        ht_bargraph.sendLed(); // Commit the changes.
-        i_bargraph_status_alt = bargraphPowerLookupTable(i_power_level);
-      break;
-    }
+  if(!bargraphSequencer.isPlaying(p_track)) {
+    bargraphSequencer.play(p_track, i_frames);
+    bargraphDrawFrame(true);
+    ms_settings_blink.start(i_settings_blink_delay / 2);
   }
-  else {
-    // Stock haslab bargraph control.
-    switch(i_power_level) {
-      case 1:
-      default:
-        wandBargraphControl(1);
-      break;
+  else if(ms_settings_blink.justFinished()) {
+    bargraphSequencer.next();
+    bargraphDrawFrame(false);
+    ms_settings_blink.start(i_settings_blink_delay / 2);
+  }
+}
 
-      case 2:
-        wandBargraphControl(2);
-      break;
+// This is the Mode Original bargraph firing animation. The bargraph ramps between random targets which reach further down the longer firing continues.
+void bargraphModeOriginalRampFiringAnimation() {
+  uint8_t i_frames;
+  const BargraphKeyframe *p_track = bargraphRampTrack(i_frames);
+  uint8_t i_speed = i_cyclotron_speed_up > 6 ? 6 : i_cyclotron_speed_up;
 
-      case 3:
-        wandBargraphControl(3);
-      break;
+  // When firing starts, the target resets to 0 in modeFireStart().
+  uint8_t &i_target = BARGRAPH_TYPE == SEGMENTS_5 ? i_bargraph_status : i_bargraph_status_alt;
 
-      case 4:
-        wandBargraphControl(4);
-      break;
+  if(!bargraphSequencer.isPlaying(p_track)) {
+    bargraphRampStart(bargraphRampLevel());
+  }
 
-      case 5:
-        wandBargraphControl(5);
-      break;
+  if(i_target == 0 || bargraphSequencer.frame() == i_target) {
+    // Set our next target.
+    if(BARGRAPH_TYPE == SEGMENTS_5) {
+      uint8_t i_direction = bargraphSequencer.frame() < i_frames - 1 ? 1 : 0;
+
+      i_target = random(PROGMEM_READU8(i_bargraph_firing_range_5_led[i_direction][i_power_level - 1][i_speed][0]), PROGMEM_READU8(i_bargraph_firing_range_5_led[i_direction][i_power_level - 1][i_speed][1]));
+    }
+    else {
+      uint8_t i_ceiling = PROGMEM_READU8(i_bargraph_firing_range[i_power_level - 1][i_speed][1]);
+
+      if(i_ceiling > i_frames - 1) {
+        i_ceiling = i_frames - 1;
+      }
+
+      i_target = random(PROGMEM_READU8(i_bargraph_firing_range[i_power_level - 1][i_speed][0]), i_ceiling);
     }
   }
+
+  bargraphRampStep(i_target);
+
+  uint8_t i_high = BARGRAPH_TYPE == SEGMENTS_5 ? 3 : 22;
+  uint8_t i_middle = BARGRAPH_TYPE == SEGMENTS_5 ? 1 : 11;
+
+  if(i_target > i_high) {
+    vibrationWand(i_vibration_level + 115);
+  }
+  else if(i_target > i_middle) {
+    vibrationWand(i_vibration_level + 112);
+  }
+  else {
+    vibrationWand(i_vibration_level + 110);
+  }
 }
 
-void bargraphPowerCheck() {
-  // Control for the 28 and 30 segment bargraph.
-  /*
-    // 28 Segment bargraph.
-    Power Level 5: full: 23 - 27  (5 segments)
-    Power Level 4: 3/4: 17 - 22   (6 segments)
-    Power Level 3: 1/2: 12 - 16   (5 segments)
-    Power Level 2: 1/4: 5 - 11    (7 segments)
-    Power Level 1: none: 0 - 4    (5 segments)
-  */
+// Bargraph ramping during firing.
+// Optional barrel LED tip strobing is controlled from here to give it a ramp effect if the Proton Pack and Neutrona Wand are going to overheat.
+void bargraphRampFiring() {
+  switch(BARGRAPH_FIRING_ANIMATION) {
+    case BARGRAPH_ANIMATION_SUPER_HERO:
+      bargraphSuperHeroRampFiringAnimation();
+    break;
+    case BARGRAPH_ANIMATION_ORIGINAL:
+    default:
+      bargraphModeOriginalRampFiringAnimation();
 
-  /*
-    // 30 Segment bargraph.
-    Power Level 5: full: 24 - 29  (6 segments)
-    Power Level 4: 3/4: 18 - 23   (6 segments)
-    Power Level 3: 1/2: 12 - 17   (6 segments)
-    Power Level 2: 1/4: 6 - 11    (6 segments)
-    Power Level 1: none: 0 - 5    (6 segments)
-  */
+      // Strobe the optional tip light on even barrel LED numbers.
+      if((i_barrel_light & 0x01) == 0) {
+        wandTipOn();
+      }
+      else {
+        wandTipOff();
+      }
+    break;
+  }
+
+  uint8_t i_ramp_interval = d_bargraph_ramp_interval;
 
   if(BARGRAPH_TYPE != SEGMENTS_5) {
-    if(ms_bargraph_alt.justFinished()) {
-      uint8_t i_segment_adjust = 2;
+    // Switch to a different ramp speed if using the 28 or 30 segment bargraph.
+    i_ramp_interval = d_bargraph_ramp_interval_alt;
+  }
 
-      if(BARGRAPH_TYPE == SEGMENTS_30) {
-        i_segment_adjust = 0;
+  // If in a power level on the wand that can overheat, change the speed of the bargraph ramp during firing based on time remaining before we overheat.
+  if(ms_overheat_initiate.isRunning()) {
+    if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 6) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        ms_bargraph_firing.start((i_ramp_interval / 8) + 2); // 7ms per segment
+      }
+      else {
+        ms_bargraph_firing.start(i_ramp_interval / 5); // 24ms per LED
       }
 
-      uint8_t i_bargraph_multiplier[5] = { 7, 6, 5, 4, 3 };
+      cyclotronSpeedUp(6);
+    }
+    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 5) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        ms_bargraph_firing.start((i_ramp_interval / 8) + 4); // 9ms per segment
+      }
+      else {
+        ms_bargraph_firing.start(i_ramp_interval / 4); // 30ms per LED
+      }
 
-      if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
-        for(uint8_t i = 0; i <= 4; i++) {
-          i_bargraph_multiplier[i] = 10;
-        }
+      cyclotronSpeedUp(5);
+    }
+    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 4) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        ms_bargraph_firing.start((i_ramp_interval / 4) + 1); // 11ms per segment
+      }
+      else {
+        ms_bargraph_firing.start(i_ramp_interval / 3); // 40ms per LED
+      }
+
+      cyclotronSpeedUp(4);
+    }
+    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 3) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        ms_bargraph_firing.start((i_ramp_interval / 4) + 3); // 13ms per segment
+      }
+      else {
+        ms_bargraph_firing.start((i_ramp_interval / 2) - 10); // 50ms per LED
+      }
+
+      cyclotronSpeedUp(3);
+    }
+    else if(ms_overheat_initiate.remaining() < i_ms_overheat_initiate[i_power_level - 1] / 2) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        ms_bargraph_firing.start((i_ramp_interval / 4) + 5); // 15ms per segment
+      }
+      else {
+        ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
       }
 
-      if(b_bargraph_up == true) {
-        if(i_bargraph_status_alt < i_bargraph_segments - i_segment_adjust) {
-          ht_bargraph.setLedNow(bargraphLookupTable(i_bargraph_status_alt));
-          b_bargraph_status[i_bargraph_status_alt] = true;
-        }
-
+      cyclotronSpeedUp(2);
+    }
+    else {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
         switch(i_power_level) {
           case 5:
-            if(i_bargraph_status_alt > i_bargraph_segments - i_segment_adjust) {
-              b_bargraph_up = false;
-
-              i_bargraph_status_alt = i_bargraph_segments - i_segment_adjust;
-
-              if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
-                // We stop when we reach our target.
-                ms_bargraph_alt.stop();
-              }
-              else {
-                // A little pause when we reach the top.
-                ms_bargraph_alt.start(i_bargraph_wait / 2);
-              }
-            }
-            else {
-              ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
-            }
+            ms_bargraph_firing.start((i_ramp_interval / 2) - 5); // 15ms per segment
           break;
 
           case 4:
+            ms_bargraph_firing.start(i_ramp_interval / 2); // 20ms per segment
+          break;
+
           case 3:
+            ms_bargraph_firing.start((i_ramp_interval / 2) + 5); // 25ms per segment
+          break;
+
           case 2:
+            ms_bargraph_firing.start((i_ramp_interval / 2) + 10); // 30ms per segment
+          break;
+
           case 1:
           default:
-            if(i_bargraph_status_alt > bargraphPowerLookupTable(i_power_level) - 1) {
-              b_bargraph_up = false;
-
-              if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
-                // We stop when we reach our target.
-                ms_bargraph_alt.stop();
-              }
-              else {
-                // A little pause when we reach the top.
-                ms_bargraph_alt.start(i_bargraph_wait / 2);
-              }
-            }
-            else {
-              ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
-            }
+            ms_bargraph_firing.start((i_ramp_interval / 2) + 15); // 35ms per segment
           break;
         }
-
-        if(b_bargraph_up == true) {
-          i_bargraph_status_alt++;
-        }
       }
       else {
-        if(i_bargraph_status_alt < i_bargraph_segments - i_segment_adjust) {
-          ht_bargraph.clearLedNow(bargraphLookupTable(i_bargraph_status_alt));
-          b_bargraph_status[i_bargraph_status_alt] = false;
-        }
-
-        if(i_bargraph_status_alt == 0) {
-          b_bargraph_up = true;
-
-          // A little pause when we reach the bottom.
-          ms_bargraph_alt.start(i_bargraph_wait / 2);
-        }
-        else {
-          i_bargraph_status_alt--;
-
-          uint8_t i_bargraph_power_lookup_adjust = 1;
-
-          if(BARGRAPH_TYPE == SEGMENTS_30) {
-            i_bargraph_power_lookup_adjust = 0;
-          }
-
+        if(BARGRAPH_FIRING_ANIMATION == BARGRAPH_ANIMATION_ORIGINAL) {
           switch(i_power_level) {
             case 5:
-              if(BARGRAPH_MODE == BARGRAPH_ORIGINAL && i_bargraph_status_alt < i_bargraph_segments - i_segment_adjust) {
-                // We stop when we reach our target.
-                ms_bargraph_alt.stop();
-              }
-              else {
-                ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
-              }
+              ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
             break;
 
             case 4:
+              ms_bargraph_firing.start((i_ramp_interval / 2) + 30); // 90ms per LED
+            break;
+
             case 3:
+              ms_bargraph_firing.start(i_ramp_interval); // 120ms per LED
+            break;
+
             case 2:
+              ms_bargraph_firing.start(i_ramp_interval * 2); // 240ms per LED
+            break;
+
             case 1:
             default:
-              if(BARGRAPH_MODE == BARGRAPH_ORIGINAL && i_bargraph_status_alt < bargraphPowerLookupTable(i_power_level) + i_bargraph_power_lookup_adjust) {
-                // We stop when we reach our target.
-                ms_bargraph_alt.stop();
-              }
-              else {
-                ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
-              }
+              ms_bargraph_firing.start(i_ramp_interval * 3); // 360ms per LED
             break;
           }
         }
+        else {
+          ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+        }
       }
-    }
-  }
-  else {
-    // Stock haslab bargraph control.
-    switch(i_power_level) {
-      case 1:
-      default:
-        wandBargraphControl(1);
-      break;
-
-      case 2:
-        wandBargraphControl(2);
-      break;
-
-      case 3:
-        wandBargraphControl(3);
-      break;
-
-      case 4:
-        wandBargraphControl(4);
-      break;
-
-      case 5:
-        wandBargraphControl(5);
-      break;
-    }
-  }
-}
-
-// Fully lights up the bargraph.
-void bargraphFull() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    uint8_t i_segment_adjust = 2;
-
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      i_segment_adjust = 0;
-    }
 
-    for(uint8_t i = 0; i < i_bargraph_segments - i_segment_adjust; i++) {
-      ht_bargraph.setLed(bargraphLookupTable(i));
-      b_bargraph_status[i] = true;
+      i_cyclotron_speed_up = 1;
     }
-
-    ht_bargraph.sendLed(); // Commit the changes.
   }
   else {
-    wandBargraphControl(5);
-  }
-}
-
-void bargraphRampUp() {
-  if(i_vibration_level < i_vibration_level_min) {
-    i_vibration_level = i_vibration_level_min;
-  }
-
-  if(BARGRAPH_TYPE == SEGMENTS_28) {
-    /*
-      // 28 Segment bargraph.
-      Power Level 5: full: 23 - 27 (5 segments)
-      Power Level 4: 3/4: 17 - 22  (6 segments)
-      Power Level 3: 1/2: 12 - 16  (5 segments)
-      Power Level 2: 1/4: 5 - 11   (7 segments)
-      Power Level 1: none: 0 - 4   (5 segments)
-    */
-
-    switch(i_bargraph_status_alt) {
-      case 0 ... 27:
-        ht_bargraph.setLedNow(bargraphLookupTable(i_bargraph_status_alt));
-        b_bargraph_status[i_bargraph_status_alt] = true;
-
-        if(i_bargraph_status_alt > 22) {
-          vibrationWand(i_vibration_level + 80);
-        }
-        else if(i_bargraph_status_alt > 16) {
-          vibrationWand(i_vibration_level + 40);
-        }
-        else if(i_bargraph_status_alt > 11) {
-          vibrationWand(i_vibration_level + 30);
-        }
-        else if(i_bargraph_status_alt > 4) {
-          vibrationWand(i_vibration_level + 20);
-        }
-        else if(i_bargraph_status_alt > 0) {
-          vibrationWand(i_vibration_level + 10);
-        }
-
-        i_bargraph_status_alt++;
-
-        if(i_bargraph_status_alt == 28) {
-          // A little pause when we reach the top.
-          ms_bargraph.start(i_bargraph_wait / 2);
-
-          // Adjust the ramp down speed if necessary.
-          if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
-            i_bargraph_multiplier_current  = i_bargraph_multiplier_ramp_2021 / 2;
-          }
-        }
-        else {
-          ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-        }
-      break;
-
-      case 28 ... 55:
-        uint8_t i_tmp = i_bargraph_status_alt - (i_bargraph_segments - 2);
-        i_tmp = (i_bargraph_segments - 2) - i_tmp;
-
-        if(WAND_ACTION_STATUS == ACTION_OVERHEATING || b_pack_alarm == true) {
-          vibrationOff();
-
-          ht_bargraph.clearLedNow(bargraphLookupTable(i_tmp));
-          b_bargraph_status[i_tmp] = false;
-
-          if(i_bargraph_status_alt == 55) {
-            ms_bargraph.stop();
-            b_bargraph_up = false;
-            i_bargraph_status_alt = 0;
-          }
-          else {
-            ms_bargraph.start(d_bargraph_ramp_interval_alt * 2);
-            i_bargraph_status_alt++;
-          }
-        }
-        else {
-          if((i_power_level < 5 && BARGRAPH_MODE == BARGRAPH_ORIGINAL) || BARGRAPH_MODE == BARGRAPH_SUPER_HERO) {
-            ht_bargraph.clearLedNow(bargraphLookupTable(i_tmp));
-            b_bargraph_status[i_tmp] = false;
-          }
-
-          switch(BARGRAPH_MODE) {
-            case BARGRAPH_SUPER_HERO:
-              // Bargraph has ramped up and down. In 1984/1989 mode we want to start the ramping.
-              if(i_bargraph_status_alt == 55) {
-                ms_bargraph_alt.start(i_bargraph_interval); // Start the alternate bargraph to ramp up and down continuously.
-                ms_bargraph.stop();
-                b_bargraph_up = true;
-                i_bargraph_status_alt = 0;
-                resetBargraphSpeed();
-
-                vibrationWand(i_vibration_level);
-              }
-              else {
-                ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                i_bargraph_status_alt++;
-              }
-            break;
-
-            case BARGRAPH_ORIGINAL:
-              switch(i_power_level) {
-                case 5:
-                  if(i_bargraph_status_alt == 55) {
-                    ms_bargraph_alt.stop();
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 27;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 25);
-                  }
-                  else {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 55 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 25);
-                  }
-                break;
-
-                case 4:
-                  if(i_bargraph_status_alt == 32) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 22;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 30);
-                  }
-                  else if(i_bargraph_status_alt > 32) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 55 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 30);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
-
-                    vibrationWand(i_vibration_level + 12);
-                  }
-                break;
-
-                case 3:
-                  if(i_bargraph_status_alt == 38) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 16;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                  else if(i_bargraph_status_alt > 38) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 55 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+    if(BARGRAPH_TYPE != SEGMENTS_5) {
+      switch(i_power_level) {
+        case 5:
+          ms_bargraph_firing.start((i_ramp_interval / 2) - 7); // 13ms per segment
+        break;
 
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
+        case 4:
+          ms_bargraph_firing.start((i_ramp_interval / 2) - 3); // 15ms per segment
+        break;
 
-                    vibrationWand(i_vibration_level + 20);
-                  }
-                break;
+        case 3:
+          ms_bargraph_firing.start(i_ramp_interval / 2); // 20ms per segment
+        break;
 
-                case 2:
-                  if(i_bargraph_status_alt == 43) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 11;
-                    resetBargraphSpeed();
+        case 2:
+          ms_bargraph_firing.start((i_ramp_interval / 2) + 7); // 25ms per segment
+        break;
 
-                    vibrationWand(i_vibration_level + 5);
-                  }
-                  else if(i_bargraph_status_alt > 43) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 55 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+        case 1:
+        default:
+          ms_bargraph_firing.start((i_ramp_interval / 2) + 12); // 30ms per segment
+        break;
+      }
+    }
+    else {
+      if(BARGRAPH_FIRING_ANIMATION == BARGRAPH_ANIMATION_ORIGINAL) {
+        switch(i_power_level) {
+          case 5:
+            ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+          break;
 
-                    vibrationWand(i_vibration_level + 5);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
+          case 4:
+            ms_bargraph_firing.start((i_ramp_interval / 2) + 30); // 90ms per LED
+          break;
 
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                break;
+          case 3:
+            ms_bargraph_firing.start(i_ramp_interval); // 120ms per LED
+          break;
 
-                case 1:
-                default:
-                  vibrationWand(i_vibration_level);
+          case 2:
+            ms_bargraph_firing.start(i_ramp_interval * 2); // 240ms per LED
+          break;
 
-                  if(i_bargraph_status_alt == 50) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 4;
-                    resetBargraphSpeed();
-                  }
-                  else if(i_bargraph_status_alt > 50) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 55 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
-                  }
-                break;
-              }
-            break;
-          }
+          case 1:
+          default:
+            ms_bargraph_firing.start(i_ramp_interval * 3); // 360ms per LED
+          break;
         }
-      break;
+      }
+      else {
+        ms_bargraph_firing.start(i_ramp_interval / 2); // 60ms per LED
+      }
     }
   }
-  else if(BARGRAPH_TYPE == SEGMENTS_30) {
-    /*
-      // 30 Segment bargraph.
-      Power Level 5: full: 24 - 29  (6 segments)
-      Power Level 4: 3/4: 18 - 23   (6 segments)
-      Power Level 3: 1/2: 12 - 17   (6 segments)
-      Power Level 2: 1/4: 6 - 11    (6 segments)
-      Power Level 1: none: 0 - 5    (6 segments)
-    */
-
-    switch(i_bargraph_status_alt) {
-      case 0 ... 29:
-        ht_bargraph.setLedNow(bargraphLookupTable(i_bargraph_status_alt));
-        b_bargraph_status[i_bargraph_status_alt] = true;
-
-        if(i_bargraph_status_alt > 23) {
-          vibrationWand(i_vibration_level + 80);
-        }
-        else if(i_bargraph_status_alt > 17) {
-          vibrationWand(i_vibration_level + 40);
-        }
-        else if(i_bargraph_status_alt > 11) {
-          vibrationWand(i_vibration_level + 30);
-        }
-        else if(i_bargraph_status_alt > 5) {
-          vibrationWand(i_vibration_level + 20);
-        }
-        else if(i_bargraph_status_alt > 0) {
-          vibrationWand(i_vibration_level + 10);
-        }
-
-        i_bargraph_status_alt++;
-
-        if(i_bargraph_status_alt == 30) {
-          // A little pause when we reach the top.
-          ms_bargraph.start(i_bargraph_wait / 2);
-
-          // Adjust the ramp down speed if necessary.
-          if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
-            i_bargraph_multiplier_current  = i_bargraph_multiplier_ramp_2021 / 2;
-          }
-        }
-        else {
-          ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-        }
-      break;
-
-      case 30 ... 59:
-        uint8_t i_tmp = i_bargraph_status_alt - (i_bargraph_segments - 1);
-        i_tmp = i_bargraph_segments - i_tmp;
-
-        if(WAND_ACTION_STATUS == ACTION_OVERHEATING || b_pack_alarm == true) {
-            vibrationOff();
-
-            ht_bargraph.clearLedNow(bargraphLookupTable(i_tmp));
-            b_bargraph_status[i_tmp] = false;
-
-            if(i_bargraph_status_alt == 59) {
-              ms_bargraph.stop();
-              b_bargraph_up = false;
-              i_bargraph_status_alt = 0;
-            }
-            else {
-              ms_bargraph.start(d_bargraph_ramp_interval_alt * 2);
-              i_bargraph_status_alt++;
-            }
-        }
-        else {
-          if((i_power_level < 5 && BARGRAPH_MODE == BARGRAPH_ORIGINAL) || BARGRAPH_MODE == BARGRAPH_SUPER_HERO) {
-            ht_bargraph.clearLedNow(bargraphLookupTable(i_tmp));
-            b_bargraph_status[i_tmp] = false;
-          }
-
-          switch(BARGRAPH_MODE) {
-            case BARGRAPH_SUPER_HERO:
-              // Bargraph has ramped up and down. In 1984/1989 mode we want to start the ramping.
-              if(i_bargraph_status_alt == 59) {
-                ms_bargraph_alt.start(i_bargraph_interval); // Start the alternate bargraph to ramp up and down continuously.
-                ms_bargraph.stop();
-                b_bargraph_up = true;
-                i_bargraph_status_alt = 0;
-                resetBargraphSpeed();
-
-                vibrationWand(i_vibration_level);
-              }
-              else {
-                ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                i_bargraph_status_alt++;
-              }
-            break;
+}
 
-            case BARGRAPH_ORIGINAL:
-              switch(i_power_level) {
-                case 5:
-                  if(i_bargraph_status_alt == 59) {
-                    ms_bargraph_alt.stop();
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 29;
-                    resetBargraphSpeed();
-
-                    vibrationWand(i_vibration_level + 25);
-                  }
-                  else {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 59 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+void cyclotronSpeedUp(uint8_t i_switch) {
+  if(i_switch != i_cyclotron_speed_up) {
+    if(i_switch == 4) {
+      // Tell pack to start beeping before we overheat it.
+      wandSerialSend(W_BEEP_START);
 
-                    vibrationWand(i_vibration_level + 25);
-                  }
-                break;
+      // Play overheat alert beeps before we overheat.
+      switch(getSystemYearMode()) {
+        case SYSTEM_AFTERLIFE:
+        case SYSTEM_FROZEN_EMPIRE:
+        default:
+          playEffect(S_PACK_BEEPS_OVERHEAT, true);
+        break;
 
-                case 4:
-                  if(i_bargraph_status_alt == 35) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 23;
-                    resetBargraphSpeed();
+        case SYSTEM_1984:
+        case SYSTEM_1989:
+          playEffect(S_BEEP_8, true);
+        break;
+      }
 
-                    vibrationWand(i_vibration_level + 30);
-                  }
-                  else if(i_bargraph_status_alt > 35) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 59 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+      ms_warning_blink.start(i_warning_blink_delay);
+    }
 
-                    vibrationWand(i_vibration_level + 30);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
+    i_cyclotron_speed_up++;
 
-                    vibrationWand(i_vibration_level + 12);
-                  }
-                break;
+    // Tell the pack to speed up the Cyclotron.
+    wandSerialSend(W_CYCLOTRON_INCREASE_SPEED);
+  }
+}
 
-                case 3:
-                  if(i_bargraph_status_alt == 41) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 17;
-                    resetBargraphSpeed();
+void stopOverheatBeepWarnings() {
+  // Stop overheat beeps.
+  switch(getSystemYearMode()) {
+    case SYSTEM_AFTERLIFE:
+    case SYSTEM_FROZEN_EMPIRE:
+    default:
+      stopEffect(S_PACK_BEEPS_OVERHEAT);
+    break;
 
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                  else if(i_bargraph_status_alt > 41) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 59 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+    case SYSTEM_1984:
+    case SYSTEM_1989:
+      stopEffect(S_BEEP_8);
+    break;
+  }
+}
 
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
+void cyclotronSpeedRevert() {
+  // Attenuator told us to reset, so stop beeps.
+  stopOverheatBeepWarnings();
 
-                    vibrationWand(i_vibration_level + 20);
-                  }
-                break;
+  i_cyclotron_speed_up = 1;
+}
 
-                case 2:
-                  if(i_bargraph_status_alt == 47) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 11;
-                    resetBargraphSpeed();
+// Afterlife and Frozen Empire mode for the 28 and 30 segment bargraph.
+// Checks if we ramp up or down when changing power levels.
+// Forces the bargraph to redraw itself to the current power level.
+void bargraphPowerCheck2021Alt(bool b_override) {
+  if((WAND_ACTION_STATUS != ACTION_FIRING && WAND_ACTION_STATUS != ACTION_SETTINGS && WAND_ACTION_STATUS != ACTION_OVERHEATING) || b_override == true) {
+    if(i_power_level != i_power_level_prev || b_override == true) {
+      if(i_power_level > i_power_level_prev) {
+        b_bargraph_up = true;
+      }
+      else {
+        b_bargraph_up = false;
+      }
 
-                    vibrationWand(i_vibration_level + 5);
-                  }
-                  else if(i_bargraph_status_alt > 47) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 59 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
+      switch(i_power_level) {
+        case 5:
+          ms_bargraph_alt.start(i_bargraph_wait / 3);
+        break;
 
-                    vibrationWand(i_vibration_level + 5);
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
+        case 4:
+          ms_bargraph_alt.start(i_bargraph_wait / 4);
+        break;
 
-                    vibrationWand(i_vibration_level + 10);
-                  }
-                break;
+        case 3:
+          ms_bargraph_alt.start(i_bargraph_wait / 5);
+        break;
 
-                case 1:
-                default:
-                  vibrationWand(i_vibration_level);
+        case 2:
+          ms_bargraph_alt.start(i_bargraph_wait / 6);
+        break;
 
-                  if(i_bargraph_status_alt == 53) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = false;
-                    i_bargraph_status_alt = 5;
-                    resetBargraphSpeed();
-                  }
-                  else if(i_bargraph_status_alt > 53) {
-                    ms_bargraph.stop();
-                    b_bargraph_up = true;
-                    i_bargraph_status_alt = 59 - i_bargraph_status_alt;
-                    resetBargraphSpeed();
-                  }
-                  else {
-                    ms_bargraph.start(i_bargraph_interval * i_bargraph_multiplier_current);
-                    i_bargraph_status_alt++;
-                  }
-                break;
-              }
-            break;
-          }
-        }
-      break;
+        case 1:
+        default:
+          ms_bargraph_alt.start(i_bargraph_wait / 7);
+        break;
+      }
     }
   }
-  else {
-    uint8_t t_bargraph_ramp_multiplier = 1;
+}
 
-    if(WAND_ACTION_STATUS == ACTION_OVERHEATING || b_pack_alarm == true) {
-      t_bargraph_ramp_multiplier = 2;
-    }
+void bargraphClearAll() {
+  ht_bargraph.clearAll();
 
-    switch(i_bargraph_status) {
-      case 0:
-        vibrationWand(i_vibration_level + 10);
+  for(uint8_t i = 0; i < i_bargraph_segments; i++) {
+    b_bargraph_status[i] = false;
+  }
+}
 
-        wandBargraphControl(1);
-        ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        i_bargraph_status++;
-      break;
+void bargraphClearAlt() {
+  bargraphSequencer.stop();
 
-      case 1:
-        vibrationWand(i_vibration_level + 20);
+  if(BARGRAPH_TYPE != SEGMENTS_5) {
+    bargraphClearAll();
 
-        wandBargraphControl(2);
-        ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        i_bargraph_status++;
-      break;
+    i_bargraph_status_alt = 0;
+  }
+}
 
-      case 2:
-        vibrationWand(i_vibration_level + 30);
+// Returns the top segment for a given power level for the 28 or 30 segment bargraphs.
+uint8_t bargraphPowerLookupTable(uint8_t index) {
+  if(BARGRAPH_TYPE == SEGMENTS_28) {
+    return PROGMEM_READU8(i_bargraph_power_table_28[index]);
+  }
+  else if(BARGRAPH_TYPE == SEGMENTS_30) {
+    return PROGMEM_READU8(i_bargraph_power_table_wamco[index]);
+  }
+  else {
+    return 1;
+  }
+}
 
-        wandBargraphControl(3);
-        ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        i_bargraph_status++;
-      break;
+// This function handles returning all bargraph lookup table values.
+uint8_t bargraphLookupTable(uint8_t index) {
+  if(BARGRAPH_TYPE == SEGMENTS_28) {
+    if(b_bargraph_invert) {
+      return PROGMEM_READU8(i_bargraph_invert[index]);
+    }
+    else {
+      return PROGMEM_READU8(i_bargraph_normal[index]);
+    }
+  }
+  else if(BARGRAPH_TYPE == SEGMENTS_30) {
+    if(b_bargraph_invert) {
+      return PROGMEM_READU8(i_bargraph_wamco_invert[index]);
+    }
+    else {
+      return PROGMEM_READU8(i_bargraph_wamco_normal[index]);
+    }
+  }
+  else {
+    if(b_bargraph_invert) {
+      return PROGMEM_READU8(i_bargraph_5_led_invert[index]);
+    }
+    else {
+      return PROGMEM_READU8(i_bargraph_5_led_normal[index]);
+    }
+  }
+}
 
-      case 3:
-        vibrationWand(i_vibration_level + 40);
+// Draw the bargraph to the current power level instantly.
+void bargraphRedraw() {
+  bargraphRampStart(bargraphRampLevel());
+}
 
-        wandBargraphControl(4);
-        ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        i_bargraph_status++;
-      break;
+// Bargraph idle animation. The 28 and 30 segment bargraphs ramp between empty and the power level in Super Hero mode, or ramp to the power level and stay there in Original mode.
+void bargraphPowerCheck() {
+  if(BARGRAPH_TYPE != SEGMENTS_5) {
+    if(ms_bargraph_alt.justFinished()) {
+      uint8_t i_bargraph_multiplier[5] = { 7, 6, 5, 4, 3 };
+      uint8_t i_frames;
 
-      case 4:
-        vibrationWand(i_vibration_level + 80);
+      if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
+        for(uint8_t i = 0; i <= 4; i++) {
+          i_bargraph_multiplier[i] = 10;
+        }
+      }
 
-        wandBargraphControl(5);
+      if(!bargraphSequencer.isPlaying(bargraphRampTrack(i_frames))) {
+        bargraphRedraw();
+      }
 
-        if(i_bargraph_status + 1 == i_power_level && WAND_ACTION_STATUS != ACTION_OVERHEATING) {
-          ms_bargraph.stop();
-          i_bargraph_status = 0;
+      if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
+        if(bargraphRampStep(bargraphRampLevel())) {
+          // We stop when we reach our target.
+          ms_bargraph_alt.stop();
+          b_bargraph_up = false;
         }
         else {
-          i_bargraph_status++;
-          ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
+          ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
         }
-      break;
+      }
+      else if(bargraphRampStep(b_bargraph_up ? bargraphRampLevel() : 0)) {
+        // A little pause when we reach the top or the bottom.
+        b_bargraph_up = !b_bargraph_up;
+        ms_bargraph_alt.start(i_bargraph_wait / 2);
+      }
+      else {
+        ms_bargraph_alt.start(i_bargraph_interval * i_bargraph_multiplier[i_power_level - 1]);
+      }
+    }
+  }
+  else {
+    // Stock haslab bargraph. Redrawn on every pass, as the settings menus write to it directly.
+    bargraphRedraw();
+  }
+}
 
-      case 5:
-        vibrationWand(i_vibration_level + 40);
+// Start-up ramp of the bargraph, moving on by one frame per call. It climbs to full then falls back to empty in Super Hero mode, or to the power level in Original mode.
+// When overheating or when the ribbon cable is removed it falls from full to empty (the Hasbro bargraph stops at the power level for the ribbon cable).
+void bargraphRampUp() {
+  if(i_vibration_level < i_vibration_level_min) {
+    i_vibration_level = i_vibration_level_min;
+  }
 
-        wandBargraphControl(4);
+  const uint8_t i_fall_vibration[5] = { 0, 10, 20, 12, 0 };
+  const uint8_t i_stop_vibration[5] = { 0, 5, 10, 30, 25 };
+  bool b_alarm = (WAND_ACTION_STATUS == ACTION_OVERHEATING || b_pack_alarm == true);
+  uint16_t i_interval = i_bargraph_interval * i_bargraph_multiplier_current;
+  uint8_t i_target = 0;
+  uint8_t i_frames;
 
-        if(i_bargraph_status - 1 == i_power_level && WAND_ACTION_STATUS != ACTION_OVERHEATING) {
-          ms_bargraph.stop();
-          i_bargraph_status = 0;
-        }
-        else {
-          i_bargraph_status++;
-          ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        }
-      break;
+  if(!bargraphSequencer.isPlaying(bargraphRampTrack(i_frames))) {
+    // The Hasbro bargraph carries on from i_bargraph_status, which is left at the power level after firing.
+    bargraphRampStart(BARGRAPH_TYPE == SEGMENTS_5 ? i_bargraph_status : 0);
+    b_bargraph_up = true;
+  }
 
-      case 6:
-        vibrationWand(i_vibration_level + 30);
+  if(BARGRAPH_TYPE == SEGMENTS_5) {
+    i_interval = d_bargraph_ramp_interval * (b_alarm ? 2 : 1);
 
-        wandBargraphControl(3);
+    if(WAND_ACTION_STATUS != ACTION_OVERHEATING) {
+      i_target = i_power_level;
+    }
+  }
+  else if(b_alarm) {
+    if(!b_bargraph_up) {
+      i_interval = d_bargraph_ramp_interval_alt * 2;
+    }
+  }
+  else if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
+    i_target = bargraphRampLevel();
+  }
 
-        if(i_bargraph_status - 3 == i_power_level && WAND_ACTION_STATUS != ACTION_OVERHEATING) {
-          ms_bargraph.stop();
-          i_bargraph_status = 0;
-        }
-        else {
-          i_bargraph_status++;
-          ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-        }
-      break;
+  if(b_bargraph_up) {
+    bool b_full = bargraphRampStep(i_frames - 1);
+
+    if(bargraphSequencer.cue() > 0) {
+      vibrationWand(i_vibration_level + bargraphSequencer.cue());
+    }
 
-      case 7:
-        vibrationWand(i_vibration_level + 20);
+    if(!b_full) {
+      ms_bargraph.start(i_interval);
+      return;
+    }
 
-        wandBargraphControl(2);
+    b_bargraph_up = false;
 
-        if(i_bargraph_status - 5 == i_power_level && WAND_ACTION_STATUS != ACTION_OVERHEATING) {
-          ms_bargraph.stop();
-          i_bargraph_status = 0;
-        }
-        else {
-          i_bargraph_status++;
-          ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
+    if(i_target < i_frames - 1) {
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        // A little pause when we reach the top.
+        i_interval = i_bargraph_wait / 2;
+
+        // Adjust the ramp down speed if necessary.
+        if(BARGRAPH_MODE == BARGRAPH_ORIGINAL) {
+          i_bargraph_multiplier_current = i_bargraph_multiplier_ramp_2021 / 2;
         }
-      break;
+      }
 
-      case 8:
-        vibrationWand(i_vibration_level + 10);
+      ms_bargraph.start(i_interval);
+      return;
+    }
+  }
+  else {
+    bool b_done = bargraphRampStep(i_target);
 
-        wandBargraphControl(1);
+    if(b_alarm) {
+      vibrationOff();
+    }
+    else if(BARGRAPH_TYPE == SEGMENTS_5) {
+      if(bargraphSequencer.cue() > 0) {
+        vibrationWand(i_vibration_level + bargraphSequencer.cue());
+      }
+    }
+    else if(BARGRAPH_MODE == BARGRAPH_ORIGINAL && !b_done) {
+      vibrationWand(i_vibration_level + i_fall_vibration[i_power_level - 1]);
+    }
 
-        if(i_bargraph_status - 7 == i_power_level && WAND_ACTION_STATUS != ACTION_OVERHEATING) {
-          ms_bargraph.stop();
-          i_bargraph_status = 0;
-        }
-        else {
-          ms_bargraph.start(d_bargraph_ramp_interval * t_bargraph_ramp_multiplier);
-          i_bargraph_status++;
-        }
-      break;
+    if(!b_done) {
+      ms_bargraph.start(i_interval);
+      return;
+    }
+  }
 
-      case 9:
-        wandBargraphControl(0);
+  // The ramp has finished.
+  ms_bargraph.stop();
 
-        ms_bargraph.stop();
-        i_bargraph_status = 0;
-      break;
+  if(b_alarm || BARGRAPH_TYPE == SEGMENTS_5) {
+    b_bargraph_up = false;
+    i_bargraph_status = 0;
+  }
+  else if(BARGRAPH_MODE == BARGRAPH_SUPER_HERO) {
+    // Bargraph has ramped up and down. In 1984/1989 mode we want to start the ramping.
+    ms_bargraph_alt.start(i_bargraph_interval); // Start the alternate bargraph to ramp up and down continuously.
+    b_bargraph_up = true;
+    resetBargraphSpeed();
+
+    vibrationWand(i_vibration_level);
+  }
+  else {
+    if(i_power_level == i_power_level_max) {
+      ms_bargraph_alt.stop();
     }
+
+    b_bargraph_up = false;
+    resetBargraphSpeed();
+
+    vibrationWand(i_vibration_level + i_stop_vibration[i_power_level - 1]);
   }
 }
 
@@ -9225,16 +6221,9 @@ void prepBargraphRampDown() {
     soundIdleStop();
     soundIdleLoopStop(true);
 
-    uint8_t i_segment_adjust = 2;
-    if(BARGRAPH_TYPE == SEGMENTS_30) {
-      i_segment_adjust = 0;
-    }
-
-    // Reset some bargraph levels before we ramp the bargraph down.
-    i_bargraph_status_alt = i_bargraph_segments - i_segment_adjust; // For 28 and 30 segment bargraph
-    i_bargraph_status = i_bargraph_segments_5_led; // For Hasbro 5 LED bargraph.
-
-    bargraphFull();
+    // Start the ramp down from a full bargraph.
+    bargraphRampStart(bargraphRampFull());
+    b_bargraph_up = false;
 
     ms_bargraph.start(d_bargraph_ramp_interval);
 
@@ -9436,10 +6425,9 @@ void wandBargraphControl(uint8_t i_t_level) {
 }
 
 void wandLightsOff() {
-  if(BARGRAPH_TYPE != SEGMENTS_5) {
-    bargraphClearAlt();
-  }
-  else {
+  bargraphClearAlt();
+
+  if(BARGRAPH_TYPE == SEGMENTS_5) {
     wandBargraphControl(0);
   }
 
@@ -19,107 +19,200 @@
 
 #pragma once
 
-// Types of packets to be sent.
-enum PACKET_TYPE : uint8_t {
-  PACKET_UNKNOWN = 0,
-  PACKET_COMMAND = 1,
-  PACKET_DATA = 2,
-  PACKET_PACK = 3,
-  PACKET_WAND = 4,
-  PACKET_SMOKE = 5,
-  PACKET_SYNC = 6
-};
+struct CommandPacket sendCmd;
+struct CommandPacket recvCmd;
+
+struct MessagePacket sendData;
+struct MessagePacket recvData;
 
-// For command signals (1 byte ID, 2 byte optional data).
-struct __attribute__((packed)) CommandPacket {
-  uint8_t s;
-  uint8_t c;
-  uint16_t d1; // Reserved for values over 255 (eg. current music track)
-  uint8_t e;
+/*
+ * Serial link speed negotiation.
+ * The link always starts at 9600 baud. Every handshake from the wand advertises a bitmask of the faster
+ * rates it supports, and the pack may answer with a handshake naming the single rate to be used. Once
+ * running faster, the pack echoes each heartbeat at that rate; the wand drops back to 9600 on repeated
+ * CRC/framing errors or when nothing valid has been heard from the pack for too long.
+ */
+enum BAUD_RATE_OPTIONS : uint8_t {
+  BAUD_RATE_DEFAULT = 0, // 9600
+  BAUD_RATE_57600 = 1,
+  BAUD_RATE_115200 = 2
 };
 
-struct CommandPacket sendCmd;
-struct CommandPacket recvCmd;
+const uint8_t i_baud_rates_supported = BAUD_RATE_57600 | BAUD_RATE_115200;
+const uint8_t i_baud_error_limit = 3; // Consecutive receive errors allowed before the link falls back to 9600.
+const uint16_t i_baud_silence_delay = 8000; // Time without a good packet before the link falls back to 9600.
+uint8_t i_pack_baud_rate = BAUD_RATE_DEFAULT; // Currently active rate for the link to the pack.
+uint8_t i_pack_link_errors = 0; // Consecutive receive errors seen at the active rate.
+millisDelay ms_pack_link_check; // Restarted by every good packet while running faster than 9600.
+
+struct WandPrefs wandConfig;
 
-// For generic data communication (1 byte ID, 4 byte array).
-struct __attribute__((packed)) MessagePacket {
-  uint8_t s;
-  uint8_t m;
-  uint8_t d[3]; // Reserved for multiple, arbitrary byte values.
-  uint8_t e;
+struct SmokePrefs smokeConfig;
+
+struct WandSyncData wandSyncData;
+
+/*
+ * Acknowledged delivery of critical packets to the pack.
+ * A packet which must not be lost (eg. the sync confirmation and overheat/venting transitions) is wrapped in a
+ * PACKET_RELIABLE frame carrying a sequence number, which the pack answers with a PACKET_ACK naming that
+ * number. One frame is in flight at a time and is resent until acknowledged, so a dropped packet costs one
+ * retry delay rather than a full resync. A repeated sequence number is acknowledged again but not acted on.
+ * The pack flags its support in the value of P_SYNC_END, and the wand flags its own in every handshake.
+ */
+const uint8_t i_link_reliable_supported = 0x80; // Capability flag, kept clear of the baud rate bits in a handshake.
+const uint8_t i_link_capabilities = i_baud_rates_supported | i_link_reliable_supported; // Value sent with W_HANDSHAKE.
+const uint8_t i_reliable_queue_size = 4;
+const uint8_t i_reliable_retry_delay = 50; // Time to wait for an acknowledgement before sending again.
+const uint8_t i_reliable_retry_max = 5; // Resends allowed before a frame is abandoned.
+const uint8_t i_reliable_payload_max = sizeof(WandPrefs) > sizeof(SmokePrefs) ? sizeof(WandPrefs) : sizeof(SmokePrefs);
+
+struct ReliableFrame {
+  uint8_t seq;
+  uint8_t type;
+  uint8_t length;
+  uint8_t d[i_reliable_payload_max];
 };
 
-struct MessagePacket sendData;
-struct MessagePacket recvData;
+struct ReliableChannel {
+  struct ReliableFrame frames[i_reliable_queue_size];
+  uint8_t count = 0;
+  uint8_t i_tx_seq = 0; // Last sequence number given to an outgoing frame (never 0).
+  uint8_t i_rx_seq = 0; // Last sequence number handled from the pack.
+  uint8_t i_retries = 0; // Resends of the frame currently in flight.
+  bool b_waiting = false; // The first frame has been sent and is awaiting acknowledgement.
+  bool b_peer_ready = false; // The pack has shown it understands reliable frames.
+  millisDelay ms_retry;
+};
 
-struct __attribute__((packed)) WandPrefs {
-  uint8_t ledWandCount;
-  uint8_t ledWandHue;
-  uint8_t ledWandSat;
-  uint8_t rgbVentEnabled;
-  uint8_t spectralModesEnabled;
-  uint8_t overheatEnabled;
-  uint8_t defaultFiringMode;
-  uint8_t wandVibration;
-  uint8_t wandSoundsToPack;
-  uint8_t quickVenting;
-  uint8_t autoVentLight;
-  uint8_t wandBeepLoop;
-  uint8_t wandBootError;
-  uint8_t defaultYearModeWand;
-  uint8_t defaultYearModeCTS;
-  uint8_t numBargraphSegments;
-  uint8_t invertWandBargraph;
-  uint8_t bargraphOverheatBlink;
-  uint8_t bargraphIdleAnimation;
-  uint8_t bargraphFireAnimation;
-} wandConfig;
-
-struct __attribute__((packed)) SmokePrefs {
-  // Pack
-  uint8_t smokeEnabled;
-  uint8_t overheatContinuous5;
-  uint8_t overheatContinuous4;
-  uint8_t overheatContinuous3;
-  uint8_t overheatContinuous2;
-  uint8_t overheatContinuous1;
-  uint8_t overheatDuration5;
-  uint8_t overheatDuration4;
-  uint8_t overheatDuration3;
-  uint8_t overheatDuration2;
-  uint8_t overheatDuration1;
-  // Wand
-  uint8_t overheatLevel5;
-  uint8_t overheatLevel4;
-  uint8_t overheatLevel3;
-  uint8_t overheatLevel2;
-  uint8_t overheatLevel1;
-  uint8_t overheatDelay5;
-  uint8_t overheatDelay4;
-  uint8_t overheatDelay3;
-  uint8_t overheatDelay2;
-  uint8_t overheatDelay1;
-} smokeConfig;
-
-struct __attribute__((packed)) WandSyncData {
-  uint8_t systemMode;
-  uint8_t ionArmSwitch;
-  uint8_t cyclotronLidState;
-  uint8_t systemYear;
-  uint8_t packOn;
-  uint8_t powerLevel;
-  uint8_t streamMode;
-  uint8_t vibrationEnabled;
-  uint8_t masterVolume;
-  uint8_t effectsVolume;
-  uint8_t masterMuted;
-  uint8_t repeatMusicTrack;
-} wandSyncData;
+struct ReliableChannel packReliable;
 
 /*
  * Serial API Communication Handlers
  */
 
+// Clears the reliable channel, as done whenever the pack starts a new synchronization.
+void reliableReset() {
+  packReliable.count = 0;
+  packReliable.i_rx_seq = 0;
+  packReliable.i_retries = 0;
+  packReliable.b_waiting = false;
+  packReliable.b_peer_ready = false;
+  packReliable.ms_retry.stop();
+}
+
+// Queues a packet for acknowledged delivery. Returns false when the pack cannot take it or the queue is full.
+bool reliableQueue(uint8_t i_type, const void *data, uint8_t i_length) {
+  if(!packReliable.b_peer_ready || packReliable.count >= i_reliable_queue_size || i_length > i_reliable_payload_max) {
+    return false;
+  }
+
+  packReliable.i_tx_seq++;
+
+  if(packReliable.i_tx_seq == 0) {
+    // Zero is never used, so a freshly reset receiver cannot mistake the first frame for a repeat.
+    packReliable.i_tx_seq = 1;
+  }
+
+  packReliable.frames[packReliable.count].seq = packReliable.i_tx_seq;
+  packReliable.frames[packReliable.count].type = i_type;
+  packReliable.frames[packReliable.count].length = i_length;
+  memcpy(packReliable.frames[packReliable.count].d, data, i_length);
+  packReliable.count++;
+
+  return true;
+}
+
+// Writes the frame at the head of the queue and starts waiting for its acknowledgement.
+void reliableWrite() {
+  struct ReliableHeader header = {packReliable.frames[0].seq, packReliable.frames[0].type};
+  uint16_t i_send_size = wandComs.txObj(header);
+
+  i_send_size = wandComs.txObj(packReliable.frames[0].d, i_send_size, packReliable.frames[0].length);
+  wandComs.sendData(i_send_size, (uint8_t) PACKET_RELIABLE);
+
+  packReliable.b_waiting = true;
+  packReliable.ms_retry.start(i_reliable_retry_delay);
+}
+
+// Removes the frame at the head of the queue.
+void reliablePop() {
+  for(uint8_t i = 1; i < packReliable.count; i++) {
+    packReliable.frames[i - 1] = packReliable.frames[i];
+  }
+
+  packReliable.count--;
+  packReliable.i_retries = 0;
+  packReliable.b_waiting = false;
+  packReliable.ms_retry.stop();
+}
+
+// Sends the next waiting frame, or resends the one in flight once its retry delay has passed.
+void reliableService() {
+  if(packReliable.count == 0) {
+    return;
+  }
+
+  if(packReliable.b_waiting) {
+    if(!packReliable.ms_retry.justFinished()) {
+      return;
+    }
+
+    if(packReliable.i_retries >= i_reliable_retry_max) {
+      // The pack is not answering, so give up on this frame and leave it to the next resync.
+      reliablePop();
+
+      if(packReliable.count == 0) {
+        return;
+      }
+    }
+    else {
+      packReliable.i_retries++;
+    }
+  }
+
+  reliableWrite();
+}
+
+// Releases the frame in flight if the pack has acknowledged it, then sends the next one.
+void reliableAcknowledged(uint8_t i_seq) {
+  if(packReliable.b_waiting && packReliable.count > 0 && packReliable.frames[0].seq == i_seq) {
+    reliablePop();
+    reliableService();
+  }
+}
+
+// Acknowledges a received frame. Returns true when it has not been seen before and should be handled.
+bool reliableReceived(uint8_t i_seq) {
+  // Always answer, as it may have been our previous acknowledgement which was lost.
+  uint16_t i_send_size = wandComs.txObj(i_seq);
+  wandComs.sendData(i_send_size, (uint8_t) PACKET_ACK);
+
+  packReliable.b_peer_ready = true;
+
+  if(i_seq == packReliable.i_rx_seq) {
+    return false;
+  }
+
+  packReliable.i_rx_seq = i_seq;
+
+  return true;
+}
+
+// Commands whose loss would leave the pack out of step with the wand until the next resync.
+bool wandSerialSendReliable(uint8_t i_command) {
+  switch(i_command) {
+    case W_SYNCHRONIZED:
+    case W_OVERHEATING:
+    case W_VENTING:
+      return true;
+    break;
+
+    default:
+      return false;
+    break;
+  }
+}
+
 // Outgoing commands to the pack.
 void wandSerialSend(uint8_t i_command, uint16_t i_value) {
   uint16_t i_send_size = 0;
@@ -142,6 +235,11 @@ void wandSerialSend(uint8_t i_command, uint16_t i_value) {
     ms_handshake.restart();
   }
 
+  if(wandSerialSendReliable(i_command) && reliableQueue(PACKET_COMMAND, &sendCmd, sizeof(sendCmd))) {
+    reliableService();
+    return;
+  }
+
   i_send_size = wandComs.txObj(sendCmd);
   wandComs.sendData(i_send_size, (uint8_t) PACKET_COMMAND);
 }
@@ -331,465 +429,557 @@ void wandSerialSendData(uint8_t i_message) {
   }
 }
 
-// Forward function declaration.
-bool handlePackCommand(uint8_t i_command, uint16_t i_value);
+uint32_t baudRateValue(uint8_t i_rate) {
+  switch(i_rate) {
+    case BAUD_RATE_115200:
+      return 115200;
+    break;
 
-// Pack communication to the wand.
-void checkPack() {
-  // Leave when a pack is not intended to be connected.
-  if(b_gpstar_benchtest == true) {
-    return;
+    case BAUD_RATE_57600:
+      return 57600;
+    break;
+
+    default:
+      return 9600;
+    break;
   }
+}
 
-  if(wandComs.available() > 0) {
-    uint8_t i_packet_id = wandComs.currentPacketID();
-    // debug(F("PacketID: "));
-    // debugln(i_packet_id);
+// Re-opens the UART to the pack at a new rate once anything queued at the old rate has been fully sent.
+void setPackBaudRate(uint8_t i_rate) {
+  debug(F("Pack link switching to "));
+  debugln(baudRateValue(i_rate));
 
-    if(i_packet_id > 0) {
-      // Determine the type of packet which was sent by the serial1 device.
-      switch(i_packet_id) {
-        case PACKET_COMMAND:
-          wandComs.rxObj(recvCmd);
-          if(recvCmd.c > 0 && recvCmd.s == P_COM_START && recvCmd.e == P_COM_END) {
-            debug(F("Recv. Command: "));
-            debugln(recvCmd.c);
-            if(handlePackCommand(recvCmd.c, recvCmd.d1)) {
-              // Begin timer for future keepalive handshakes from the wand.
-              ms_handshake.start(i_heartbeat_delay);
-
-              // Turn off the sync indicator LED as the sync is completed.
-              ventLedTopControl(false);
-              digitalWriteFast(WAND_STATUS_LED_PIN, LOW);
-
-              // Indicate that a pack is now connected.
-              WAND_CONN_STATE = PACK_CONNECTED;
-            }
-          }
-          else if(recvCmd.s == W_COM_START && recvCmd.c == W_SYNC_NOW && recvCmd.d1 == 0 && recvCmd.e == W_COM_END) {
-            // We just received our own heartbeat echoed back, so switch to standalone mode.
-            WAND_CONN_STATE = NC_BENCHTEST;
-            b_gpstar_benchtest = true;
-            b_pack_on = true; // Pretend that the pack (not really attached) has been powered on.
+  Serial1.flush();
+  Serial1.end();
+  Serial1.begin(baudRateValue(i_rate));
+  wandComs.reset(); // Discard any partial packet received at the old rate.
 
-            // Turn off the sync indicator LED as it is no longer necessary.
-            ventLedTopControl(false);
-            digitalWriteFast(WAND_STATUS_LED_PIN, LOW);
+  i_pack_baud_rate = i_rate;
+  i_pack_link_errors = 0;
 
-            // Reset the audio device now that we are in standalone mode and need music playback.
-            setupAudioDevice();
+  if(i_rate != BAUD_RATE_DEFAULT) {
+    ms_pack_link_check.start(i_baud_silence_delay);
+  }
+  else {
+    ms_pack_link_check.stop();
+  }
+}
 
-            // Start the music check timer for standalone mode.
-            ms_check_music.start(i_music_check_delay);
+// Falls back to 9600 when a faster link is producing errors or has gone quiet.
+void checkPackLinkSpeed(int8_t i_status) {
+  if(i_pack_baud_rate == BAUD_RATE_DEFAULT) {
+    return;
+  }
 
-            // Re-read the EEPROM now that we are in standalone mode to make sure system mode and volume are correct.
-            if(b_eeprom) {
-              readEEPROM();
-            }
+  if(i_status <= CRC_ERROR && i_pack_link_errors < 255) {
+    i_pack_link_errors++;
+  }
 
-            // Sanity check to make sure that a firing mode was set as default.
-            if(FIRING_MODE != CTS_MODE && FIRING_MODE != CTS_MIX_MODE) {
-              FIRING_MODE = VG_MODE;
-              LAST_FIRING_MODE = FIRING_MODE;
-            }
+  if(i_pack_link_errors >= i_baud_error_limit || ms_pack_link_check.justFinished()) {
+    setPackBaudRate(BAUD_RATE_DEFAULT);
+  }
+}
 
-            // Check if we should be in video game mode or not.
-            vgModeCheck();
+// Forward function declaration.
+bool handlePackCommand(uint8_t i_command, uint16_t i_value);
 
-            // Reset the bargraph.
-            bargraphYearModeUpdate();
+// Handles a packet from the pack whose contents begin at the given offset (after the header of a reliable frame).
+void handlePackPacket(uint8_t i_packet_id, uint16_t i_offset) {
+  switch(i_packet_id) {
+    case PACKET_COMMAND:
+      wandComs.rxObj(recvCmd, i_offset);
+      if(recvCmd.c > 0 && recvCmd.s == P_COM_START && recvCmd.e == P_COM_END) {
+        debug(F("Recv. Command: "));
+        debugln(recvCmd.c);
+        if(handlePackCommand(recvCmd.c, recvCmd.d1)) {
+          // Begin timer for future keepalive handshakes from the wand.
+          ms_handshake.start(i_heartbeat_delay);
+
+          // Turn off the sync indicator LED as the sync is completed.
+          ventLedTopControl(false);
+          digitalWriteFast(WAND_STATUS_LED_PIN, LOW);
+
+          // Indicate that a pack is now connected.
+          WAND_CONN_STATE = PACK_CONNECTED;
+        }
+      }
+      else if(recvCmd.s == W_COM_START && recvCmd.c == W_SYNC_NOW && recvCmd.d1 == 0 && recvCmd.e == W_COM_END) {
+        // We just received our own heartbeat echoed back, so switch to standalone mode.
+        WAND_CONN_STATE = NC_BENCHTEST;
+        b_gpstar_benchtest = true;
+        b_pack_on = true; // Pretend that the pack (not really attached) has been powered on.
 
-            // Stop the pack sync timer since we are no longer syncing to a pack.
-            ms_packsync.stop();
+        // Turn off the sync indicator LED as it is no longer necessary.
+        ventLedTopControl(false);
+        digitalWriteFast(WAND_STATUS_LED_PIN, LOW);
 
-            // No pack to do a volume sync with, so reset our master volume manually.
-            updateMasterVolume(true);
+        // Reset the audio device now that we are in standalone mode and need music playback.
+        setupAudioDevice();
 
-            // Immediately exit the serial data functions.
-            return;
-          }
-        break;
+        // Start the music check timer for standalone mode.
+        ms_check_music.start(i_music_check_delay);
 
-        case PACKET_DATA:
-          wandComs.rxObj(recvData);
-          if(recvData.m > 0 && recvData.s == P_COM_START && recvData.e == P_COM_END) {
-            debug(F("Recv. Message: "));
-            debugln(recvData.m);
+        // Re-read the EEPROM now that we are in standalone mode to make sure system mode and volume are correct.
+        if(b_eeprom) {
+          readEEPROM();
+        }
 
-            switch(recvData.m) {
-              default:
-                // Nothing here yet.
-              break;
-            }
-          }
-        break;
+        // Sanity check to make sure that a firing mode was set as default.
+        if(FIRING_MODE != CTS_MODE && FIRING_MODE != CTS_MIX_MODE) {
+          FIRING_MODE = VG_MODE;
+          LAST_FIRING_MODE = FIRING_MODE;
+        }
 
-        case PACKET_WAND:
-          wandComs.rxObj(wandConfig);
-          debugln(F("Recv. Wand Config"));
+        // Check if we should be in video game mode or not.
+        vgModeCheck();
 
-          // Writes new preferences back to runtime variables.
-          // This action does not save changes to the EEPROM!
-          // Entering the EEPROM menu afterwards and saving settings will.
-          switch(wandConfig.ledWandCount) {
-            case 0:
-            default:
-              WAND_BARREL_LED_COUNT = LEDS_5;
-              i_num_barrel_leds = 5; // Stock count for Haslab equipment.
-            break;
+        // Reset the bargraph.
+        bargraphYearModeUpdate();
 
-            case 1:
-              WAND_BARREL_LED_COUNT = LEDS_48;
-              i_num_barrel_leds = 48; // Total count is 49, with 1 for the tip.
-            break;
+        // Stop the pack sync timer since we are no longer syncing to a pack.
+        ms_packsync.stop();
 
-            case 2:
-              WAND_BARREL_LED_COUNT = LEDS_50;
-              i_num_barrel_leds = 48; // Total count is 50, with 2 for the tip.
-            break;
+        // No pack to do a volume sync with, so reset our master volume manually.
+        updateMasterVolume(true);
 
-            case 3:
-              WAND_BARREL_LED_COUNT = LEDS_2;
-              i_num_barrel_leds = 2; // Device is tip-only.
-            break;
-          }
+        // Immediately exit the serial data functions.
+        return;
+      }
+    break;
 
-          b_overheat_enabled = (wandConfig.overheatEnabled == 1);
-          i_spectral_wand_custom_colour = wandConfig.ledWandHue;
-          i_spectral_wand_custom_saturation = wandConfig.ledWandSat;
-          b_spectral_mode_enabled = (wandConfig.spectralModesEnabled == 1);
-          b_spectral_custom_mode_enabled = b_spectral_mode_enabled;
-          b_holiday_mode_enabled = b_spectral_mode_enabled;
+    case PACKET_DATA:
+      wandComs.rxObj(recvData, i_offset);
+      if(recvData.m > 0 && recvData.s == P_COM_START && recvData.e == P_COM_END) {
+        debug(F("Recv. Message: "));
+        debugln(recvData.m);
 
-          switch(wandConfig.defaultFiringMode) {
-            case 1:
-            default:
-              // Default: Video Game
-              FIRING_MODE = VG_MODE;
-              setVGMode();
-              wandSerialSend(W_VIDEO_GAME_MODE);
-            break;
+        switch(recvData.m) {
+          default:
+            // Nothing here yet.
+          break;
+        }
+      }
+    break;
 
-            case 2:
-              // Cross the Streams (CTS)
-              FIRING_MODE = CTS_MODE;
+    case PACKET_WAND:
+      wandComs.rxObj(wandConfig, i_offset);
+      debugln(F("Recv. Wand Config"));
 
-              // Force into Proton mode.
-              STREAM_MODE = PROTON;
-              wandSerialSend(W_PROTON_MODE);
-              wandSerialSend(W_CROSS_THE_STREAMS);
-            break;
+      // Writes new preferences back to runtime variables.
+      // This action does not save changes to the EEPROM!
+      // Entering the EEPROM menu afterwards and saving settings will.
+      switch(wandConfig.ledWandCount) {
+        case 0:
+        default:
+          WAND_BARREL_LED_COUNT = LEDS_5;
+          i_num_barrel_leds = 5; // Stock count for Haslab equipment.
+        break;
 
-            case 3:
-              // CTS Mix
-              FIRING_MODE = CTS_MIX_MODE;
+        case 1:
+          WAND_BARREL_LED_COUNT = LEDS_48;
+          i_num_barrel_leds = 48; // Total count is 49, with 1 for the tip.
+        break;
 
-              // Force into Proton mode.
-              STREAM_MODE = PROTON;
-              wandSerialSend(W_PROTON_MODE);
-              wandSerialSend(W_CROSS_THE_STREAMS_MIX);
-            break;
-          }
+        case 2:
+          WAND_BARREL_LED_COUNT = LEDS_50;
+          i_num_barrel_leds = 48; // Total count is 50, with 2 for the tip.
+        break;
 
-          LAST_FIRING_MODE = FIRING_MODE;
+        case 3:
+          WAND_BARREL_LED_COUNT = LEDS_2;
+          i_num_barrel_leds = 2; // Device is tip-only.
+        break;
+      }
 
-          switch(wandConfig.wandVibration) {
-            case 1:
-              b_vibration_switch_on = true; // Override the Proton Pack vibration toggle switch.
-              VIBRATION_MODE_EEPROM = VIBRATION_ALWAYS;
-              VIBRATION_MODE = VIBRATION_MODE_EEPROM;
-            break;
+      b_overheat_enabled = (wandConfig.overheatEnabled == 1);
+      i_spectral_wand_custom_colour = wandConfig.ledWandHue;
+      i_spectral_wand_custom_saturation = wandConfig.ledWandSat;
+      b_spectral_mode_enabled = (wandConfig.spectralModesEnabled == 1);
+      b_spectral_custom_mode_enabled = b_spectral_mode_enabled;
+      b_holiday_mode_enabled = b_spectral_mode_enabled;
 
-            case 2:
-              b_vibration_switch_on = true; // Override the Proton Pack vibration toggle switch.
-              VIBRATION_MODE_EEPROM = VIBRATION_FIRING_ONLY;
-              VIBRATION_MODE = VIBRATION_MODE_EEPROM;
-            break;
+      switch(wandConfig.defaultFiringMode) {
+        case 1:
+        default:
+          // Default: Video Game
+          FIRING_MODE = VG_MODE;
+          setVGMode();
+          wandSerialSend(W_VIDEO_GAME_MODE);
+        break;
 
-            case 3:
-              VIBRATION_MODE_EEPROM = VIBRATION_NONE;
-              VIBRATION_MODE = VIBRATION_MODE_EEPROM;
-            break;
+        case 2:
+          // Cross the Streams (CTS)
+          FIRING_MODE = CTS_MODE;
 
-            case 4:
-            default:
-              VIBRATION_MODE_EEPROM = VIBRATION_DEFAULT;
-              VIBRATION_MODE = VIBRATION_FIRING_ONLY;
-            break;
-          }
+          // Force into Proton mode.
+          STREAM_MODE = PROTON;
+          wandSerialSend(W_PROTON_MODE);
+          wandSerialSend(W_CROSS_THE_STREAMS);
+        break;
 
-          b_extra_pack_sounds = (wandConfig.wandSoundsToPack == 1);
-          b_quick_vent = (wandConfig.quickVenting == 1);
-          b_vent_light_control = (wandConfig.autoVentLight == 1);
-          b_beep_loop = (wandConfig.wandBeepLoop == 1);
-          b_wand_boot_errors = (wandConfig.wandBootError == 1);
+        case 3:
+          // CTS Mix
+          FIRING_MODE = CTS_MIX_MODE;
 
-          switch(wandConfig.defaultYearModeWand) {
-            case 1:
-            default:
-              WAND_YEAR_MODE = YEAR_DEFAULT;
-            break;
-            case 2:
-              WAND_YEAR_MODE = YEAR_1984;
-            break;
-            case 3:
-              WAND_YEAR_MODE = YEAR_1989;
-            break;
-            case 4:
-              WAND_YEAR_MODE = YEAR_AFTERLIFE;
-            break;
-            case 5:
-              WAND_YEAR_MODE = YEAR_FROZEN_EMPIRE;
-            break;
-          }
+          // Force into Proton mode.
+          STREAM_MODE = PROTON;
+          wandSerialSend(W_PROTON_MODE);
+          wandSerialSend(W_CROSS_THE_STREAMS_MIX);
+        break;
+      }
 
-          switch(wandConfig.defaultYearModeCTS) {
-            case 1:
-            default:
-              WAND_YEAR_CTS = CTS_DEFAULT;
-            break;
-            case 2:
-              WAND_YEAR_CTS = CTS_1984;
-            break;
-            case 4:
-              WAND_YEAR_CTS = CTS_AFTERLIFE;
-            break;
-          }
+      LAST_FIRING_MODE = FIRING_MODE;
 
-          b_bargraph_invert = (wandConfig.invertWandBargraph == 1);
-          b_overheat_bargraph_blink = (wandConfig.bargraphOverheatBlink == 1);
+      switch(wandConfig.wandVibration) {
+        case 1:
+          b_vibration_switch_on = true; // Override the Proton Pack vibration toggle switch.
+          VIBRATION_MODE_EEPROM = VIBRATION_ALWAYS;
+          VIBRATION_MODE = VIBRATION_MODE_EEPROM;
+        break;
 
-          switch(wandConfig.numBargraphSegments) {
-            case 28:
-            default:
-              BARGRAPH_TYPE_EEPROM = SEGMENTS_28;
-            break;
-            case 30:
-              BARGRAPH_TYPE_EEPROM = SEGMENTS_30;
-            break;
-          }
+        case 2:
+          b_vibration_switch_on = true; // Override the Proton Pack vibration toggle switch.
+          VIBRATION_MODE_EEPROM = VIBRATION_FIRING_ONLY;
+          VIBRATION_MODE = VIBRATION_MODE_EEPROM;
+        break;
 
-          if(BARGRAPH_TYPE != SEGMENTS_5) {
-            // Only change bargraph types if we are not using the stock Hasbro bargraph.
-            BARGRAPH_TYPE = BARGRAPH_TYPE_EEPROM;
-          }
+        case 3:
+          VIBRATION_MODE_EEPROM = VIBRATION_NONE;
+          VIBRATION_MODE = VIBRATION_MODE_EEPROM;
+        break;
 
-          switch(wandConfig.bargraphIdleAnimation) {
-            case 1:
-            default:
-              BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_DEFAULT;
-            break;
-            case 2:
-              BARGRAPH_MODE = BARGRAPH_SUPER_HERO;
-              BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_SUPER_HERO;
-            break;
-            case 3:
-              BARGRAPH_MODE = BARGRAPH_ORIGINAL;
-              BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_ORIGINAL;
-            break;
-          }
+        case 4:
+        default:
+          VIBRATION_MODE_EEPROM = VIBRATION_DEFAULT;
+          VIBRATION_MODE = VIBRATION_FIRING_ONLY;
+        break;
+      }
 
-          switch(wandConfig.bargraphFireAnimation) {
-            case 1:
-            default:
-              BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_DEFAULT;
-            break;
-            case 2:
-              BARGRAPH_FIRING_ANIMATION = BARGRAPH_ANIMATION_SUPER_HERO;
-              BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_SUPER_HERO;
-            break;
-            case 3:
-              BARGRAPH_FIRING_ANIMATION = BARGRAPH_ANIMATION_ORIGINAL;
-              BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_ORIGINAL;
-            break;
-          }
+      b_extra_pack_sounds = (wandConfig.wandSoundsToPack == 1);
+      b_quick_vent = (wandConfig.quickVenting == 1);
+      b_vent_light_control = (wandConfig.autoVentLight == 1);
+      b_beep_loop = (wandConfig.wandBeepLoop == 1);
+      b_wand_boot_errors = (wandConfig.wandBootError == 1);
 
-          // Update and reset wand components.
-          bargraphYearModeUpdate();
-          resetOverheatLevels();
-          resetWhiteLEDBlinkRate();
+      switch(wandConfig.defaultYearModeWand) {
+        case 1:
+        default:
+          WAND_YEAR_MODE = YEAR_DEFAULT;
+        break;
+        case 2:
+          WAND_YEAR_MODE = YEAR_1984;
+        break;
+        case 3:
+          WAND_YEAR_MODE = YEAR_1989;
+        break;
+        case 4:
+          WAND_YEAR_MODE = YEAR_AFTERLIFE;
+        break;
+        case 5:
+          WAND_YEAR_MODE = YEAR_FROZEN_EMPIRE;
+        break;
+      }
+
+      switch(wandConfig.defaultYearModeCTS) {
+        case 1:
+        default:
+          WAND_YEAR_CTS = CTS_DEFAULT;
+        break;
+        case 2:
+          WAND_YEAR_CTS = CTS_1984;
         break;
+        case 4:
+          WAND_YEAR_CTS = CTS_AFTERLIFE;
+        break;
+      }
 
-        case PACKET_SMOKE:
-          wandComs.rxObj(smokeConfig);
-          debugln(F("Recv. Smoke Config"));
+      b_bargraph_invert = (wandConfig.invertWandBargraph == 1);
+      b_overheat_bargraph_blink = (wandConfig.bargraphOverheatBlink == 1);
 
-          // Writes new preferences back to runtime variables.
-          // This action does not save changes to the EEPROM!
-          b_overheat_level_5 = (smokeConfig.overheatLevel5 == 1);
-          b_overheat_level_4 = (smokeConfig.overheatLevel4 == 1);
-          b_overheat_level_3 = (smokeConfig.overheatLevel3 == 1);
-          b_overheat_level_2 = (smokeConfig.overheatLevel2 == 1);
-          b_overheat_level_1 = (smokeConfig.overheatLevel1 == 1);
+      switch(wandConfig.numBargraphSegments) {
+        case 28:
+        default:
+          BARGRAPH_TYPE_EEPROM = SEGMENTS_28;
+        break;
+        case 30:
+          BARGRAPH_TYPE_EEPROM = SEGMENTS_30;
+        break;
+      }
 
-          // Values are sent as seconds, must convert to milliseconds.
-          i_ms_overheat_initiate_level_5 = smokeConfig.overheatDelay5 * 1000;
-          i_ms_overheat_initiate_level_4 = smokeConfig.overheatDelay4 * 1000;
-          i_ms_overheat_initiate_level_3 = smokeConfig.overheatDelay3 * 1000;
-          i_ms_overheat_initiate_level_2 = smokeConfig.overheatDelay2 * 1000;
-          i_ms_overheat_initiate_level_1 = smokeConfig.overheatDelay1 * 1000;
+      if(BARGRAPH_TYPE != SEGMENTS_5) {
+        // Only change bargraph types if we are not using the stock Hasbro bargraph.
+        BARGRAPH_TYPE = BARGRAPH_TYPE_EEPROM;
+      }
 
-          // Update and reset wand components.
-          resetOverheatLevels();
+      switch(wandConfig.bargraphIdleAnimation) {
+        case 1:
+        default:
+          BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_DEFAULT;
+        break;
+        case 2:
+          BARGRAPH_MODE = BARGRAPH_SUPER_HERO;
+          BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_SUPER_HERO;
+        break;
+        case 3:
+          BARGRAPH_MODE = BARGRAPH_ORIGINAL;
+          BARGRAPH_MODE_EEPROM = BARGRAPH_EEPROM_ORIGINAL;
         break;
+      }
 
-        case PACKET_SYNC:
-          wandComs.rxObj(wandSyncData);
-          debugln(F("Recv. Sync Payload"));
+      switch(wandConfig.bargraphFireAnimation) {
+        case 1:
+        default:
+          BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_DEFAULT;
+        break;
+        case 2:
+          BARGRAPH_FIRING_ANIMATION = BARGRAPH_ANIMATION_SUPER_HERO;
+          BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_SUPER_HERO;
+        break;
+        case 3:
+          BARGRAPH_FIRING_ANIMATION = BARGRAPH_ANIMATION_ORIGINAL;
+          BARGRAPH_EEPROM_FIRING_ANIMATION = BARGRAPH_EEPROM_ANIMATION_ORIGINAL;
+        break;
+      }
 
-          // Write the received data to runtime variables.
-          // This will not save to the EEPROM!
-          switch(wandSyncData.systemMode) {
-            case 1:
-            default:
-              SYSTEM_MODE = MODE_SUPER_HERO;
-            break;
-            case 2:
-              SYSTEM_MODE = MODE_ORIGINAL;
-            break;
-          }
+      // Update and reset wand components.
+      bargraphYearModeUpdate();
+      resetOverheatLevels();
+      resetWhiteLEDBlinkRate();
+    break;
 
-          vgModeCheck(); // Re-check VG/CTS mode.
+    case PACKET_SMOKE:
+      wandComs.rxObj(smokeConfig, i_offset);
+      debugln(F("Recv. Smoke Config"));
 
-          // Set whether the switch under the ion arm is on or off.
-          changeIonArmSwitchState(wandSyncData.ionArmSwitch == 2);
+      // Writes new preferences back to runtime variables.
+      // This action does not save changes to the EEPROM!
+      b_overheat_level_5 = (smokeConfig.overheatLevel5 == 1);
+      b_overheat_level_4 = (smokeConfig.overheatLevel4 == 1);
+      b_overheat_level_3 = (smokeConfig.overheatLevel3 == 1);
+      b_overheat_level_2 = (smokeConfig.overheatLevel2 == 1);
+      b_overheat_level_1 = (smokeConfig.overheatLevel1 == 1);
 
-          // Update the System Year setting.
-          switch(wandSyncData.systemYear) {
-            case 1:
-              SYSTEM_YEAR = SYSTEM_1984;
-            break;
-            case 2:
-              SYSTEM_YEAR = SYSTEM_1989;
-            break;
-            case 3:
-            default:
-              SYSTEM_YEAR = SYSTEM_AFTERLIFE;
-            break;
-            case 4:
-              SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
-            break;
-          }
+      // Values are sent as seconds, must convert to milliseconds.
+      i_ms_overheat_initiate_level_5 = smokeConfig.overheatDelay5 * 1000;
+      i_ms_overheat_initiate_level_4 = smokeConfig.overheatDelay4 * 1000;
+      i_ms_overheat_initiate_level_3 = smokeConfig.overheatDelay3 * 1000;
+      i_ms_overheat_initiate_level_2 = smokeConfig.overheatDelay2 * 1000;
+      i_ms_overheat_initiate_level_1 = smokeConfig.overheatDelay1 * 1000;
 
-          // Reset the bargraph now that we have our SYSTEM_MODE and SYSTEM_YEAR set.
-          bargraphYearModeUpdate();
+      // Update and reset wand components.
+      resetOverheatLevels();
+    break;
 
-          // Reset the white LED blink rate in case we changed wand year.
-          resetWhiteLEDBlinkRate();
+    case PACKET_SYNC:
+      wandComs.rxObj(wandSyncData, i_offset);
+      debugln(F("Recv. Sync Payload"));
 
-          // Set whether the Proton Pack is currently on or off.
-          switch(wandSyncData.packOn) {
-            case 1:
-            default:
-              // Pack is off.
-              if(b_pack_on == true) {
-                // Turn wand off.
-                if(WAND_STATUS != MODE_OFF) {
-                  if(WAND_STATUS == MODE_ERROR) {
-                    b_wand_mash_error = false;
-                    wandOff();
-                  }
-                  else {
-                    b_wand_mash_error = false;
-                    WAND_ACTION_STATUS = ACTION_OFF;
-                  }
-                }
-              }
+      // Write the received data to runtime variables.
+      // This will not save to the EEPROM!
+      switch(wandSyncData.systemMode) {
+        case 1:
+        default:
+          SYSTEM_MODE = MODE_SUPER_HERO;
+        break;
+        case 2:
+          SYSTEM_MODE = MODE_ORIGINAL;
+        break;
+      }
 
-              b_pack_on = false;
-            break;
-            case 2:
-              // Pack is on.
-              b_pack_on = true;
-            break;
-          }
+      vgModeCheck(); // Re-check VG/CTS mode.
 
-          // Set our starting power level.
-          i_power_level = wandSyncData.powerLevel;
-          i_power_level_prev = i_power_level;
+      // Set whether the switch under the ion arm is on or off.
+      changeIonArmSwitchState(wandSyncData.ionArmSwitch == 2);
 
-          // Set our firing mode.
-          switch(wandSyncData.streamMode) {
-            case 1:
-            default:
-              STREAM_MODE = PROTON;
-            break;
-            case 2:
-              STREAM_MODE = SLIME;
-              setVGMode();
-            break;
-            case 3:
-              STREAM_MODE = STASIS;
-              setVGMode();
-            break;
-            case 4:
-              STREAM_MODE = MESON;
+      // Update the System Year setting.
+      switch(wandSyncData.systemYear) {
+        case 1:
+          SYSTEM_YEAR = SYSTEM_1984;
+        break;
+        case 2:
+          SYSTEM_YEAR = SYSTEM_1989;
+        break;
+        case 3:
+        default:
+          SYSTEM_YEAR = SYSTEM_AFTERLIFE;
+        break;
+        case 4:
+          SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
+        break;
+      }
 
-              if(AUDIO_DEVICE == A_GPSTAR_AUDIO || AUDIO_DEVICE == A_GPSTAR_AUDIO_ADV) {
-                // Tell GPStar Audio we need short audio mode.
-                audio.gpstarShortTrackOverload(false);
-              }
+      // Reset the bargraph now that we have our SYSTEM_MODE and SYSTEM_YEAR set.
+      bargraphYearModeUpdate();
 
-              setVGMode();
-            break;
-            case 5:
-              STREAM_MODE = SPECTRAL;
-              setVGMode();
-            break;
-            case 6:
-              STREAM_MODE = HOLIDAY_HALLOWEEN;
-              setVGMode();
-            break;
-            case 7:
-              STREAM_MODE = HOLIDAY_CHRISTMAS;
-              setVGMode();
-            break;
-            case 8:
-              STREAM_MODE = SPECTRAL_CUSTOM;
-              setVGMode();
-            break;
+      // Reset the white LED blink rate in case we changed wand year.
+      resetWhiteLEDBlinkRate();
+
+      // Set whether the Proton Pack is currently on or off.
+      switch(wandSyncData.packOn) {
+        case 1:
+        default:
+          // Pack is off.
+          if(b_pack_on == true) {
+            // Turn wand off.
+            if(WAND_STATUS != MODE_OFF) {
+              if(WAND_STATUS == MODE_ERROR) {
+                b_wand_mash_error = false;
+                wandOff();
+              }
+              else {
+                b_wand_mash_error = false;
+                WAND_ACTION_STATUS = ACTION_OFF;
+              }
+            }
           }
 
-          // Set up master vibration switch if not configured to override it.
-          if(VIBRATION_MODE_EEPROM == VIBRATION_DEFAULT) {
-            b_vibration_switch_on = wandSyncData.vibrationEnabled == 2;
+          b_pack_on = false;
+        break;
+        case 2:
+          // Pack is on.
+          b_pack_on = true;
+        break;
+      }
+
+      // Set our starting power level.
+      i_power_level = wandSyncData.powerLevel;
+      i_power_level_prev = i_power_level;
+
+      // Set our firing mode.
+      switch(wandSyncData.streamMode) {
+        case 1:
+        default:
+          STREAM_MODE = PROTON;
+        break;
+        case 2:
+          STREAM_MODE = SLIME;
+          setVGMode();
+        break;
+        case 3:
+          STREAM_MODE = STASIS;
+          setVGMode();
+        break;
+        case 4:
+          STREAM_MODE = MESON;
+
+          if(AUDIO_DEVICE == A_GPSTAR_AUDIO || AUDIO_DEVICE == A_GPSTAR_AUDIO_ADV) {
+            // Tell GPStar Audio we need short audio mode.
+            audio.gpstarShortTrackOverload(false);
           }
 
-          // Update cyclotron lid status and music loop status.
-          b_pack_cyclotron_lid_on = wandSyncData.cyclotronLidState == 2;
-          b_repeat_track = wandSyncData.repeatMusicTrack == 2;
+          setVGMode();
+        break;
+        case 5:
+          STREAM_MODE = SPECTRAL;
+          setVGMode();
+        break;
+        case 6:
+          STREAM_MODE = HOLIDAY_HALLOWEEN;
+          setVGMode();
+        break;
+        case 7:
+          STREAM_MODE = HOLIDAY_CHRISTMAS;
+          setVGMode();
+        break;
+        case 8:
+          STREAM_MODE = SPECTRAL_CUSTOM;
+          setVGMode();
+        break;
+      }
+
+      // Set up master vibration switch if not configured to override it.
+      if(VIBRATION_MODE_EEPROM == VIBRATION_DEFAULT) {
+        b_vibration_switch_on = wandSyncData.vibrationEnabled == 2;
+      }
+
+      // Update cyclotron lid status and music loop status.
+      b_pack_cyclotron_lid_on = wandSyncData.cyclotronLidState == 2;
+      b_repeat_track = wandSyncData.repeatMusicTrack == 2;
 
-          // Set the percentage volume.
-          i_volume_master_percentage = wandSyncData.masterVolume;
-          i_volume_effects_percentage = wandSyncData.effectsVolume;
+      // Set the percentage volume.
+      i_volume_master_percentage = wandSyncData.masterVolume;
+      i_volume_effects_percentage = wandSyncData.effectsVolume;
 
-          // Set the decibel volume.
-          i_volume_master = MINIMUM_VOLUME - ((MINIMUM_VOLUME - i_volume_abs_max) * i_volume_master_percentage / 100);
-          i_volume_effects = i_volume_abs_min - (i_volume_abs_min * i_volume_effects_percentage / 100);
-          i_volume_music = i_volume_abs_min - (i_volume_abs_min * i_volume_music_percentage / 100);
+      // Set the decibel volume.
+      i_volume_master = MINIMUM_VOLUME - ((MINIMUM_VOLUME - i_volume_abs_max) * i_volume_master_percentage / 100);
+      i_volume_effects = i_volume_abs_min - (i_volume_abs_min * i_volume_effects_percentage / 100);
+      i_volume_music = i_volume_abs_min - (i_volume_abs_min * i_volume_music_percentage / 100);
+
+      // Update volume levels.
+      i_volume_revert = i_volume_master;
+      updateMasterVolume();
 
-          // Update volume levels.
+      switch(wandSyncData.masterMuted) {
+        case 1:
+        default:
+          // Do nothing; we already have our volumes set correctly.
+        break;
+        case 2:
+          // Remember the current master volume level.
           i_volume_revert = i_volume_master;
+
+          // The pack is telling us to be silent.
+          i_volume_master = i_volume_abs_min;
           updateMasterVolume();
+        break;
+      }
+    break;
+  }
+}
 
-          switch(wandSyncData.masterMuted) {
-            case 1:
-            default:
-              // Do nothing; we already have our volumes set correctly.
-            break;
-            case 2:
-              // Remember the current master volume level.
-              i_volume_revert = i_volume_master;
+// Pack communication to the wand.
+void checkPack() {
+  // Leave when a pack is not intended to be connected.
+  if(b_gpstar_benchtest == true) {
+    return;
+  }
 
-              // The pack is telling us to be silent.
-              i_volume_master = i_volume_abs_min;
-              updateMasterVolume();
-            break;
+  if(wandComs.available() > 0) {
+    uint8_t i_packet_id = wandComs.currentPacketID();
+    // debug(F("PacketID: "));
+    // debugln(i_packet_id);
+
+    if(i_packet_id > 0) {
+      if(i_pack_baud_rate != BAUD_RATE_DEFAULT) {
+        // Any good packet proves the faster link is still working.
+        i_pack_link_errors = 0;
+        ms_pack_link_check.restart();
+      }
+
+      // Determine the type of packet which was sent by the pack.
+      switch(i_packet_id) {
+        case PACKET_RELIABLE:
+        {
+          struct ReliableHeader header;
+          wandComs.rxObj(header);
+
+          if(reliableReceived(header.seq)) {
+            handlePackPacket(header.type, sizeof(header));
           }
+        }
+        break;
+
+        case PACKET_ACK:
+        {
+          uint8_t i_seq = 0;
+          wandComs.rxObj(i_seq);
+          reliableAcknowledged(i_seq);
+        }
+        break;
+
+        default:
+          handlePackPacket(i_packet_id, 0);
         break;
       }
     }
   }
+  else {
+    checkPackLinkSpeed(wandComs.status);
+  }
+
+  // Resend anything the pack has not yet acknowledged.
+  reliableService();
 }
 
 bool handlePackCommand(uint8_t i_command, uint16_t i_value) {
@@ -798,6 +988,16 @@ bool handlePackCommand(uint8_t i_command, uint16_t i_value) {
 
   switch(i_command) {
     case P_HANDSHAKE:
+      if(i_value != BAUD_RATE_DEFAULT && i_value == i_pack_baud_rate) {
+        // The pack is echoing our heartbeat at the active rate, so no response is needed.
+        break;
+      }
+
+      if(WAND_CONN_STATE == PACK_CONNECTED && (i_value == BAUD_RATE_57600 || i_value == BAUD_RATE_115200)) {
+        // The pack has selected a faster rate, so switch now and respond at the new rate.
+        setPackBaudRate(i_value);
+      }
+
       // The pack is asking us if we are still here so respond accordingly.
       if(WAND_CONN_STATE != PACK_CONNECTED) {
         // If still waiting for the pack, trigger an immediate synchronization.
@@ -805,7 +1005,7 @@ bool handlePackCommand(uint8_t i_command, uint16_t i_value) {
       }
       else {
         // The wand had already synchronized with the pack, so respond with handshake.
-        wandSerialSend(W_HANDSHAKE);
+        wandSerialSend(W_HANDSHAKE, i_link_capabilities);
       }
     break;
 
@@ -822,13 +1022,21 @@ bool handlePackCommand(uint8_t i_command, uint16_t i_value) {
 
       // Stop regular sync attempts while communicating with the pack.
       ms_packsync.stop();
+
+      // Anything still awaiting acknowledgement belongs to the previous connection.
+      reliableReset();
     break;
 
     case P_SYNC_END:
       debugln(F("Pack Sync End"));
 
-      // Acknowledgement that the wand is now synchronized.
-      wandSerialSend(W_SYNCHRONIZED);
+      if(i_value & i_link_reliable_supported) {
+        // The pack accepts reliable frames, so the confirmation below can use one.
+        packReliable.b_peer_ready = true;
+      }
+
+      // Acknowledgement that the wand is now synchronized, along with the protocol it was built for.
+      wandSerialSend(W_SYNCHRONIZED, i_protocol_hash);
 
       // Tell the pack the status of the Neutrona Wand barrel. We only need to tell if its extended.
       // Otherwise the switchBarrel() will tell it if it's retracted during bootup.
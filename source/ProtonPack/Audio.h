@@ -30,11 +30,12 @@
  */
 #include <GPStarAudio.h>
 gpstarAudio audio;
+AudioQueue<i_last_effects_track + 1> audioQueue; // Sound effect commands waiting to be sent; see AudioQueue.h.
 
 /*
  * Audio Devices
  */
-enum AUDIO_DEVICES { A_NONE, A_GPSTAR_AUDIO, A_GPSTAR_AUDIO_ADV, A_WAV_TRIGGER };
+enum AUDIO_DEVICES { A_NONE, A_GPSTAR_AUDIO, A_GPSTAR_AUDIO_ADV, A_WAV_TRIGGER, A_DETECTING };
 enum AUDIO_DEVICES AUDIO_DEVICE;
 
 /*
@@ -50,6 +51,11 @@ const uint8_t i_wand_idle_level = 20; // This adjusts the volume of certain Afte
 bool b_playing_music = false; // Sets whether a music track is currently playing or not.
 bool b_music_paused = false; // Sets whether a music track is currently paused or not.
 bool b_repeat_track = false; // Sets whether to repeat one music track or loop through all music tracks.
+MusicPlaylist musicPlaylist; // Decides the order the music tracks are played in when not repeating one.
+uint16_t i_music_prefetch_track = 0; // Track the audio board will start by itself when the current one ends, or 0 if none.
+int8_t i_music_prefetch_gain = 0; // Gain the prefetched track was given.
+bool b_music_track_seen = false; // Set once the track reports show the current music track playing.
+bool b_track_reports = false; // Set once the audio board is seen sending track reports, which fill the voice tables.
 bool b_preload_tracks = false; // Sets whether to add a 50ms delay before playing any file to allow slower SD cards more time to fill the buffer.
 
 /*
@@ -57,9 +63,22 @@ bool b_preload_tracks = false; // Sets whether to add a 50ms delay before playin
  */
 const uint16_t i_music_check_delay = 2000;
 const uint16_t i_music_next_track_delay = 500;
+const uint16_t i_music_handoff_delay = 250; // How long to wait for the audio board to start a prefetched track.
 millisDelay ms_check_music;
 millisDelay ms_music_next_track;
 millisDelay ms_music_status_check;
+millisDelay ms_music_handoff;
+
+/*
+ * Audio Device Detection
+ * Runs from updateAudio() rather than holding up the boot sequence. Both kinds of audio board are asked to identify
+ * themselves at once, repeating until one answers or the time allowed for a board to boot up runs out. Sound effects
+ * requested in the meantime wait in the audio queue until the device is known.
+ */
+const uint16_t i_audio_detect_timeout = 1700; // Time for an audio board to boot up and answer.
+const uint16_t i_audio_probe_delay = 250; // Time between requests for the audio boards to identify themselves.
+millisDelay ms_audio_detect;
+millisDelay ms_audio_probe;
 
 /*
  * Volume percentage values (0 to 100)
@@ -79,11 +98,25 @@ int8_t i_volume_revert = i_volume_master; // Used to restore volume level from a
 int8_t i_volume_effects = i_volume_abs_min - (i_volume_abs_min * i_volume_effects_percentage / 100); // Sound effects.
 int8_t i_volume_music = i_volume_abs_min - (i_volume_abs_min * i_volume_music_percentage / 100); // Music volume.
 
+/*
+ * Music Ducking
+ * Each class of sound effect which should be heard over the music sets a bit while it is active. The music gain only
+ * follows the combined state, checked once per loop by updateMusicDucking(), so effects starting and stopping in a
+ * burst cost a single fade which goes out with the rest of the queued commands at the end of the loop.
+ */
+enum MUSIC_DUCKING_CLASSES {
+  DUCK_FIRING = 0x01,
+  DUCK_OVERHEAT = 0x02,
+  DUCK_VENTING = 0x04
+};
+uint8_t i_music_duck_classes = 0; // Effect classes active as of the last check.
+
 /*
  * Function Prototypes
  */
 void playEffect(uint16_t i_track_id, bool b_track_loop = false, int8_t i_track_volume = i_volume_effects, bool b_fade_in = false, uint16_t i_fade_time = 0, bool b_lock = true);
 void stopEffect(uint16_t i_track_id);
+void loopEffect(uint16_t i_track_id, bool b_track_loop);
 void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_track2_loop = false, uint16_t i_track2_offset = 0, int8_t i_track_volume = i_volume_effects, bool b_fade_in = false, uint16_t i_fade_time = 0, bool b_lock = true);
 void adjustGainEffect(uint16_t i_track_id, int8_t i_track_volume = i_volume_effects, bool b_fade = false, uint16_t i_fade_time = 0);
 void updateMasterVolume(bool startup = false);
@@ -92,6 +125,58 @@ void updateMasterVolume(bool startup = false);
  * Audio playback functions.
  */
 
+// Send the sound effect commands queued during this pass of the main loop.
+void flushAudio() {
+  if(AUDIO_DEVICE == A_DETECTING) {
+    // Hold everything until there is a device to send it to.
+    return;
+  }
+
+  for(uint8_t i = 0; i < audioQueue.size(); i++) {
+    const AudioCommand &command = audioQueue.command(i);
+
+    if(command.i_flags & AQ_STOP) {
+      audio.trackStop(command.i_track);
+    }
+
+    if(command.i_flags & AQ_GAIN) {
+      audio.trackGain(command.i_track, command.i_gain);
+    }
+
+    if(command.i_flags & AQ_PLAY) {
+      if(AUDIO_DEVICE == A_GPSTAR_AUDIO_ADV) {
+        audio.trackPlayPoly(command.i_track, command.i_flags & AQ_LOCK, b_preload_tracks ? 50 : 0);
+      }
+      else {
+        audio.trackPlayPoly(command.i_track, command.i_flags & AQ_LOCK);
+      }
+    }
+
+    if(command.i_flags & AQ_FADE) {
+      audio.trackFade(command.i_track, command.i_fade_gain, command.i_fade_time, 0);
+    }
+
+    if(command.i_flags & AQ_LOOP) {
+      audio.trackLoop(command.i_track, (command.i_flags & AQ_LOOP_ON) ? 1 : 0);
+    }
+  }
+
+  audioQueue.clear();
+}
+
+// Make sure the queue can take a command for a track, sending what it holds early if it is full.
+void reserveAudioQueue(uint16_t i_track_id) {
+  if(!audioQueue.hasRoom(i_track_id)) {
+    if(AUDIO_DEVICE == A_DETECTING) {
+      // Nothing can be sent yet, so the oldest sound gives way to the new one.
+      audioQueue.dropOldest();
+    }
+    else {
+      flushAudio();
+    }
+  }
+}
+
 // Play a sound effect using certain defaults.
 void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, bool b_fade_in, uint16_t i_fade_time, bool b_lock) {
   if(i_track_volume < i_volume_abs_min) {
@@ -105,41 +190,34 @@ void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, b
   switch(AUDIO_DEVICE) {
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
+    case A_GPSTAR_AUDIO_ADV:
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+
       if(b_fade_in) {
-        audio.trackGain(i_track_id, i_volume_abs_min);
-        audio.trackPlayPoly(i_track_id, b_lock);
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
+        audioQueue.play(i_track_id, b_track_loop, i_volume_abs_min, b_lock);
+        audioQueue.fade(i_track_id, i_track_volume, i_fade_time);
       }
       else {
-        audio.trackGain(i_track_id, i_track_volume);
-        audio.trackPlayPoly(i_track_id, b_lock);
+        audioQueue.play(i_track_id, b_track_loop, i_track_volume, b_lock);
       }
+    break;
 
-      if(b_track_loop) {
-        audio.trackLoop(i_track_id, 1);
-      }
-      else {
-        audio.trackLoop(i_track_id, 0);
-      }
+    case A_NONE:
+    default:
+      // No audio device connected.
     break;
+  }
+}
 
+void stopEffect(uint16_t i_track_id) {
+  switch(AUDIO_DEVICE) {
+    case A_WAV_TRIGGER:
+    case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
-      if(b_fade_in) {
-        audio.trackGain(i_track_id, i_volume_abs_min);
-        audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 50 : 0);
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
-      }
-      else {
-        audio.trackGain(i_track_id, i_track_volume);
-        audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 50 : 0);
-      }
-
-      if(b_track_loop) {
-        audio.trackLoop(i_track_id, 1);
-      }
-      else {
-        audio.trackLoop(i_track_id, 0);
-      }
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+      audioQueue.stop(i_track_id);
     break;
 
     case A_NONE:
@@ -149,12 +227,15 @@ void playEffect(uint16_t i_track_id, bool b_track_loop, int8_t i_track_volume, b
   }
 }
 
-void stopEffect(uint16_t i_track_id) {
+// Turn looping of a sound effect on or off. Once looping is off, the track stops naturally at its end.
+void loopEffect(uint16_t i_track_id, bool b_track_loop) {
   switch(AUDIO_DEVICE) {
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
-      audio.trackStop(i_track_id);
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+      audioQueue.loop(i_track_id, b_track_loop);
     break;
 
     case A_NONE:
@@ -176,6 +257,9 @@ void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_trac
 
   switch(AUDIO_DEVICE) {
     case A_GPSTAR_AUDIO_ADV:
+      // Sent straight away, so anything already queued for these tracks has to go first.
+      flushAudio();
+
       if(b_fade_in) {
         audio.trackGain(i_track_id, i_volume_abs_min);
         audio.trackGain(i_track_id2, i_track_volume);
@@ -187,6 +271,9 @@ void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_trac
         audio.trackGain(i_track_id2, i_track_volume);
         audio.trackPlayPoly(i_track_id, b_lock, b_preload_tracks ? 50 : 0, i_track_id2, b_track2_loop, i_track2_offset);
       }
+
+      audioQueue.setActive(i_track_id, true);
+      audioQueue.setActive(i_track_id2, true);
     break;
 
     default:
@@ -195,10 +282,21 @@ void playTransitionEffect(uint16_t i_track_id, uint16_t i_track_id2, bool b_trac
   }
 }
 
+// Gain for the music tracks, taking any ducking into account.
+int8_t musicGain() {
+  if(i_music_duck_classes > 0 && MUSIC_DUCKING_DEPTH > 0) {
+    return max(i_volume_music - MUSIC_DUCKING_DEPTH, i_volume_abs_min);
+  }
+
+  return i_volume_music;
+}
+
 // Play a music track using certain defaults.
 void playMusic() {
   if(i_music_count > 0 && i_current_music_track >= i_music_track_start) {
     b_playing_music = true;
+    b_music_track_seen = false;
+    i_music_prefetch_track = 0;
 
     switch(AUDIO_DEVICE) {
       case A_WAV_TRIGGER:
@@ -211,7 +309,7 @@ void playMusic() {
           audio.trackLoop(i_current_music_track, 0);
         }
 
-        audio.trackGain(i_current_music_track, i_volume_music);
+        audio.trackGain(i_current_music_track, musicGain());
         audio.trackPlayPoly(i_current_music_track, true);
         audio.update();
 
@@ -227,8 +325,20 @@ void playMusic() {
           audio.trackLoop(i_current_music_track, 0);
         }
 
-        audio.trackGain(i_current_music_track, i_volume_music);
-        audio.trackPlayPoly(i_current_music_track, true, b_preload_tracks ? 50 : 0);
+        audio.trackGain(i_current_music_track, musicGain());
+
+        if(b_track_reports && !b_repeat_track && musicPlaylist.size() > 1) {
+          // Hand the following track to the audio board as well, which starts it the moment this one ends.
+          // Only done when track reports are seen, as those are needed to tell when the board has moved on.
+          i_music_prefetch_track = musicPlaylist.peekNext(i_current_music_track);
+          i_music_prefetch_gain = musicGain();
+          audio.trackGain(i_music_prefetch_track, i_music_prefetch_gain);
+          audio.trackPlayPoly(i_current_music_track, true, b_preload_tracks ? 50 : 0, i_music_prefetch_track, false, 0);
+        }
+        else {
+          audio.trackPlayPoly(i_current_music_track, true, b_preload_tracks ? 50 : 0);
+        }
+
         audio.update();
 
         audio.resetTrackCounter();
@@ -257,6 +367,11 @@ void stopMusic() {
         audio.trackStop(i_current_music_track);
       }
 
+      if(i_music_prefetch_track > 0) {
+        // The audio board may already have started the following track by itself.
+        audio.trackStop(i_music_prefetch_track);
+      }
+
       audio.update();
     break;
 
@@ -268,6 +383,7 @@ void stopMusic() {
 
   b_music_paused = false;
   b_playing_music = false;
+  i_music_prefetch_track = 0;
 
   // Tell connected serial device music playback has stopped.
   serial1Send(A_MUSIC_IS_NOT_PLAYING, i_current_music_track);
@@ -329,16 +445,7 @@ void resumeMusic() {
 }
 
 void musicNextTrack() {
-  uint16_t i_temp_track = i_current_music_track; // Used for music navigation.
-
-  // Determine the next track.
-  if(i_current_music_track + 1 > i_music_track_start + i_music_count - 1) {
-    // Start at the first track if already on the last.
-    i_temp_track = i_music_track_start;
-  }
-  else {
-    i_temp_track++;
-  }
+  uint16_t i_temp_track = musicPlaylist.next(i_current_music_track); // Used for music navigation.
 
   // Switch to the next track.
   if(b_playing_music) {
@@ -359,16 +466,7 @@ void musicNextTrack() {
 }
 
 void musicPrevTrack() {
-  uint16_t i_temp_track = i_current_music_track; // Used for music navigation.
-
-  // Determine the previous track.
-  if(i_current_music_track - 1 < i_music_track_start) {
-    // Start at the last track if already on the first.
-    i_temp_track = i_music_track_start + (i_music_count - 1);
-  }
-  else {
-    i_temp_track--;
-  }
+  uint16_t i_temp_track = musicPlaylist.prev(i_current_music_track); // Used for music navigation.
 
   // Switch to the previous track.
   if(b_playing_music) {
@@ -402,11 +500,14 @@ void adjustGainEffect(uint16_t i_track_id, int8_t i_track_volume, bool b_fade, u
     case A_WAV_TRIGGER:
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
+    case A_DETECTING:
+      reserveAudioQueue(i_track_id);
+
       if(b_fade) {
-        audio.trackFade(i_track_id, i_track_volume, i_fade_time, 0);
+        audioQueue.fade(i_track_id, i_track_volume, i_fade_time);
       }
       else {
-        audio.trackGain(i_track_id, i_track_volume);
+        audioQueue.gain(i_track_id, i_track_volume);
       }
     break;
 
@@ -527,24 +628,24 @@ void updateEffectsVolume() {
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
       // Only effects that are long or looped require adjustment.
-      audio.trackGain(S_BEEP_8, i_volume_effects);
-      audio.trackGain(S_WAND_BOOTUP, i_volume_effects);
-      audio.trackGain(S_PACK_RIBBON_ALARM_1, i_volume_effects);
-      audio.trackGain(S_ALARM_LOOP, i_volume_effects);
-      audio.trackGain(S_SMASH_ERROR_LOOP, i_volume_effects);
-      audio.trackGain(S_RIBBON_CABLE_START, i_volume_effects);
-      audio.trackGain(S_STEAM_LOOP, i_volume_effects);
-      audio.trackGain(S_SHUTDOWN, i_volume_effects);
+      adjustGainEffect(S_BEEP_8, i_volume_effects);
+      adjustGainEffect(S_WAND_BOOTUP, i_volume_effects);
+      adjustGainEffect(S_PACK_RIBBON_ALARM_1, i_volume_effects);
+      adjustGainEffect(S_ALARM_LOOP, i_volume_effects);
+      adjustGainEffect(S_SMASH_ERROR_LOOP, i_volume_effects);
+      adjustGainEffect(S_RIBBON_CABLE_START, i_volume_effects);
+      adjustGainEffect(S_STEAM_LOOP, i_volume_effects);
+      adjustGainEffect(S_SHUTDOWN, i_volume_effects);
 
       switch(SYSTEM_YEAR) {
         case SYSTEM_1984:
-          audio.trackGain(S_GB1_1984_BOOT_UP, i_volume_effects);
-          audio.trackGain(S_GB1_1984_PACK_LOOP, i_volume_effects);
+          adjustGainEffect(S_GB1_1984_BOOT_UP, i_volume_effects);
+          adjustGainEffect(S_GB1_1984_PACK_LOOP, i_volume_effects);
         break;
 
         case SYSTEM_1989:
-          audio.trackGain(S_GB2_PACK_START, i_volume_effects);
-          audio.trackGain(S_GB2_PACK_LOOP, i_volume_effects);
+          adjustGainEffect(S_GB2_PACK_START, i_volume_effects);
+          adjustGainEffect(S_GB2_PACK_LOOP, i_volume_effects);
         break;
 
         case SYSTEM_AFTERLIFE:
@@ -552,42 +653,42 @@ void updateEffectsVolume() {
         default:
           if(STREAM_MODE == SLIME) {
             // In slime blower mode these sounds have lower volume than normal.
-            audio.trackGain(S_BOOTUP, i_volume_effects - 30);
-            audio.trackGain(S_AFTERLIFE_PACK_STARTUP, i_volume_effects - 30);
-            audio.trackGain(S_AFTERLIFE_PACK_IDLE_LOOP, i_volume_effects - 40);
-            audio.trackGain(S_FROZEN_EMPIRE_PACK_STARTUP, i_volume_effects - 30);
-            audio.trackGain(S_FROZEN_EMPIRE_PACK_IDLE_LOOP, i_volume_effects - 40);
+            adjustGainEffect(S_BOOTUP, i_volume_effects - 30);
+            adjustGainEffect(S_AFTERLIFE_PACK_STARTUP, i_volume_effects - 30);
+            adjustGainEffect(S_AFTERLIFE_PACK_IDLE_LOOP, i_volume_effects - 40);
+            adjustGainEffect(S_FROZEN_EMPIRE_PACK_STARTUP, i_volume_effects - 30);
+            adjustGainEffect(S_FROZEN_EMPIRE_PACK_IDLE_LOOP, i_volume_effects - 40);
           }
           else {
-            audio.trackGain(S_BOOTUP, i_volume_effects);
-            audio.trackGain(S_AFTERLIFE_PACK_STARTUP, i_volume_effects);
-            audio.trackGain(S_AFTERLIFE_PACK_IDLE_LOOP, i_volume_effects);
-            audio.trackGain(S_FROZEN_EMPIRE_PACK_STARTUP, i_volume_effects);
-            audio.trackGain(S_FROZEN_EMPIRE_PACK_IDLE_LOOP, i_volume_effects);
+            adjustGainEffect(S_BOOTUP, i_volume_effects);
+            adjustGainEffect(S_AFTERLIFE_PACK_STARTUP, i_volume_effects);
+            adjustGainEffect(S_AFTERLIFE_PACK_IDLE_LOOP, i_volume_effects);
+            adjustGainEffect(S_FROZEN_EMPIRE_PACK_STARTUP, i_volume_effects);
+            adjustGainEffect(S_FROZEN_EMPIRE_PACK_IDLE_LOOP, i_volume_effects);
           }
 
-          audio.trackGain(S_PACK_SHUTDOWN_AFTERLIFE_ALT, i_volume_effects);
-          audio.trackGain(S_FROZEN_EMPIRE_PACK_SHUTDOWN, i_volume_effects);
-          audio.trackGain(S_FROZEN_EMPIRE_BRASS_SHUTDOWN, i_volume_effects);
-          audio.trackGain(S_POWERCELL, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_BEEP_WAND_S1, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_BEEP_WAND_S2, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_BEEP_WAND_S3, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_BEEP_WAND_S4, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_BEEP_WAND_S5, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_1, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_2, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_2_FADE_IN, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_IDLE_1, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_IDLE_2, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_2, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_2_FADE_OUT, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_AFTERLIFE_WAND_RAMP_DOWN_1, i_volume_effects - i_wand_idle_level);
-          audio.trackGain(S_PACK_BEEPS_OVERHEAT, i_volume_effects);
-          audio.trackGain(S_PACK_OVERHEAT_HOT, i_volume_effects);
+          adjustGainEffect(S_PACK_SHUTDOWN_AFTERLIFE_ALT, i_volume_effects);
+          adjustGainEffect(S_FROZEN_EMPIRE_PACK_SHUTDOWN, i_volume_effects);
+          adjustGainEffect(S_FROZEN_EMPIRE_BRASS_SHUTDOWN, i_volume_effects);
+          adjustGainEffect(S_POWERCELL, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S1, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S2, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S3, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S4, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_BEEP_WAND_S5, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_1, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_2, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_2_FADE_IN, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_IDLE_1, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_IDLE_2, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_2, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_2_FADE_OUT, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_AFTERLIFE_WAND_RAMP_DOWN_1, i_volume_effects - i_wand_idle_level);
+          adjustGainEffect(S_PACK_BEEPS_OVERHEAT, i_volume_effects);
+          adjustGainEffect(S_PACK_OVERHEAT_HOT, i_volume_effects);
 
           if(b_brass_pack_sound_loop) {
-            audio.trackGain(S_FROZEN_EMPIRE_BOOT_EFFECT, i_volume_effects);
+            adjustGainEffect(S_FROZEN_EMPIRE_BOOT_EFFECT, i_volume_effects);
           }
         break;
       }
@@ -596,33 +697,33 @@ void updateEffectsVolume() {
         case PROTON:
         default:
           if(b_wand_firing) {
-            audio.trackGain(S_GB1_FIRE_HIGH_POWER_LOOP, i_volume_effects);
-            audio.trackGain(S_GB1_1984_FIRE_LOOP_PACK, i_volume_effects);
-            audio.trackGain(S_GB1_1984_FIRE_HIGH_POWER_LOOP, i_volume_effects);
-            audio.trackGain(S_GB2_FIRE_LOOP, i_volume_effects);
-            audio.trackGain(S_FIRING_LOOP_GB1, i_volume_effects);
+            adjustGainEffect(S_GB1_FIRE_HIGH_POWER_LOOP, i_volume_effects);
+            adjustGainEffect(S_GB1_1984_FIRE_LOOP_PACK, i_volume_effects);
+            adjustGainEffect(S_GB1_1984_FIRE_HIGH_POWER_LOOP, i_volume_effects);
+            adjustGainEffect(S_GB2_FIRE_LOOP, i_volume_effects);
+            adjustGainEffect(S_FIRING_LOOP_GB1, i_volume_effects);
           }
         break;
 
         case SLIME:
-          audio.trackGain(S_PACK_SLIME_TANK_LOOP, i_volume_effects);
-          audio.trackGain(S_SLIME_REFILL, i_volume_effects);
+          adjustGainEffect(S_PACK_SLIME_TANK_LOOP, i_volume_effects);
+          adjustGainEffect(S_SLIME_REFILL, i_volume_effects);
 
           if(b_wand_firing) {
-            audio.trackGain(S_SLIME_LOOP, i_volume_effects);
+            adjustGainEffect(S_SLIME_LOOP, i_volume_effects);
           }
         break;
 
         case STASIS:
-          audio.trackGain(S_STASIS_IDLE_LOOP, i_volume_effects);
+          adjustGainEffect(S_STASIS_IDLE_LOOP, i_volume_effects);
 
           if(b_wand_firing) {
-            audio.trackGain(S_STASIS_LOOP, i_volume_effects);
+            adjustGainEffect(S_STASIS_LOOP, i_volume_effects);
           }
         break;
 
         case MESON:
-          audio.trackGain(S_MESON_IDLE_LOOP, i_volume_effects);
+          adjustGainEffect(S_MESON_IDLE_LOOP, i_volume_effects);
         break;
       }
     break;
@@ -676,7 +777,7 @@ void updateMusicVolume() {
       case A_WAV_TRIGGER:
       case A_GPSTAR_AUDIO:
       case A_GPSTAR_AUDIO_ADV:
-        audio.trackGain(i_current_music_track, i_volume_music);
+        audio.trackGain(i_current_music_track, musicGain());
       break;
 
       case A_NONE:
@@ -689,6 +790,39 @@ void updateMusicVolume() {
   serial1SendData(A_VOLUME_SYNC); // Tell the connected device about this change.
 }
 
+// Fades the music down while firing, overheating or venting, and back up once none of those remain.
+void updateMusicDucking() {
+  uint8_t i_classes = 0;
+
+  if(b_wand_firing) {
+    i_classes |= DUCK_FIRING;
+  }
+
+  if(b_overheating) {
+    i_classes |= DUCK_OVERHEAT;
+  }
+
+  if(b_venting) {
+    i_classes |= DUCK_VENTING;
+  }
+
+  if((i_classes > 0) == (i_music_duck_classes > 0)) {
+    // One class taking over from another leaves the music where it is.
+    i_music_duck_classes = i_classes;
+    return;
+  }
+
+  i_music_duck_classes = i_classes;
+
+  if(MUSIC_DUCKING_DEPTH == 0 || !b_playing_music || i_music_count == 0) {
+    // Nothing to fade; the next track to play picks up the new gain.
+    return;
+  }
+
+  // A prefetched track gets the new gain when the audio board moves on to it, in checkMusicReports().
+  adjustGainEffect(i_current_music_track, musicGain(), true, i_classes > 0 ? MUSIC_DUCKING_ATTACK : MUSIC_DUCKING_RELEASE);
+}
+
 void increaseVolumeMusic() {
   if(i_volume_music_percentage + VOLUME_MUSIC_MULTIPLIER > 100) {
     i_volume_music_percentage = 100;
@@ -734,6 +868,8 @@ void buildMusicCount(uint16_t i_num_tracks) {
     i_music_count = 0; // If the music count is corrupt, make it 0
     debugln(F("Warning: Calculated music count exceeds 4096; SD card corruption likely!"));
   }
+
+  musicPlaylist.begin(i_music_track_start, i_music_count);
 }
 
 bool musicIsTrackCounterReset() {
@@ -781,14 +917,65 @@ bool musicTrackStatus() {
   }
 }
 
+// With track reports the voice table is kept locally, so the end of a music track is seen on the pass it happens.
+void checkMusicReports() {
+  if(!b_playing_music || b_repeat_track || b_music_paused) {
+    return;
+  }
+
+  if(audio.isTrackPlaying(i_current_music_track)) {
+    b_music_track_seen = true;
+    ms_music_handoff.stop();
+    return;
+  }
+
+  if(!b_music_track_seen && !ms_music_status_check.justFinished()) {
+    // Not reported as started yet; a track which never starts is given up on once the status check timer runs out.
+    return;
+  }
+
+  if(i_music_prefetch_track > 0 && audio.isTrackPlaying(i_music_prefetch_track)) {
+    // The audio board has moved on to the prefetched track by itself.
+    musicPlaylist.next(i_current_music_track);
+    i_current_music_track = i_music_prefetch_track;
+    i_music_prefetch_track = 0;
+    ms_music_handoff.stop();
+
+    if(i_music_prefetch_gain != musicGain()) {
+      // The music volume or ducking changed since the track was handed over.
+      adjustGainEffect(i_current_music_track, musicGain());
+    }
+
+    // Tell connected serial device the new track is playing.
+    serial1Send(A_MUSIC_IS_PLAYING, i_current_music_track);
+  }
+  else if(i_music_prefetch_track > 0 && !ms_music_handoff.isRunning()) {
+    // The report of the prefetched track starting may follow a moment after the one for this track ending.
+    ms_music_handoff.start(i_music_handoff_delay);
+  }
+  else if(i_music_prefetch_track == 0 || ms_music_handoff.justFinished()) {
+    // Nothing took over, so start the next track straight away.
+    ms_music_handoff.stop();
+    stopMusic();
+    i_current_music_track = musicPlaylist.next(i_current_music_track);
+
+    // Play the appropriate track on the pack and wand, and notify the serial1 device.
+    playMusic();
+  }
+}
+
 void checkMusic() {
-  if(ms_check_music.justFinished() && !ms_music_next_track.isRunning()) {
+  if(b_track_reports) {
+    checkMusicReports();
+  }
+  else if(ms_check_music.justFinished() && !ms_music_next_track.isRunning()) {
     switch(AUDIO_DEVICE) {
       case A_WAV_TRIGGER:
       case A_GPSTAR_AUDIO:
       case A_GPSTAR_AUDIO_ADV:
         ms_check_music.start(i_music_check_delay);
 
+        // Without track reports, the music track status has to be requested.
         musicTrackPlayingStatus();
 
         // Loop through all the tracks if the music is not set to repeat a track.
@@ -800,12 +987,7 @@ void checkMusic() {
             stopMusic();
 
             // Switch to the next track.
-            if(i_current_music_track + 1 > i_music_track_start + i_music_count - 1) {
-              i_current_music_track = i_music_track_start;
-            }
-            else {
-              i_current_music_track++;
-            }
+            i_current_music_track = musicPlaylist.next(i_current_music_track);
 
             // Start timer to prepare to play music again.
             ms_music_next_track.start(i_music_next_track_delay);
@@ -844,14 +1026,14 @@ void toggleMusicLoop() {
       if(!b_repeat_track) {
         b_repeat_track = true;
 
-        if(i_music_count > 0) {
+        if(i_music_count > 0 && b_playing_music) {
           audio.trackLoop(i_current_music_track, 1);
         }
       }
       else {
         b_repeat_track = false;
 
-        if(i_music_count > 0) {
+        if(i_music_count > 0 && b_playing_music) {
           audio.trackLoop(i_current_music_track, 0);
         }
       }
@@ -869,49 +1051,69 @@ void toggleMusicLoop() {
   }
 }
 
+// Takes effect from the track after the one already handed to the audio board, if any.
+void toggleMusicShuffle() {
+  musicPlaylist.shuffle(!musicPlaylist.isShuffled());
+}
+
 /*
  * Audio Setup Routines
  * Used to detect, update, and reset the available audio devices.
  */
-bool setupAudioDevice() {
-  // Short delay to allow the audio boards to boot up.
-  delay(1000);
-
-  char gVersion[VERSION_STRING_LEN];
-
+// Start looking for an audio device; checkAudioDevice() carries on from updateAudio().
+void setupAudioDevice() {
   Serial3.begin(57600);
 
   audio.start(Serial3);
 
-  // Ask for some Wav Trigger information.
-  audio.requestVersionString();
-  audio.requestSystemInfo();
+  AUDIO_DEVICE = A_DETECTING;
+  b_track_reports = false;
+  audioQueue.reset();
 
-  delay(10);
+  ms_audio_detect.start(i_audio_detect_timeout);
+  ms_audio_probe.start(0);
+}
 
+// Settings sent to the audio device once it has identified itself.
+void configureAudioDevice() {
   // Stop all tracks.
   audio.stopAllTracks();
 
   // Reset the sample rate offset. Only for the WAV Trigger.
   audio.samplerateOffset(0);
 
-  audio.masterGain(i_volume_abs_min); // Reset the master gain db. Range is -70 to 0. Bootup the system muted, then we reset it after the system is loaded.
-
   // Onboard amplifier on or off. Only for the WAV Trigger.
   audio.setAmpPwr(b_onboard_amp_enabled);
 
   // Enable track reporting. Only for the WAV Trigger.
   audio.setReporting(true);
 
-  // Allow time for hello command and other data to return back.
-  delay(350);
+  // Now that the device type and its volume range are known, set the master volume.
+  updateMasterVolume(true);
+}
+
+// Check for an answer from either kind of audio board, asking again until one answers or time runs out.
+void checkAudioDevice() {
+  char gVersion[VERSION_STRING_LEN];
+  bool b_timed_out = ms_audio_detect.justFinished();
+
+  audio.update();
 
   if(audio.getVersion(gVersion)) {
-    // We found a WAV Trigger. Build the music track count.
+    // We found a WAV Trigger. Only attempt to build a music track count if it responded with RSP_SYSTEM_INFO.
     if(audio.wasSysInfoRcvd()) {
-      // Only attempt to build a music track count if the WAV Trigger responded with RSP_SYSTEM_INFO.
       buildMusicCount((uint16_t) audio.getNumTracks());
     }
+    else if(!b_timed_out) {
+      // Give it until the timeout to do so, asking again in case the first request was lost.
+      if(ms_audio_probe.justFinished()) {
+        audio.requestSystemInfo();
+
+        ms_audio_probe.start(i_audio_probe_delay);
+      }
+
+      return;
+    }
     else {
       debugln(F("Warning: RSP_SYSTEM_INFO not received!"));
     }
@@ -919,15 +1121,8 @@ bool setupAudioDevice() {
     AUDIO_DEVICE = A_WAV_TRIGGER;
 
     debugln(F("Using WAV Trigger"));
-
-    return true;
   }
-
-  audio.hello();
-
-  delay(350);
-
-  if(audio.gpstarAudioHello()) {
+  else if(audio.gpstarAudioHello()) {
     if(audio.getVersionNumber() != 0) {
       AUDIO_DEVICE = A_GPSTAR_AUDIO_ADV;
     }
@@ -945,16 +1140,52 @@ bool setupAudioDevice() {
     debugln(audio.getVersionNumber());
 
     buildMusicCount((uint16_t) audio.getNumTracks());
-
-    return true;
   }
-  else {
-    // No audio devices connected.
+  else if(b_timed_out) {
+    // No audio devices connected; drop any sound effects which were waiting for one.
     AUDIO_DEVICE = A_NONE;
+    audioQueue.reset();
+    ms_audio_probe.stop();
 
     debugln(F("No Audio Device"));
 
-    return false;
+    return;
+  }
+  else {
+    if(ms_audio_probe.justFinished()) {
+      // Ask for some WAV Trigger information and say hello to GPStar Audio; whichever is present will answer.
+      audio.requestVersionString();
+      audio.requestSystemInfo();
+      audio.hello();
+
+      ms_audio_probe.start(i_audio_probe_delay);
+    }
+
+    return;
+  }
+
+  ms_audio_detect.stop();
+  ms_audio_probe.stop();
+
+  // How long the audio board took to answer differs from one power-up to the next, so seed random() from it; the music
+  // shuffle and the other random effects would otherwise follow the same sequence after every boot.
+  randomSeed(micros());
+
+  configureAudioDevice();
+}
+
+// Bring the voice table in the audio queue up to date with the track reports, checking one active track per loop.
+void updateAudioVoices() {
+  uint16_t i_track_id = audioQueue.nextActive();
+
+  if(i_track_id > 0) {
+    bool b_playing = audio.isTrackPlaying(i_track_id);
+
+    if(b_playing) {
+      b_track_reports = true;
+    }
+
+    audioQueue.report(i_track_id, b_playing);
   }
 }
 
@@ -964,6 +1195,11 @@ void updateAudio() {
     case A_GPSTAR_AUDIO:
     case A_GPSTAR_AUDIO_ADV:
       audio.update();
+      updateAudioVoices();
+    break;
+
+    case A_DETECTING:
+      checkAudioDevice();
     break;
 
     case A_NONE:
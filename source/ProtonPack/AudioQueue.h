@@ -0,0 +1,282 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/*
+ * Per-loop queue of sound effect commands, shared by the Proton Pack, Neutrona Wand and Single-Shot Blaster. This
+ * file must be kept identical in every one of those projects (the CI compile check compares the copies).
+ * playEffect(), stopEffect() and adjustGainEffect() each turn into several commands on the serial link to the audio
+ * board. Rather than sending those as they are called, the calls made during one pass of the main loop are collected
+ * here with one entry per track, then sent together by flushAudio() at the end of the pass:
+ *  - Gain, fade and loop changes for the same track are merged so only the last value of each is sent.
+ *  - A stop cancels any play of that track still waiting in the queue, as that one never reached the board.
+ *  - A stop or loop change of a track which is not active is dropped, so a stop followed by a play of an idle track
+ *    only sends the play.
+ * Entries are sent in the order their tracks were first queued; for one track the order is always stop, gain, play,
+ * fade and then loop.
+ * While there is no audio device to send to, a full queue makes room with dropOldest() instead, so the newest sounds
+ * are always kept. Looping sounds are dropped last, as those are still wanted once the device is ready.
+ * Which tracks are active is kept in a voice table with two bits per track. A track becomes active when its play is
+ * sent and idle when its stop is sent. In between, report() passes on what the audio board says about the track: once
+ * the board has confirmed a track is playing, a later report that it is not marks the track idle again. Until that
+ * first confirmation a track stays active, so a short track which ends before it is ever seen playing is still
+ * stopped as before. Only tracks below TRACKS have an entry; any others are always treated as active.
+ */
+enum AUDIO_QUEUE_FLAGS {
+  AQ_STOP = 0x01,
+  AQ_GAIN = 0x02,
+  AQ_PLAY = 0x04,
+  AQ_LOCK = 0x08,
+  AQ_FADE = 0x10,
+  AQ_LOOP = 0x20,
+  AQ_LOOP_ON = 0x40
+};
+
+struct AudioCommand {
+  uint16_t i_track;
+  uint8_t i_flags;
+  int8_t i_gain;
+  int8_t i_fade_gain;
+  uint16_t i_fade_time;
+};
+
+template<uint16_t TRACKS>
+class AudioQueue {
+  public:
+    // Whether a command for the track can be queued; when false, send the queue first.
+    bool hasRoom(uint16_t i_track) {
+      return i_count < AUDIO_QUEUE_SIZE || find(i_track, false) != nullptr;
+    }
+
+    void play(uint16_t i_track, bool b_loop, int8_t i_gain, bool b_lock) {
+      AudioCommand *p_command = find(i_track, true);
+
+      if(p_command == nullptr) {
+        return;
+      }
+
+      // Replaces any earlier play, gain, fade or loop; a stop is kept only if the track may still be playing.
+      p_command->i_flags = (active(i_track) ? (p_command->i_flags & AQ_STOP) : 0) | AQ_GAIN | AQ_PLAY | AQ_LOOP;
+      p_command->i_gain = i_gain;
+
+      if(b_lock) {
+        p_command->i_flags |= AQ_LOCK;
+      }
+
+      if(b_loop) {
+        p_command->i_flags |= AQ_LOOP_ON;
+      }
+    }
+
+    void stop(uint16_t i_track) {
+      AudioCommand *p_command = find(i_track, active(i_track));
+
+      if(p_command == nullptr) {
+        // Nothing queued and nothing playing means nothing to stop.
+        return;
+      }
+
+      // Whatever was queued for the track is moot once it stops.
+      p_command->i_flags = active(i_track) ? AQ_STOP : 0;
+    }
+
+    void gain(uint16_t i_track, int8_t i_gain) {
+      AudioCommand *p_command = find(i_track, true);
+
+      if(p_command == nullptr) {
+        return;
+      }
+
+      // A later gain replaces both an earlier gain and any fade still to be sent.
+      p_command->i_flags = (p_command->i_flags & ~AQ_FADE) | AQ_GAIN;
+      p_command->i_gain = i_gain;
+    }
+
+    void fade(uint16_t i_track, int8_t i_gain, uint16_t i_time) {
+      AudioCommand *p_command = find(i_track, true);
+
+      if(p_command == nullptr) {
+        return;
+      }
+
+      p_command->i_flags |= AQ_FADE;
+      p_command->i_fade_gain = i_gain;
+      p_command->i_fade_time = i_time;
+    }
+
+    void loop(uint16_t i_track, bool b_loop) {
+      AudioCommand *p_command = find(i_track, active(i_track));
+
+      if(p_command == nullptr) {
+        return;
+      }
+
+      if(!active(i_track) && !(p_command->i_flags & AQ_PLAY)) {
+        return;
+      }
+
+      p_command->i_flags = (p_command->i_flags & ~AQ_LOOP_ON) | AQ_LOOP;
+
+      if(b_loop) {
+        p_command->i_flags |= AQ_LOOP_ON;
+      }
+    }
+
+    // Frees one entry when the queue cannot be sent: the oldest sound which does not loop, else the oldest of all.
+    void dropOldest() {
+      uint8_t i_drop = 0;
+
+      if(i_count == 0) {
+        return;
+      }
+
+      for(uint8_t i = 0; i < i_count; i++) {
+        if(!(commands[i].i_flags & AQ_LOOP_ON)) {
+          i_drop = i;
+          break;
+        }
+      }
+
+      i_count--;
+      memmove(&commands[i_drop], &commands[i_drop + 1], (i_count - i_drop) * sizeof(AudioCommand));
+    }
+
+    uint8_t size() const {
+      return i_count;
+    }
+
+    const AudioCommand &command(uint8_t i_index) const {
+      return commands[i_index];
+    }
+
+    // Called once every queued command has been sent; records which tracks are now active or idle.
+    void clear() {
+      for(uint8_t i = 0; i < i_count; i++) {
+        if(commands[i].i_flags & AQ_PLAY) {
+          setActive(commands[i].i_track, true);
+        }
+        else if(commands[i].i_flags & AQ_STOP) {
+          setActive(commands[i].i_track, false);
+        }
+      }
+
+      i_count = 0;
+    }
+
+    // Drops everything, such as after all tracks on the board have been stopped.
+    void reset() {
+      i_count = 0;
+      memset(i_active, 0, sizeof(i_active));
+      memset(i_confirmed, 0, sizeof(i_confirmed));
+    }
+
+    // For tracks started or stopped directly on the audio board rather than through the queue.
+    void setActive(uint16_t i_track, bool b_active) {
+      if(i_track < TRACKS) {
+        writeBit(i_active, i_track, b_active);
+        writeBit(i_confirmed, i_track, false);
+      }
+    }
+
+    // Whether the track may be playing. False only when it is known not to be.
+    bool active(uint16_t i_track) const {
+      if(i_track < TRACKS) {
+        return readBit(i_active, i_track);
+      }
+
+      return true;
+    }
+
+    // Passes on the audio board's view of a track, taken from its track reports.
+    void report(uint16_t i_track, bool b_playing) {
+      if(i_track < TRACKS) {
+        if(b_playing) {
+          writeBit(i_active, i_track, true);
+          writeBit(i_confirmed, i_track, true);
+        }
+        else if(readBit(i_confirmed, i_track)) {
+          writeBit(i_active, i_track, false);
+          writeBit(i_confirmed, i_track, false);
+        }
+      }
+    }
+
+    // Steps through the active tracks in turn, one per call. Returns 0 (never a valid track) when none are active.
+    uint16_t nextActive() {
+      uint16_t i_scanned = 0;
+
+      while(i_scanned < TRACKS) {
+        i_next_track = (i_next_track + 1) % TRACKS;
+
+        if(i_active[i_next_track / 8] == 0) {
+          // Skip the rest of an empty byte.
+          i_scanned += 8 - (i_next_track % 8);
+          i_next_track = min(i_next_track | 7, TRACKS - 1);
+        }
+        else if(readBit(i_active, i_next_track)) {
+          return i_next_track;
+        }
+        else {
+          i_scanned++;
+        }
+      }
+
+      return 0;
+    }
+
+  private:
+    static const uint8_t AUDIO_QUEUE_SIZE = 16;
+
+    AudioCommand commands[AUDIO_QUEUE_SIZE];
+    uint8_t i_count = 0;
+    uint8_t i_active[(TRACKS + 7) / 8] = {};
+    uint8_t i_confirmed[(TRACKS + 7) / 8] = {};
+    uint16_t i_next_track = 0;
+
+    static bool readBit(const uint8_t *p_bits, uint16_t i_track) {
+      return p_bits[i_track / 8] & (1 << (i_track % 8));
+    }
+
+    static void writeBit(uint8_t *p_bits, uint16_t i_track, bool b_value) {
+      if(b_value) {
+        p_bits[i_track / 8] |= (1 << (i_track % 8));
+      }
+      else {
+        p_bits[i_track / 8] &= ~(1 << (i_track % 8));
+      }
+    }
+
+    AudioCommand *find(uint16_t i_track, bool b_add) {
+      for(uint8_t i = 0; i < i_count; i++) {
+        if(commands[i].i_track == i_track) {
+          return &commands[i];
+        }
+      }
+
+      if(!b_add || i_count >= AUDIO_QUEUE_SIZE) {
+        return nullptr;
+      }
+
+      commands[i_count].i_track = i_track;
+      commands[i_count].i_flags = 0;
+
+      return &commands[i_count++];
+    }
+};
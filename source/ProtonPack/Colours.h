@@ -528,15 +528,107 @@ CHSV getHue(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness = 255, uint
   }
 }
 
-CRGB getHueAsRGB(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness = 255, bool b_grb = false, bool b_fade = false) {
-  // Brightness here is a value from 0-255 as limited by byte (uint8_t) type.
+// Colour schemes which advance through their colours on each call to getHue(), so their output cannot be reused.
+bool isCyclingColour(uint8_t i_colour) {
+  switch(i_colour) {
+    case C_REDGREEN:
+    case C_ORANGEPURPLE:
+    case C_BLUEFADE:
+    case C_PASTEL:
+    case C_RAINBOW:
+      return true;
+    break;
+
+    default:
+      return false;
+    break;
+  }
+}
+
+// Dims a colour converted at full brightness to the same result hsv2rgb_rainbow() gives for that brightness,
+// which with FastLED's default FASTLED_SCALE8_FIXED is a plain scale8() of each channel.
+CRGB scaleHueBrightness(CRGB rgb, uint8_t i_brightness) {
+  if(i_brightness == 255) {
+    return rgb;
+  }
+
+  uint8_t i_scale = scale8_video(i_brightness, i_brightness);
+
+  if(i_scale == 0) {
+    return CRGB(0, 0, 0);
+  }
+
+  return CRGB(scale8(rgb.r, i_scale), scale8(rgb.g, i_scale), scale8(rgb.b, i_scale));
+}
+
+// Palette cache: the full-brightness RGB last resolved for each device, so static colours skip getHue() and hsv2rgb_rainbow().
+// Entries are keyed on the colour plus the custom hue/saturation for the user-defined colours. A stream mode or year
+// change selects a different colour for the device, which simply misses and replaces the entry.
+struct PaletteEntry {
+  bool b_valid = false;
+  uint8_t i_colour = 0;
+  uint16_t i_custom = 0; // Custom hue (high byte) and saturation (low byte) the entry was resolved with.
+  bool b_fixed_brightness = false; // Colour overrides the requested brightness (eg. C_BLACK).
+  CRGB rgb;
+};
+
+PaletteEntry palette[6];
+
+// Returns the custom hue and saturation a colour currently depends on, or 0 for every other colour.
+uint16_t getPaletteCustomKey(uint8_t i_colour) {
+  switch(i_colour) {
+    case C_CUSTOM_POWERCELL:
+      return (i_spectral_powercell_custom_colour << 8) | i_spectral_powercell_custom_saturation;
+    break;
 
-  // Get the initial colour using the HSV scheme.
-  CHSV hsv = getHue(i_device, i_colour, i_brightness, 255, b_fade);
+    case C_CUSTOM_CYCLOTRON:
+      return (i_spectral_cyclotron_custom_colour << 8) | i_spectral_cyclotron_custom_saturation;
+    break;
+
+    case C_CUSTOM_INNER_CYCLOTRON:
+      return (i_spectral_cyclotron_inner_custom_colour << 8) | i_spectral_cyclotron_inner_custom_saturation;
+    break;
+
+    default:
+      return 0;
+    break;
+  }
+}
+
+// Returns a static (non-cycling) colour for a device at the given brightness, in RGB order.
+CRGB getPaletteColour(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness) {
+  PaletteEntry &entry = palette[i_device];
+  uint16_t i_custom = getPaletteCustomKey(i_colour);
+
+  if(!entry.b_valid || entry.i_colour != i_colour || entry.i_custom != i_custom) {
+    CHSV hsv = getHue(i_device, i_colour);
+
+    hsv2rgb_rainbow(hsv, entry.rgb);
+    entry.i_colour = i_colour;
+    entry.i_custom = i_custom;
+    entry.b_fixed_brightness = (hsv.val != 255);
+    entry.b_valid = true;
+  }
 
-  // Convert from HSV to RGB.
+  if(entry.b_fixed_brightness) {
+    return entry.rgb;
+  }
+
+  return scaleHueBrightness(entry.rgb, i_brightness);
+}
+
+CRGB getHueAsRGB(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness = 255, bool b_grb = false, bool b_fade = false) {
+  // Brightness here is a value from 0-255 as limited by byte (uint8_t) type.
   CRGB rgb; // RGB Array as { r, g, b }
-  hsv2rgb_rainbow(hsv, rgb);
+
+  if(isCyclingColour(i_colour)) {
+    // Colour cycles move on with every call, so these are converted from the HSV scheme each time.
+    CHSV hsv = getHue(i_device, i_colour, i_brightness, 255, b_fade);
+    hsv2rgb_rainbow(hsv, rgb);
+  }
+  else {
+    rgb = getPaletteColour(i_device, i_colour, i_brightness);
+  }
 
   if(b_grb) {
     // Swap red/green values before returning.
@@ -553,14 +645,8 @@ CRGB getHueAsGRB(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness = 255)
 }
 
 CRGB getHueAsGBR(uint8_t i_device, uint8_t i_colour, uint8_t i_brightness = 255) {
-  // Brightness here is a value from 0-255 as limited by byte (uint8_t) type.
-
-  // Get the initial colour using the HSV scheme.
-  CHSV hsv = getHue(i_device, i_colour, i_brightness);
-
-  // Convert from HSV to RGB.
-  CRGB rgb; // RGB Array as { r, g, b }
-  hsv2rgb_rainbow(hsv, rgb);
+  // Get the colour in RGB order first.
+  CRGB rgb = getHueAsRGB(i_device, i_colour, i_brightness);
 
   // Swap colour values before returning.
   return CRGB(rgb[1], rgb[2], rgb[0]);
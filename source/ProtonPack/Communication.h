@@ -20,435 +20,703 @@
 #pragma once
 
 /*
- * These enum definitions must be kept in sync across the devices they communicate with, using the same dataype and ordering.
+ * Serial protocol schema, shared by the Proton Pack, Neutrona Wand and both Attenuator builds.
+ * This file must be kept identical in every one of those projects (the CI compile check compares the copies).
+ * Each list below is an X-macro: it is expanded once into the enum or packed struct used by the firmware, and
+ * once more into a description of the schema from which i_protocol_hash is computed at compile time. Every
+ * device sends that hash while synchronizing, so firmware built from a different schema is caught at once.
  * Enum values are internally considered integer values and here they are being given a distinct underlying datatype of uint8_t.
  * It is therefore important that the total number of elements per enum must remain below 254 to not overflow that (byte) type.
  */
 
-enum device_ids : uint8_t {
-  A_COM_START,
-  P_COM_START,
-  W_COM_START,
-  A_COM_END,
-  P_COM_END,
-  W_COM_END
-};
+#define DEVICE_IDS(X) \
+  X(A_COM_START) \
+  X(P_COM_START) \
+  X(W_COM_START) \
+  X(A_COM_END) \
+  X(P_COM_END) \
+  X(W_COM_END)
 
-enum pack_messages : uint8_t {
-  P_NULL,
-  P_HANDSHAKE,
-  P_SYNC_START,
-  P_SYNC_DATA,
-  P_SYNC_END,
-  P_ON,
-  P_OFF,
-  P_ALARM_ON,
-  P_ALARM_OFF,
-  P_VIBRATION_ENABLED,
-  P_VIBRATION_DISABLED,
-  P_YEAR_1984,
-  P_YEAR_1989,
-  P_YEAR_AFTERLIFE,
-  P_YEAR_FROZEN_EMPIRE,
-  P_VOLUME_SOUND_EFFECTS_INCREASE,
-  P_VOLUME_SOUND_EFFECTS_DECREASE,
-  P_VOLUME_INCREASE,
-  P_VOLUME_DECREASE,
-  P_PACK_VIBRATION_ENABLED,
-  P_PACK_VIBRATION_DISABLED,
-  P_PACK_VIBRATION_FIRING_ENABLED,
-  P_PACK_VIBRATION_DEFAULT,
-  P_PACK_MOTORIZED_CYCLOTRON_ENABLED,
-  P_VIDEO_GAME_MODE_COLOURS_ENABLED,
-  P_VIDEO_GAME_MODE_POWER_CELL_ENABLED,
-  P_VIDEO_GAME_MODE_CYCLOTRON_ENABLED,
-  P_VIDEO_GAME_MODE_COLOURS_DISABLED,
-  P_MODE_FROZEN_EMPIRE,
-  P_MODE_AFTERLIFE,
-  P_MODE_1989,
-  P_MODE_1984,
-  P_SMOKE_DISABLED,
-  P_SMOKE_ENABLED,
-  P_CYCLOTRON_COUNTER_CLOCKWISE,
-  P_CYCLOTRON_CLOCKWISE,
-  P_CYCLOTRON_SINGLE_LED,
-  P_CYCLOTRON_THREE_LED,
-  P_MASTER_AUDIO_SILENT_MODE,
-  P_MASTER_AUDIO_NORMAL,
-  P_POWERCELL_DIMMING,
-  P_CYCLOTRON_DIMMING,
-  P_INNER_CYCLOTRON_DIMMING,
-  P_CYCLOTRON_PANEL_DIMMING,
-  P_DIMMING,
-  P_PROTON_STREAM_IMPACT_ENABLED,
-  P_PROTON_STREAM_IMPACT_DISABLED,
-  P_RGB_INNER_CYCLOTRON_LEDS,
-  P_GRB_INNER_CYCLOTRON_LEDS,
-  P_CYCLOTRON_LEDS_40,
-  P_CYCLOTRON_LEDS_36,
-  P_CYCLOTRON_LEDS_20,
-  P_CYCLOTRON_LEDS_12,
-  P_POWERCELL_LEDS_15,
-  P_POWERCELL_LEDS_13,
-  P_INNER_CYCLOTRON_LEDS_23,
-  P_INNER_CYCLOTRON_LEDS_24,
-  P_INNER_CYCLOTRON_LEDS_26,
-  P_INNER_CYCLOTRON_LEDS_35,
-  P_INNER_CYCLOTRON_LEDS_36,
-  P_INNER_CYCLOTRON_LEDS_12,
-  P_CYCLOTRON_FADING_DISABLED,
-  P_CYCLOTRON_FADING_ENABLED,
-  P_CYCLOTRON_SIMULATE_RING_DISABLED,
-  P_CYCLOTRON_SIMULATE_RING_ENABLED,
-  P_WARNING_CANCELLED,
-  P_OVERHEAT_STROBE_ENABLED,
-  P_OVERHEAT_STROBE_DISABLED,
-  P_OVERHEAT_LIGHTS_OFF_ENABLED,
-  P_OVERHEAT_LIGHTS_OFF_DISABLED,
-  P_OVERHEAT_SYNC_FAN_DISABLED,
-  P_OVERHEAT_SYNC_FAN_ENABLED,
-  P_YEAR_MODE_DEFAULT,
-  P_MODE_SUPER_HERO,
-  P_MODE_ORIGINAL,
-  P_ION_ARM_SWITCH_ON,
-  P_ION_ARM_SWITCH_OFF,
-  P_CYCLOTRON_LID_ON,
-  P_CYCLOTRON_LID_OFF,
-  P_MANUAL_OVERHEAT,
-  P_OVERHEATING_FINISHED,
-  P_VENTING_FINISHED,
-  P_DEMO_LIGHT_MODE_ENABLED,
-  P_DEMO_LIGHT_MODE_DISABLED,
-  P_CONTINUOUS_SMOKE_5_ENABLED,
-  P_CONTINUOUS_SMOKE_4_ENABLED,
-  P_CONTINUOUS_SMOKE_3_ENABLED,
-  P_CONTINUOUS_SMOKE_2_ENABLED,
-  P_CONTINUOUS_SMOKE_1_ENABLED,
-  P_CONTINUOUS_SMOKE_5_DISABLED,
-  P_CONTINUOUS_SMOKE_4_DISABLED,
-  P_CONTINUOUS_SMOKE_3_DISABLED,
-  P_CONTINUOUS_SMOKE_2_DISABLED,
-  P_CONTINUOUS_SMOKE_1_DISABLED,
-  P_SOUND_SUPER_HERO,
-  P_SOUND_MODE_ORIGINAL,
-  P_SEND_PREFERENCES_WAND,
-  P_SEND_PREFERENCES_SMOKE,
-  P_SAVE_PREFERENCES_WAND,
-  P_SAVE_PREFERENCES_SMOKE,
-  P_SAVE_EEPROM_WAND,
-  P_INNER_CYCLOTRON_PANEL_DISABLED,
-  P_INNER_CYCLOTRON_PANEL_STATIC,
-  P_INNER_CYCLOTRON_PANEL_DYNAMIC,
-  P_POWERCELL_NOT_INVERTED,
-  P_POWERCELL_INVERTED,
-  P_POST_FINISH
-};
+#define PACK_MESSAGES(X) \
+  X(P_NULL) \
+  X(P_HANDSHAKE) \
+  X(P_SYNC_START) \
+  X(P_SYNC_DATA) \
+  X(P_SYNC_END) \
+  X(P_ON) \
+  X(P_OFF) \
+  X(P_ALARM_ON) \
+  X(P_ALARM_OFF) \
+  X(P_VIBRATION_ENABLED) \
+  X(P_VIBRATION_DISABLED) \
+  X(P_YEAR_1984) \
+  X(P_YEAR_1989) \
+  X(P_YEAR_AFTERLIFE) \
+  X(P_YEAR_FROZEN_EMPIRE) \
+  X(P_VOLUME_SOUND_EFFECTS_INCREASE) \
+  X(P_VOLUME_SOUND_EFFECTS_DECREASE) \
+  X(P_VOLUME_INCREASE) \
+  X(P_VOLUME_DECREASE) \
+  X(P_PACK_VIBRATION_ENABLED) \
+  X(P_PACK_VIBRATION_DISABLED) \
+  X(P_PACK_VIBRATION_FIRING_ENABLED) \
+  X(P_PACK_VIBRATION_DEFAULT) \
+  X(P_PACK_MOTORIZED_CYCLOTRON_ENABLED) \
+  X(P_VIDEO_GAME_MODE_COLOURS_ENABLED) \
+  X(P_VIDEO_GAME_MODE_POWER_CELL_ENABLED) \
+  X(P_VIDEO_GAME_MODE_CYCLOTRON_ENABLED) \
+  X(P_VIDEO_GAME_MODE_COLOURS_DISABLED) \
+  X(P_MODE_FROZEN_EMPIRE) \
+  X(P_MODE_AFTERLIFE) \
+  X(P_MODE_1989) \
+  X(P_MODE_1984) \
+  X(P_SMOKE_DISABLED) \
+  X(P_SMOKE_ENABLED) \
+  X(P_CYCLOTRON_COUNTER_CLOCKWISE) \
+  X(P_CYCLOTRON_CLOCKWISE) \
+  X(P_CYCLOTRON_SINGLE_LED) \
+  X(P_CYCLOTRON_THREE_LED) \
+  X(P_MASTER_AUDIO_SILENT_MODE) \
+  X(P_MASTER_AUDIO_NORMAL) \
+  X(P_POWERCELL_DIMMING) \
+  X(P_CYCLOTRON_DIMMING) \
+  X(P_INNER_CYCLOTRON_DIMMING) \
+  X(P_CYCLOTRON_PANEL_DIMMING) \
+  X(P_DIMMING) \
+  X(P_PROTON_STREAM_IMPACT_ENABLED) \
+  X(P_PROTON_STREAM_IMPACT_DISABLED) \
+  X(P_RGB_INNER_CYCLOTRON_LEDS) \
+  X(P_GRB_INNER_CYCLOTRON_LEDS) \
+  X(P_CYCLOTRON_LEDS_40) \
+  X(P_CYCLOTRON_LEDS_36) \
+  X(P_CYCLOTRON_LEDS_20) \
+  X(P_CYCLOTRON_LEDS_12) \
+  X(P_POWERCELL_LEDS_15) \
+  X(P_POWERCELL_LEDS_13) \
+  X(P_INNER_CYCLOTRON_LEDS_23) \
+  X(P_INNER_CYCLOTRON_LEDS_24) \
+  X(P_INNER_CYCLOTRON_LEDS_26) \
+  X(P_INNER_CYCLOTRON_LEDS_35) \
+  X(P_INNER_CYCLOTRON_LEDS_36) \
+  X(P_INNER_CYCLOTRON_LEDS_12) \
+  X(P_CYCLOTRON_FADING_DISABLED) \
+  X(P_CYCLOTRON_FADING_ENABLED) \
+  X(P_CYCLOTRON_SIMULATE_RING_DISABLED) \
+  X(P_CYCLOTRON_SIMULATE_RING_ENABLED) \
+  X(P_WARNING_CANCELLED) \
+  X(P_OVERHEAT_STROBE_ENABLED) \
+  X(P_OVERHEAT_STROBE_DISABLED) \
+  X(P_OVERHEAT_LIGHTS_OFF_ENABLED) \
+  X(P_OVERHEAT_LIGHTS_OFF_DISABLED) \
+  X(P_OVERHEAT_SYNC_FAN_DISABLED) \
+  X(P_OVERHEAT_SYNC_FAN_ENABLED) \
+  X(P_YEAR_MODE_DEFAULT) \
+  X(P_MODE_SUPER_HERO) \
+  X(P_MODE_ORIGINAL) \
+  X(P_ION_ARM_SWITCH_ON) \
+  X(P_ION_ARM_SWITCH_OFF) \
+  X(P_CYCLOTRON_LID_ON) \
+  X(P_CYCLOTRON_LID_OFF) \
+  X(P_MANUAL_OVERHEAT) \
+  X(P_OVERHEATING_FINISHED) \
+  X(P_VENTING_FINISHED) \
+  X(P_DEMO_LIGHT_MODE_ENABLED) \
+  X(P_DEMO_LIGHT_MODE_DISABLED) \
+  X(P_CONTINUOUS_SMOKE_5_ENABLED) \
+  X(P_CONTINUOUS_SMOKE_4_ENABLED) \
+  X(P_CONTINUOUS_SMOKE_3_ENABLED) \
+  X(P_CONTINUOUS_SMOKE_2_ENABLED) \
+  X(P_CONTINUOUS_SMOKE_1_ENABLED) \
+  X(P_CONTINUOUS_SMOKE_5_DISABLED) \
+  X(P_CONTINUOUS_SMOKE_4_DISABLED) \
+  X(P_CONTINUOUS_SMOKE_3_DISABLED) \
+  X(P_CONTINUOUS_SMOKE_2_DISABLED) \
+  X(P_CONTINUOUS_SMOKE_1_DISABLED) \
+  X(P_SOUND_SUPER_HERO) \
+  X(P_SOUND_MODE_ORIGINAL) \
+  X(P_SEND_PREFERENCES_WAND) \
+  X(P_SEND_PREFERENCES_SMOKE) \
+  X(P_SAVE_PREFERENCES_WAND) \
+  X(P_SAVE_PREFERENCES_SMOKE) \
+  X(P_SAVE_EEPROM_WAND) \
+  X(P_INNER_CYCLOTRON_PANEL_DISABLED) \
+  X(P_INNER_CYCLOTRON_PANEL_STATIC) \
+  X(P_INNER_CYCLOTRON_PANEL_DYNAMIC) \
+  X(P_POWERCELL_NOT_INVERTED) \
+  X(P_POWERCELL_INVERTED) \
+  X(P_POST_FINISH)
 
-enum wand_messages : uint8_t {
-  W_NULL,
-  W_HANDSHAKE,
-  W_SYNC_NOW,
-  W_SYNCHRONIZED,
-  W_ON,
-  W_OFF,
-  W_FIRING,
-  W_FIRING_STOPPED,
-  W_BUTTON_MASHING,
-  W_PROTON_MODE,
-  W_SLIME_MODE,
-  W_STASIS_MODE,
-  W_MESON_MODE,
-  W_SPECTRAL_MODE,
-  W_HALLOWEEN_MODE,
-  W_CHRISTMAS_MODE,
-  W_SPECTRAL_CUSTOM_MODE,
-  W_SETTINGS_MODE,
-  W_OVERHEATING,
-  W_VENTING,
-  W_CYCLOTRON_NORMAL_SPEED,
-  W_CYCLOTRON_INCREASE_SPEED,
-  W_BEEP_START,
-  W_POWER_LEVEL_1,
-  W_POWER_LEVEL_2,
-  W_POWER_LEVEL_3,
-  W_POWER_LEVEL_4,
-  W_POWER_LEVEL_5,
-  W_FIRING_INTENSIFY_MIX,
-  W_FIRING_INTENSIFY_STOPPED_MIX,
-  W_FIRING_ALT_MIX,
-  W_FIRING_ALT_STOPPED_MIX,
-  W_FIRING_CROSSING_THE_STREAMS_1984,
-  W_FIRING_CROSSING_THE_STREAMS_MIX_1984,
-  W_FIRING_CROSSING_THE_STREAMS_STOPPED_MIX_1984,
-  W_FIRING_CROSSING_THE_STREAMS_2021,
-  W_FIRING_CROSSING_THE_STREAMS_MIX_2021,
-  W_FIRING_CROSSING_THE_STREAMS_STOPPED_MIX_2021,
-  W_TOGGLE_MUTE,
-  W_YEAR_MODES_CYCLE,
-  W_VIDEO_GAME_MODE_COLOUR_TOGGLE,
-  W_CROSS_THE_STREAMS,
-  W_CROSS_THE_STREAMS_MIX,
-  W_VIBRATION_DISABLED,
-  W_VIBRATION_ENABLED,
-  W_VIBRATION_FIRING_ENABLED,
-  W_VIBRATION_DEFAULT,
-  W_VIBRATION_CYCLE_TOGGLE,
-  W_VIBRATION_CYCLE_TOGGLE_EEPROM,
-  W_SMOKE_TOGGLE,
-  W_VIDEO_GAME_MODE,
-  W_CYCLOTRON_DIRECTION_TOGGLE,
-  W_CYCLOTRON_LED_TOGGLE,
-  W_OVERHEATING_DISABLED,
-  W_OVERHEATING_ENABLED,
-  W_MUSIC_TRACK_LOOP_TOGGLE,
-  W_VOLUME_SOUND_EFFECTS_INCREASE,
-  W_VOLUME_SOUND_EFFECTS_DECREASE,
-  W_VOLUME_MUSIC_INCREASE,
-  W_VOLUME_MUSIC_DECREASE,
-  W_MUSIC_TOGGLE,
-  W_VOLUME_DECREASE,
-  W_VOLUME_INCREASE,
-  W_MENU_LEVEL_1,
-  W_MENU_LEVEL_2,
-  W_MENU_LEVEL_3,
-  W_MENU_LEVEL_4,
-  W_MENU_LEVEL_5,
-  W_DIMMING_TOGGLE,
-  W_DIMMING_INCREASE,
-  W_DIMMING_DECREASE,
-  W_PROTON_STREAM_IMPACT_TOGGLE,
-  W_CLEAR_LED_EEPROM_SETTINGS,
-  W_SAVE_LED_EEPROM_SETTINGS,
-  W_TOGGLE_CYCLOTRON_LEDS,
-  W_TOGGLE_POWERCELL_LEDS,
-  W_TOGGLE_INNER_CYCLOTRON_LEDS,
-  W_TOGGLE_RGB_INNER_CYCLOTRON_LEDS,
-  W_EEPROM_LED_MENU,
-  W_EEPROM_CONFIG_MENU,
-  W_CLEAR_CONFIG_EEPROM_SETTINGS,
-  W_SAVE_CONFIG_EEPROM_SETTINGS,
-  W_EXTRA_WAND_SOUNDS_STOP,
-  W_AFTERLIFE_GUN_RAMP_1,
-  W_AFTERLIFE_GUN_RAMP_2,
-  W_AFTERLIFE_RAMP_LOOP_2_STOP,
-  W_AFTERLIFE_GUN_LOOP_1,
-  W_AFTERLIFE_GUN_LOOP_2,
-  W_AFTERLIFE_GUN_RAMP_DOWN_2,
-  W_AFTERLIFE_GUN_RAMP_DOWN_1,
-  W_AFTERLIFE_GUN_RAMP_DOWN_2_FADE_OUT,
-  W_AFTERLIFE_GUN_RAMP_2_FADE_IN,
-  W_VOICE_NEUTRONA_WAND_SOUNDS_ENABLED,
-  W_VOICE_NEUTRONA_WAND_SOUNDS_DISABLED,
-  W_CYCLOTRON_SIMULATE_RING_TOGGLE,
-  W_SPECTRAL_MODES_ENABLED,
-  W_SPECTRAL_MODES_DISABLED,
-  W_SPECTRAL_INNER_CYCLOTRON_CUSTOM_DECREASE,
-  W_SPECTRAL_CYCLOTRON_CUSTOM_DECREASE,
-  W_SPECTRAL_POWERCELL_CUSTOM_DECREASE,
-  W_SPECTRAL_POWERCELL_CUSTOM_INCREASE,
-  W_SPECTRAL_CYCLOTRON_CUSTOM_INCREASE,
-  W_SPECTRAL_INNER_CYCLOTRON_CUSTOM_INCREASE,
-  W_SPECTRAL_LIGHTS_ON,
-  W_SPECTRAL_LIGHTS_OFF,
-  W_QUICK_VENT_ENABLED,
-  W_QUICK_VENT_DISABLED,
-  W_BOOTUP_ERRORS_ENABLED,
-  W_BOOTUP_ERRORS_DISABLED,
-  W_BARREL_LEDS_2,
-  W_BARREL_LEDS_5,
-  W_BARREL_LEDS_48,
-  W_BARREL_LEDS_50,
-  W_BARGRAPH_INVERTED,
-  W_BARGRAPH_NOT_INVERTED,
-  W_OVERHEAT_STROBE_TOGGLE,
-  W_OVERHEAT_LIGHTS_OFF_TOGGLE,
-  W_OVERHEAT_SYNC_TO_FAN_TOGGLE,
-  W_YEAR_MODES_CYCLE_EEPROM,
-  W_BARREL_EXTENDED,
-  W_BARREL_RETRACTED,
-  W_MUSIC_NEXT_TRACK,
-  W_MUSIC_PREV_TRACK,
-  W_OVERHEAT_INCREASE_LEVEL_1,
-  W_OVERHEAT_INCREASE_LEVEL_2,
-  W_OVERHEAT_INCREASE_LEVEL_3,
-  W_OVERHEAT_INCREASE_LEVEL_4,
-  W_OVERHEAT_INCREASE_LEVEL_5,
-  W_OVERHEAT_DECREASE_LEVEL_1,
-  W_OVERHEAT_DECREASE_LEVEL_2,
-  W_OVERHEAT_DECREASE_LEVEL_3,
-  W_OVERHEAT_DECREASE_LEVEL_4,
-  W_OVERHEAT_DECREASE_LEVEL_5,
-  W_BARGRAPH_OVERHEAT_BLINK_ENABLED,
-  W_BARGRAPH_OVERHEAT_BLINK_DISABLED,
-  W_MODE_BEEP_LOOP_ENABLED,
-  W_MODE_BEEP_LOOP_DISABLED,
-  W_DEFAULT_BARGRAPH,
-  W_MODE_ORIGINAL_BARGRAPH,
-  W_SUPER_HERO_BARGRAPH,
-  W_SUPER_HERO_FIRING_ANIMATIONS_BARGRAPH,
-  W_MODE_ORIGINAL_FIRING_ANIMATIONS_BARGRAPH,
-  W_DEFAULT_FIRING_ANIMATIONS_BARGRAPH,
-  W_NEUTRONA_WAND_1984_MODE,
-  W_NEUTRONA_WAND_1989_MODE,
-  W_NEUTRONA_WAND_AFTERLIFE_MODE,
-  W_NEUTRONA_WAND_FROZEN_EMPIRE_MODE,
-  W_NEUTRONA_WAND_DEFAULT_MODE,
-  W_DEMO_LIGHT_MODE_TOGGLE,
-  W_CTS_DEFAULT,
-  W_CTS_1984,
-  W_CTS_AFTERLIFE,
-  W_MODE_TOGGLE,
-  W_OVERHEAT_LEVEL_5_ENABLED,
-  W_OVERHEAT_LEVEL_4_ENABLED,
-  W_OVERHEAT_LEVEL_3_ENABLED,
-  W_OVERHEAT_LEVEL_2_ENABLED,
-  W_OVERHEAT_LEVEL_1_ENABLED,
-  W_OVERHEAT_LEVEL_5_DISABLED,
-  W_OVERHEAT_LEVEL_4_DISABLED,
-  W_OVERHEAT_LEVEL_3_DISABLED,
-  W_OVERHEAT_LEVEL_2_DISABLED,
-  W_OVERHEAT_LEVEL_1_DISABLED,
-  W_CONTINUOUS_SMOKE_TOGGLE_5,
-  W_CONTINUOUS_SMOKE_TOGGLE_4,
-  W_CONTINUOUS_SMOKE_TOGGLE_3,
-  W_CONTINUOUS_SMOKE_TOGGLE_2,
-  W_CONTINUOUS_SMOKE_TOGGLE_1,
-  W_VOLUME_DECREASE_EEPROM,
-  W_VOLUME_INCREASE_EEPROM,
-  W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_5,
-  W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_4,
-  W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_3,
-  W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_2,
-  W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_1,
-  W_SOUND_OVERHEAT_START_TIMER_LEVEL_5,
-  W_SOUND_OVERHEAT_START_TIMER_LEVEL_4,
-  W_SOUND_OVERHEAT_START_TIMER_LEVEL_3,
-  W_SOUND_OVERHEAT_START_TIMER_LEVEL_2,
-  W_SOUND_OVERHEAT_START_TIMER_LEVEL_1,
-  W_SOUND_DEFAULT_SYSTEM_VOLUME_ADJUSTMENT,
-  W_SEND_PREFERENCES_WAND,
-  W_SEND_PREFERENCES_SMOKE,
-  W_GB1_WAND_BARREL_EXTEND,
-  W_AFTERLIFE_WAND_BARREL_EXTEND,
-  W_WAND_BARREL_RETRACT,
-  W_WAND_BOOTUP_SOUND,
-  W_WAND_BOOTUP_SHORT_SOUND,
-  W_WAND_SHUTDOWN_SOUND,
-  W_WAND_MASH_ERROR_SOUND,
-  W_WAND_BEEP_SOUNDS,
-  W_WAND_BEEP_BARGRAPH,
-  W_MODE_ORIGINAL_HEATUP_STOP,
-  W_MODE_ORIGINAL_HEATUP,
-  W_MODE_ORIGINAL_HEATDOWN_STOP,
-  W_MODE_ORIGINAL_HEATDOWN,
-  W_BEEPS_ALT,
-  W_WAND_BEEP_STOP,
-  W_WAND_BEEP_STOP_LOOP,
-  W_WAND_BEEP_START,
-  W_WAND_BEEP,
-  W_MASH_ERROR_LOOP,
-  W_MASH_ERROR_RESTART,
-  W_BOSON_DART_SOUND,
-  W_SHOCK_BLAST_SOUND,
-  W_SLIME_TETHER_SOUND,
-  W_MESON_COLLIDER_SOUND,
-  W_MESON_FIRE_PULSE,
-  W_TOGGLE_INNER_CYCLOTRON_PANEL,
-  W_WAND_BOOTUP_1989,
-  W_TOGGLE_POWERCELL_DIRECTION,
-  W_TOGGLE_CYCLOTRON_FADING,
-  W_BARGRAPH_28_SEGMENTS,
-  W_BARGRAPH_30_SEGMENTS,
-  W_RGB_VENT_DISABLED,
-  W_RGB_VENT_ENABLED,
-  W_COM_SOUND_NUMBER
-};
+#define WAND_MESSAGES(X) \
+  X(W_NULL) \
+  X(W_HANDSHAKE) \
+  X(W_SYNC_NOW) \
+  X(W_SYNCHRONIZED) \
+  X(W_ON) \
+  X(W_OFF) \
+  X(W_FIRING) \
+  X(W_FIRING_STOPPED) \
+  X(W_BUTTON_MASHING) \
+  X(W_PROTON_MODE) \
+  X(W_SLIME_MODE) \
+  X(W_STASIS_MODE) \
+  X(W_MESON_MODE) \
+  X(W_SPECTRAL_MODE) \
+  X(W_HALLOWEEN_MODE) \
+  X(W_CHRISTMAS_MODE) \
+  X(W_SPECTRAL_CUSTOM_MODE) \
+  X(W_SETTINGS_MODE) \
+  X(W_OVERHEATING) \
+  X(W_VENTING) \
+  X(W_CYCLOTRON_NORMAL_SPEED) \
+  X(W_CYCLOTRON_INCREASE_SPEED) \
+  X(W_BEEP_START) \
+  X(W_POWER_LEVEL_1) \
+  X(W_POWER_LEVEL_2) \
+  X(W_POWER_LEVEL_3) \
+  X(W_POWER_LEVEL_4) \
+  X(W_POWER_LEVEL_5) \
+  X(W_FIRING_INTENSIFY_MIX) \
+  X(W_FIRING_INTENSIFY_STOPPED_MIX) \
+  X(W_FIRING_ALT_MIX) \
+  X(W_FIRING_ALT_STOPPED_MIX) \
+  X(W_FIRING_CROSSING_THE_STREAMS_1984) \
+  X(W_FIRING_CROSSING_THE_STREAMS_MIX_1984) \
+  X(W_FIRING_CROSSING_THE_STREAMS_STOPPED_MIX_1984) \
+  X(W_FIRING_CROSSING_THE_STREAMS_2021) \
+  X(W_FIRING_CROSSING_THE_STREAMS_MIX_2021) \
+  X(W_FIRING_CROSSING_THE_STREAMS_STOPPED_MIX_2021) \
+  X(W_TOGGLE_MUTE) \
+  X(W_YEAR_MODES_CYCLE) \
+  X(W_VIDEO_GAME_MODE_COLOUR_TOGGLE) \
+  X(W_CROSS_THE_STREAMS) \
+  X(W_CROSS_THE_STREAMS_MIX) \
+  X(W_VIBRATION_DISABLED) \
+  X(W_VIBRATION_ENABLED) \
+  X(W_VIBRATION_FIRING_ENABLED) \
+  X(W_VIBRATION_DEFAULT) \
+  X(W_VIBRATION_CYCLE_TOGGLE) \
+  X(W_VIBRATION_CYCLE_TOGGLE_EEPROM) \
+  X(W_SMOKE_TOGGLE) \
+  X(W_VIDEO_GAME_MODE) \
+  X(W_CYCLOTRON_DIRECTION_TOGGLE) \
+  X(W_CYCLOTRON_LED_TOGGLE) \
+  X(W_OVERHEATING_DISABLED) \
+  X(W_OVERHEATING_ENABLED) \
+  X(W_MUSIC_TRACK_LOOP_TOGGLE) \
+  X(W_VOLUME_SOUND_EFFECTS_INCREASE) \
+  X(W_VOLUME_SOUND_EFFECTS_DECREASE) \
+  X(W_VOLUME_MUSIC_INCREASE) \
+  X(W_VOLUME_MUSIC_DECREASE) \
+  X(W_MUSIC_TOGGLE) \
+  X(W_VOLUME_DECREASE) \
+  X(W_VOLUME_INCREASE) \
+  X(W_MENU_LEVEL_1) \
+  X(W_MENU_LEVEL_2) \
+  X(W_MENU_LEVEL_3) \
+  X(W_MENU_LEVEL_4) \
+  X(W_MENU_LEVEL_5) \
+  X(W_DIMMING_TOGGLE) \
+  X(W_DIMMING_INCREASE) \
+  X(W_DIMMING_DECREASE) \
+  X(W_PROTON_STREAM_IMPACT_TOGGLE) \
+  X(W_CLEAR_LED_EEPROM_SETTINGS) \
+  X(W_SAVE_LED_EEPROM_SETTINGS) \
+  X(W_TOGGLE_CYCLOTRON_LEDS) \
+  X(W_TOGGLE_POWERCELL_LEDS) \
+  X(W_TOGGLE_INNER_CYCLOTRON_LEDS) \
+  X(W_TOGGLE_RGB_INNER_CYCLOTRON_LEDS) \
+  X(W_EEPROM_LED_MENU) \
+  X(W_EEPROM_CONFIG_MENU) \
+  X(W_CLEAR_CONFIG_EEPROM_SETTINGS) \
+  X(W_SAVE_CONFIG_EEPROM_SETTINGS) \
+  X(W_EXTRA_WAND_SOUNDS_STOP) \
+  X(W_AFTERLIFE_GUN_RAMP_1) \
+  X(W_AFTERLIFE_GUN_RAMP_2) \
+  X(W_AFTERLIFE_RAMP_LOOP_2_STOP) \
+  X(W_AFTERLIFE_GUN_LOOP_1) \
+  X(W_AFTERLIFE_GUN_LOOP_2) \
+  X(W_AFTERLIFE_GUN_RAMP_DOWN_2) \
+  X(W_AFTERLIFE_GUN_RAMP_DOWN_1) \
+  X(W_AFTERLIFE_GUN_RAMP_DOWN_2_FADE_OUT) \
+  X(W_AFTERLIFE_GUN_RAMP_2_FADE_IN) \
+  X(W_VOICE_NEUTRONA_WAND_SOUNDS_ENABLED) \
+  X(W_VOICE_NEUTRONA_WAND_SOUNDS_DISABLED) \
+  X(W_CYCLOTRON_SIMULATE_RING_TOGGLE) \
+  X(W_SPECTRAL_MODES_ENABLED) \
+  X(W_SPECTRAL_MODES_DISABLED) \
+  X(W_SPECTRAL_INNER_CYCLOTRON_CUSTOM_DECREASE) \
+  X(W_SPECTRAL_CYCLOTRON_CUSTOM_DECREASE) \
+  X(W_SPECTRAL_POWERCELL_CUSTOM_DECREASE) \
+  X(W_SPECTRAL_POWERCELL_CUSTOM_INCREASE) \
+  X(W_SPECTRAL_CYCLOTRON_CUSTOM_INCREASE) \
+  X(W_SPECTRAL_INNER_CYCLOTRON_CUSTOM_INCREASE) \
+  X(W_SPECTRAL_LIGHTS_ON) \
+  X(W_SPECTRAL_LIGHTS_OFF) \
+  X(W_QUICK_VENT_ENABLED) \
+  X(W_QUICK_VENT_DISABLED) \
+  X(W_BOOTUP_ERRORS_ENABLED) \
+  X(W_BOOTUP_ERRORS_DISABLED) \
+  X(W_BARREL_LEDS_2) \
+  X(W_BARREL_LEDS_5) \
+  X(W_BARREL_LEDS_48) \
+  X(W_BARREL_LEDS_50) \
+  X(W_BARGRAPH_INVERTED) \
+  X(W_BARGRAPH_NOT_INVERTED) \
+  X(W_OVERHEAT_STROBE_TOGGLE) \
+  X(W_OVERHEAT_LIGHTS_OFF_TOGGLE) \
+  X(W_OVERHEAT_SYNC_TO_FAN_TOGGLE) \
+  X(W_YEAR_MODES_CYCLE_EEPROM) \
+  X(W_BARREL_EXTENDED) \
+  X(W_BARREL_RETRACTED) \
+  X(W_MUSIC_NEXT_TRACK) \
+  X(W_MUSIC_PREV_TRACK) \
+  X(W_OVERHEAT_INCREASE_LEVEL_1) \
+  X(W_OVERHEAT_INCREASE_LEVEL_2) \
+  X(W_OVERHEAT_INCREASE_LEVEL_3) \
+  X(W_OVERHEAT_INCREASE_LEVEL_4) \
+  X(W_OVERHEAT_INCREASE_LEVEL_5) \
+  X(W_OVERHEAT_DECREASE_LEVEL_1) \
+  X(W_OVERHEAT_DECREASE_LEVEL_2) \
+  X(W_OVERHEAT_DECREASE_LEVEL_3) \
+  X(W_OVERHEAT_DECREASE_LEVEL_4) \
+  X(W_OVERHEAT_DECREASE_LEVEL_5) \
+  X(W_BARGRAPH_OVERHEAT_BLINK_ENABLED) \
+  X(W_BARGRAPH_OVERHEAT_BLINK_DISABLED) \
+  X(W_MODE_BEEP_LOOP_ENABLED) \
+  X(W_MODE_BEEP_LOOP_DISABLED) \
+  X(W_DEFAULT_BARGRAPH) \
+  X(W_MODE_ORIGINAL_BARGRAPH) \
+  X(W_SUPER_HERO_BARGRAPH) \
+  X(W_SUPER_HERO_FIRING_ANIMATIONS_BARGRAPH) \
+  X(W_MODE_ORIGINAL_FIRING_ANIMATIONS_BARGRAPH) \
+  X(W_DEFAULT_FIRING_ANIMATIONS_BARGRAPH) \
+  X(W_NEUTRONA_WAND_1984_MODE) \
+  X(W_NEUTRONA_WAND_1989_MODE) \
+  X(W_NEUTRONA_WAND_AFTERLIFE_MODE) \
+  X(W_NEUTRONA_WAND_FROZEN_EMPIRE_MODE) \
+  X(W_NEUTRONA_WAND_DEFAULT_MODE) \
+  X(W_DEMO_LIGHT_MODE_TOGGLE) \
+  X(W_CTS_DEFAULT) \
+  X(W_CTS_1984) \
+  X(W_CTS_AFTERLIFE) \
+  X(W_MODE_TOGGLE) \
+  X(W_OVERHEAT_LEVEL_5_ENABLED) \
+  X(W_OVERHEAT_LEVEL_4_ENABLED) \
+  X(W_OVERHEAT_LEVEL_3_ENABLED) \
+  X(W_OVERHEAT_LEVEL_2_ENABLED) \
+  X(W_OVERHEAT_LEVEL_1_ENABLED) \
+  X(W_OVERHEAT_LEVEL_5_DISABLED) \
+  X(W_OVERHEAT_LEVEL_4_DISABLED) \
+  X(W_OVERHEAT_LEVEL_3_DISABLED) \
+  X(W_OVERHEAT_LEVEL_2_DISABLED) \
+  X(W_OVERHEAT_LEVEL_1_DISABLED) \
+  X(W_CONTINUOUS_SMOKE_TOGGLE_5) \
+  X(W_CONTINUOUS_SMOKE_TOGGLE_4) \
+  X(W_CONTINUOUS_SMOKE_TOGGLE_3) \
+  X(W_CONTINUOUS_SMOKE_TOGGLE_2) \
+  X(W_CONTINUOUS_SMOKE_TOGGLE_1) \
+  X(W_VOLUME_DECREASE_EEPROM) \
+  X(W_VOLUME_INCREASE_EEPROM) \
+  X(W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_5) \
+  X(W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_4) \
+  X(W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_3) \
+  X(W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_2) \
+  X(W_SOUND_OVERHEAT_SMOKE_DURATION_LEVEL_1) \
+  X(W_SOUND_OVERHEAT_START_TIMER_LEVEL_5) \
+  X(W_SOUND_OVERHEAT_START_TIMER_LEVEL_4) \
+  X(W_SOUND_OVERHEAT_START_TIMER_LEVEL_3) \
+  X(W_SOUND_OVERHEAT_START_TIMER_LEVEL_2) \
+  X(W_SOUND_OVERHEAT_START_TIMER_LEVEL_1) \
+  X(W_SOUND_DEFAULT_SYSTEM_VOLUME_ADJUSTMENT) \
+  X(W_SEND_PREFERENCES_WAND) \
+  X(W_SEND_PREFERENCES_SMOKE) \
+  X(W_GB1_WAND_BARREL_EXTEND) \
+  X(W_AFTERLIFE_WAND_BARREL_EXTEND) \
+  X(W_WAND_BARREL_RETRACT) \
+  X(W_WAND_BOOTUP_SOUND) \
+  X(W_WAND_BOOTUP_SHORT_SOUND) \
+  X(W_WAND_SHUTDOWN_SOUND) \
+  X(W_WAND_MASH_ERROR_SOUND) \
+  X(W_WAND_BEEP_SOUNDS) \
+  X(W_WAND_BEEP_BARGRAPH) \
+  X(W_MODE_ORIGINAL_HEATUP_STOP) \
+  X(W_MODE_ORIGINAL_HEATUP) \
+  X(W_MODE_ORIGINAL_HEATDOWN_STOP) \
+  X(W_MODE_ORIGINAL_HEATDOWN) \
+  X(W_BEEPS_ALT) \
+  X(W_WAND_BEEP_STOP) \
+  X(W_WAND_BEEP_STOP_LOOP) \
+  X(W_WAND_BEEP_START) \
+  X(W_WAND_BEEP) \
+  X(W_MASH_ERROR_LOOP) \
+  X(W_MASH_ERROR_RESTART) \
+  X(W_BOSON_DART_SOUND) \
+  X(W_SHOCK_BLAST_SOUND) \
+  X(W_SLIME_TETHER_SOUND) \
+  X(W_MESON_COLLIDER_SOUND) \
+  X(W_MESON_FIRE_PULSE) \
+  X(W_TOGGLE_INNER_CYCLOTRON_PANEL) \
+  X(W_WAND_BOOTUP_1989) \
+  X(W_TOGGLE_POWERCELL_DIRECTION) \
+  X(W_TOGGLE_CYCLOTRON_FADING) \
+  X(W_BARGRAPH_28_SEGMENTS) \
+  X(W_BARGRAPH_30_SEGMENTS) \
+  X(W_RGB_VENT_DISABLED) \
+  X(W_RGB_VENT_ENABLED) \
+  X(W_COM_SOUND_NUMBER)
 
-enum api_messages : uint8_t {
-  A_NULL,
-  A_HANDSHAKE,
-  A_SYNC_START,
-  A_SYNC_DATA,
-  A_SYNC_END,
-  A_WAND_ON,
-  A_WAND_OFF,
-  A_FIRING,
-  A_FIRING_STOPPED,
-  A_SYSTEM_LOCKOUT,
-  A_CANCEL_LOCKOUT,
-  A_PROTON_MODE,
-  A_STASIS_MODE,
-  A_SLIME_MODE,
-  A_MESON_MODE,
-  A_SPECTRAL_MODE,
-  A_HALLOWEEN_MODE,
-  A_CHRISTMAS_MODE,
-  A_SPECTRAL_CUSTOM_MODE,
-  A_SETTINGS_MODE,
-  A_VENTING,
-  A_VENTING_FINISHED,
-  A_OVERHEATING,
-  A_OVERHEATING_FINISHED,
-  A_WARNING_CANCELLED,
-  A_CYCLOTRON_LID_ON,
-  A_CYCLOTRON_LID_OFF,
-  A_CYCLOTRON_NORMAL_SPEED,
-  A_CYCLOTRON_INCREASE_SPEED,
-  A_POWER_LEVEL_1,
-  A_POWER_LEVEL_2,
-  A_POWER_LEVEL_3,
-  A_POWER_LEVEL_4,
-  A_POWER_LEVEL_5,
-  A_MUSIC_TRACK_LOOP_TOGGLE,
-  A_VOLUME_SOUND_EFFECTS_INCREASE,
-  A_VOLUME_SOUND_EFFECTS_DECREASE,
-  A_VOLUME_MUSIC_INCREASE,
-  A_VOLUME_MUSIC_DECREASE,
-  A_MUSIC_NEXT_TRACK,
-  A_MUSIC_PREV_TRACK,
-  A_VOLUME_DECREASE,
-  A_VOLUME_INCREASE,
-  A_VOLUME_SYNC,
-  A_SAVE_EEPROM_SETTINGS_PACK,
-  A_SAVE_EEPROM_SETTINGS_WAND,
-  A_YEAR_FROZEN_EMPIRE,
-  A_YEAR_AFTERLIFE,
-  A_YEAR_1989,
-  A_YEAR_1984,
-  A_ALARM_ON,
-  A_ALARM_OFF,
-  A_PACK_ON,
-  A_PACK_OFF,
-  A_TURN_PACK_ON,
-  A_TURN_PACK_OFF,
-  A_SPECTRAL_COLOUR_DATA,
-  A_MUSIC_START_STOP,
-  A_TOGGLE_MUTE,
-  A_BARREL_EXTENDED,
-  A_BARREL_RETRACTED,
-  A_MODE_SUPER_HERO,
-  A_MODE_ORIGINAL,
-  A_ION_ARM_SWITCH_ON,
-  A_ION_ARM_SWITCH_OFF,
-  A_MANUAL_OVERHEAT,
-  A_MUSIC_TRACK_COUNT_SYNC,
-  A_MUSIC_PAUSE_RESUME,
-  A_MUSIC_IS_PLAYING,
-  A_MUSIC_IS_NOT_PLAYING,
-  A_MUSIC_IS_PAUSED,
-  A_MUSIC_IS_NOT_PAUSED,
-  A_MUSIC_PLAY_TRACK,
-  A_BATTERY_VOLTAGE_PACK,
-  A_WAND_POWER_AMPS,
-  A_WAND_CONNECTED,
-  A_WAND_DISCONNECTED,
-  A_REQUEST_PREFERENCES_PACK,
-  A_REQUEST_PREFERENCES_WAND,
-  A_REQUEST_PREFERENCES_SMOKE,
-  A_SEND_PREFERENCES_PACK,
-  A_SEND_PREFERENCES_WAND,
-  A_SEND_PREFERENCES_SMOKE,
-  A_SAVE_PREFERENCES_PACK,
-  A_SAVE_PREFERENCES_WAND,
-  A_SAVE_PREFERENCES_SMOKE
-};
\ No newline at end of file
+#define API_MESSAGES(X) \
+  X(A_NULL) \
+  X(A_HANDSHAKE) \
+  X(A_SYNC_START) \
+  X(A_SYNC_DATA) \
+  X(A_SYNC_END) \
+  X(A_WAND_ON) \
+  X(A_WAND_OFF) \
+  X(A_FIRING) \
+  X(A_FIRING_STOPPED) \
+  X(A_SYSTEM_LOCKOUT) \
+  X(A_CANCEL_LOCKOUT) \
+  X(A_PROTON_MODE) \
+  X(A_STASIS_MODE) \
+  X(A_SLIME_MODE) \
+  X(A_MESON_MODE) \
+  X(A_SPECTRAL_MODE) \
+  X(A_HALLOWEEN_MODE) \
+  X(A_CHRISTMAS_MODE) \
+  X(A_SPECTRAL_CUSTOM_MODE) \
+  X(A_SETTINGS_MODE) \
+  X(A_VENTING) \
+  X(A_VENTING_FINISHED) \
+  X(A_OVERHEATING) \
+  X(A_OVERHEATING_FINISHED) \
+  X(A_WARNING_CANCELLED) \
+  X(A_CYCLOTRON_LID_ON) \
+  X(A_CYCLOTRON_LID_OFF) \
+  X(A_CYCLOTRON_NORMAL_SPEED) \
+  X(A_CYCLOTRON_INCREASE_SPEED) \
+  X(A_POWER_LEVEL_1) \
+  X(A_POWER_LEVEL_2) \
+  X(A_POWER_LEVEL_3) \
+  X(A_POWER_LEVEL_4) \
+  X(A_POWER_LEVEL_5) \
+  X(A_MUSIC_TRACK_LOOP_TOGGLE) \
+  X(A_VOLUME_SOUND_EFFECTS_INCREASE) \
+  X(A_VOLUME_SOUND_EFFECTS_DECREASE) \
+  X(A_VOLUME_MUSIC_INCREASE) \
+  X(A_VOLUME_MUSIC_DECREASE) \
+  X(A_MUSIC_NEXT_TRACK) \
+  X(A_MUSIC_PREV_TRACK) \
+  X(A_VOLUME_DECREASE) \
+  X(A_VOLUME_INCREASE) \
+  X(A_VOLUME_SYNC) \
+  X(A_SAVE_EEPROM_SETTINGS_PACK) \
+  X(A_SAVE_EEPROM_SETTINGS_WAND) \
+  X(A_YEAR_FROZEN_EMPIRE) \
+  X(A_YEAR_AFTERLIFE) \
+  X(A_YEAR_1989) \
+  X(A_YEAR_1984) \
+  X(A_ALARM_ON) \
+  X(A_ALARM_OFF) \
+  X(A_PACK_ON) \
+  X(A_PACK_OFF) \
+  X(A_TURN_PACK_ON) \
+  X(A_TURN_PACK_OFF) \
+  X(A_SPECTRAL_COLOUR_DATA) \
+  X(A_MUSIC_START_STOP) \
+  X(A_TOGGLE_MUTE) \
+  X(A_BARREL_EXTENDED) \
+  X(A_BARREL_RETRACTED) \
+  X(A_MODE_SUPER_HERO) \
+  X(A_MODE_ORIGINAL) \
+  X(A_ION_ARM_SWITCH_ON) \
+  X(A_ION_ARM_SWITCH_OFF) \
+  X(A_MANUAL_OVERHEAT) \
+  X(A_MUSIC_TRACK_COUNT_SYNC) \
+  X(A_MUSIC_PAUSE_RESUME) \
+  X(A_MUSIC_IS_PLAYING) \
+  X(A_MUSIC_IS_NOT_PLAYING) \
+  X(A_MUSIC_IS_PAUSED) \
+  X(A_MUSIC_IS_NOT_PAUSED) \
+  X(A_MUSIC_PLAY_TRACK) \
+  X(A_BATTERY_VOLTAGE_PACK) \
+  X(A_WAND_POWER_AMPS) \
+  X(A_WAND_CONNECTED) \
+  X(A_WAND_DISCONNECTED) \
+  X(A_REQUEST_PREFERENCES_PACK) \
+  X(A_REQUEST_PREFERENCES_WAND) \
+  X(A_REQUEST_PREFERENCES_SMOKE) \
+  X(A_SEND_PREFERENCES_PACK) \
+  X(A_SEND_PREFERENCES_WAND) \
+  X(A_SEND_PREFERENCES_SMOKE) \
+  X(A_SAVE_PREFERENCES_PACK) \
+  X(A_SAVE_PREFERENCES_WAND) \
+  X(A_SAVE_PREFERENCES_SMOKE) \
+  X(A_LOOP_PROFILE) \
+  X(A_LINK_STATS) \
+  X(A_MUSIC_SHUFFLE_TOGGLE) \
+  X(A_MUSIC_PLAYLIST)
+
+// Types of packets to be sent. Values are fixed, as not every device handles every type.
+#define PACKET_TYPES(X) \
+  X(PACKET_UNKNOWN, 0) \
+  X(PACKET_COMMAND, 1) \
+  X(PACKET_DATA, 2) \
+  X(PACKET_PACK, 3) \
+  X(PACKET_WAND, 4) \
+  X(PACKET_SMOKE, 5) \
+  X(PACKET_SYNC, 6) \
+  X(PACKET_PROFILE, 7) \
+  X(PACKET_SYNC_DELTA, 8) \
+  X(PACKET_RELIABLE, 9) \
+  X(PACKET_ACK, 10) \
+  X(PACKET_LINK_STATS, 11)
+
+// For command signals (1 byte ID, 2 byte optional data).
+#define COMMAND_PACKET_FIELDS(X) \
+  X(uint8_t, s) \
+  X(uint8_t, c) \
+  X(uint16_t, d1) /* Reserved for values over 255 (eg. current music track) */ \
+  X(uint8_t, e)
+
+// For generic data communication (1 byte ID, 4 byte array).
+#define MESSAGE_PACKET_FIELDS(X) \
+  X(uint8_t, s) \
+  X(uint8_t, m) \
+  X(uint8_t, d[3]) /* Reserved for multiple, arbitrary byte values. */ \
+  X(uint8_t, e)
+
+// Most music tracks in an order sent with A_MUSIC_PLAYLIST. The message carries the track count in d[0] and is followed
+// by that many uint16_t track numbers, all in one packet.
+#define MUSIC_PLAYLIST_SIZE 32
+
+// Header of a frame sent with acknowledged delivery, ahead of the packet it carries.
+#define RELIABLE_HEADER_FIELDS(X) \
+  X(uint8_t, seq) \
+  X(uint8_t, type) /* Packet type of the contents which follow the header. */
+
+// Pack preferences, as edited from the Attenuator.
+#define PACK_PREFS_FIELDS(X) \
+  X(uint8_t, defaultSystemModePack) \
+  X(uint8_t, defaultYearThemePack) \
+  X(uint8_t, currentYearThemePack) \
+  X(uint8_t, defaultSystemVolume) \
+  X(uint8_t, packVibration) \
+  X(uint8_t, ribbonCableAlarm) \
+  X(uint8_t, cyclotronDirection) \
+  X(uint8_t, demoLightMode) \
+  X(uint8_t, protonStreamEffects) \
+  X(uint8_t, overheatStrobeNF) \
+  X(uint8_t, overheatSyncToFan) \
+  X(uint8_t, overheatLightsOff) \
+  X(uint8_t, ledCycLidCount) \
+  X(uint8_t, ledCycLidHue) \
+  X(uint8_t, ledCycLidSat) \
+  X(uint8_t, ledCycLidCenter) \
+  X(uint8_t, ledCycLidFade) \
+  X(uint8_t, ledCycLidSimRing) \
+  X(uint8_t, ledCycInnerPanel) \
+  X(uint8_t, ledCycCakeCount) \
+  X(uint8_t, ledCycCakeHue) \
+  X(uint8_t, ledCycCakeSat) \
+  X(uint8_t, ledCycCakeGRB) \
+  X(uint8_t, ledCycCavCount) \
+  X(uint8_t, ledCycCavType) \
+  X(uint8_t, ledVGCyclotron) \
+  X(uint8_t, ledPowercellCount) \
+  X(uint8_t, ledInvertPowercell) \
+  X(uint8_t, ledPowercellHue) \
+  X(uint8_t, ledPowercellSat) \
+  X(uint8_t, ledVGPowercell)
+
+// Wand preferences, as edited from the Attenuator.
+#define WAND_PREFS_FIELDS(X) \
+  X(uint8_t, ledWandCount) \
+  X(uint8_t, ledWandHue) \
+  X(uint8_t, ledWandSat) \
+  X(uint8_t, rgbVentEnabled) \
+  X(uint8_t, spectralModesEnabled) \
+  X(uint8_t, overheatEnabled) \
+  X(uint8_t, defaultFiringMode) \
+  X(uint8_t, wandVibration) \
+  X(uint8_t, wandSoundsToPack) \
+  X(uint8_t, quickVenting) \
+  X(uint8_t, autoVentLight) \
+  X(uint8_t, wandBeepLoop) \
+  X(uint8_t, wandBootError) \
+  X(uint8_t, defaultYearModeWand) \
+  X(uint8_t, defaultYearModeCTS) \
+  X(uint8_t, numBargraphSegments) \
+  X(uint8_t, invertWandBargraph) \
+  X(uint8_t, bargraphOverheatBlink) \
+  X(uint8_t, bargraphIdleAnimation) \
+  X(uint8_t, bargraphFireAnimation)
+
+// Smoke and overheat preferences, shared between the pack and wand.
+#define SMOKE_PREFS_FIELDS(X) \
+  /* Pack */ \
+  X(uint8_t, smokeEnabled) \
+  X(uint8_t, overheatContinuous5) \
+  X(uint8_t, overheatContinuous4) \
+  X(uint8_t, overheatContinuous3) \
+  X(uint8_t, overheatContinuous2) \
+  X(uint8_t, overheatContinuous1) \
+  X(uint8_t, overheatDuration5) \
+  X(uint8_t, overheatDuration4) \
+  X(uint8_t, overheatDuration3) \
+  X(uint8_t, overheatDuration2) \
+  X(uint8_t, overheatDuration1) \
+  /* Wand */ \
+  X(uint8_t, overheatLevel5) \
+  X(uint8_t, overheatLevel4) \
+  X(uint8_t, overheatLevel3) \
+  X(uint8_t, overheatLevel2) \
+  X(uint8_t, overheatLevel1) \
+  X(uint8_t, overheatDelay5) \
+  X(uint8_t, overheatDelay4) \
+  X(uint8_t, overheatDelay3) \
+  X(uint8_t, overheatDelay2) \
+  X(uint8_t, overheatDelay1)
+
+// State sent by the pack to synchronize a wand.
+#define WAND_SYNC_FIELDS(X) \
+  X(uint8_t, systemMode) \
+  X(uint8_t, ionArmSwitch) \
+  X(uint8_t, cyclotronLidState) \
+  X(uint8_t, systemYear) \
+  X(uint8_t, packOn) \
+  X(uint8_t, powerLevel) \
+  X(uint8_t, streamMode) \
+  X(uint8_t, vibrationEnabled) \
+  X(uint8_t, masterVolume) \
+  X(uint8_t, effectsVolume) \
+  X(uint8_t, masterMuted) \
+  X(uint8_t, repeatMusicTrack)
+
+// State sent by the pack to synchronize the Attenuator, with the bit used for each field in a PACKET_SYNC_DELTA.
+#define ATTENUATOR_SYNC_FIELDS(X) \
+  X(uint8_t, systemMode, SYNC_SYSTEM_MODE) \
+  X(uint8_t, ionArmSwitch, SYNC_ION_ARM_SWITCH) \
+  X(uint8_t, cyclotronLidState, SYNC_CYCLOTRON_LID_STATE) \
+  X(uint8_t, systemYear, SYNC_SYSTEM_YEAR) \
+  X(uint8_t, packOn, SYNC_PACK_ON) \
+  X(uint8_t, powerLevel, SYNC_POWER_LEVEL) \
+  X(uint8_t, streamMode, SYNC_STREAM_MODE) \
+  X(uint8_t, wandPresent, SYNC_WAND_PRESENT) \
+  X(uint8_t, barrelExtended, SYNC_BARREL_EXTENDED) \
+  X(uint8_t, wandFiring, SYNC_WAND_FIRING) \
+  X(uint8_t, overheatingNow, SYNC_OVERHEATING_NOW) \
+  X(uint8_t, speedMultiplier, SYNC_SPEED_MULTIPLIER) \
+  X(uint8_t, spectralColour, SYNC_SPECTRAL_COLOUR) \
+  X(uint8_t, spectralSaturation, SYNC_SPECTRAL_SATURATION) \
+  X(uint8_t, masterMuted, SYNC_MASTER_MUTED) \
+  X(uint8_t, masterVolume, SYNC_MASTER_VOLUME) \
+  X(uint8_t, effectsVolume, SYNC_EFFECTS_VOLUME) \
+  X(uint8_t, musicVolume, SYNC_MUSIC_VOLUME) \
+  X(uint8_t, musicPlaying, SYNC_MUSIC_PLAYING) \
+  X(uint8_t, musicPaused, SYNC_MUSIC_PAUSED) \
+  X(uint8_t, trackLooped, SYNC_TRACK_LOOPED) \
+  X(uint8_t, musicShuffled, SYNC_MUSIC_SHUFFLED) \
+  X(uint16_t, currentTrack, SYNC_CURRENT_TRACK) \
+  X(uint16_t, musicCount, SYNC_MUSIC_COUNT) \
+  X(uint16_t, packVoltage, SYNC_PACK_VOLTAGE)
+
+// Health counters for one serial link, reported by the pack to the Attenuator.
+#define LINK_STATS_FIELDS(X) \
+  X(uint16_t, rxPackets) /* Packets which passed the CRC. */ \
+  X(uint16_t, rxCrcErrors) \
+  X(uint16_t, rxPayloadErrors) /* Invalid payload length. */ \
+  X(uint16_t, rxStopByteErrors) \
+  X(uint16_t, rxStaleErrors) /* Packets abandoned part-way through. */ \
+  X(uint16_t, rxBadMarkers) /* Packets which passed the CRC but carried the wrong start/end markers. */ \
+  X(uint32_t, txBytes) \
+  X(uint16_t, retransmits) /* Reliable frames sent again for want of an acknowledgement. */ \
+  X(uint16_t, failures) /* Reliable frames abandoned after every retry. */ \
+  X(uint16_t, rttLast) /* us - Round trip of the last reliable frame acknowledged on its first send. */ \
+  X(uint16_t, rttMax) /* us */ \
+  X(uint8_t, baudRate) /* Active BAUD_RATE_OPTIONS value. */ \
+  X(uint8_t, protocolMatch) /* 0 = Not reported, 1 = Same schema, 2 = Different schema. */
+
+// Field mask followed by only the changed AttenuatorSyncData fields, packed back to back in struct order.
+#define SYNC_DELTA_FIELDS(X) \
+  X(uint32_t, fields) \
+  X(uint8_t, d[sizeof(AttenuatorSyncData)])
+
+/*
+ * Expansions of the lists above.
+ */
+#define PROTOCOL_ENUM(name) name,
+#define PROTOCOL_ENUM_VALUE(name, value) name = value,
+#define PROTOCOL_FIELD(type, name) type name;
+#define PROTOCOL_SYNC_FIELD(type, name, id) type name;
+#define PROTOCOL_SYNC_ID(type, name, id) id,
+#define PROTOCOL_SYNC_SIZE(type, name, id) sizeof(type),
+
+enum device_ids : uint8_t { DEVICE_IDS(PROTOCOL_ENUM) };
+enum pack_messages : uint8_t { PACK_MESSAGES(PROTOCOL_ENUM) };
+enum wand_messages : uint8_t { WAND_MESSAGES(PROTOCOL_ENUM) };
+enum api_messages : uint8_t { API_MESSAGES(PROTOCOL_ENUM) };
+enum PACKET_TYPE : uint8_t { PACKET_TYPES(PROTOCOL_ENUM_VALUE) };
+
+struct __attribute__((packed)) CommandPacket { COMMAND_PACKET_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) MessagePacket { MESSAGE_PACKET_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) ReliableHeader { RELIABLE_HEADER_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) PackPrefs { PACK_PREFS_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) WandPrefs { WAND_PREFS_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) SmokePrefs { SMOKE_PREFS_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) WandSyncData { WAND_SYNC_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) AttenuatorSyncData { ATTENUATOR_SYNC_FIELDS(PROTOCOL_SYNC_FIELD) };
+struct __attribute__((packed)) SyncDeltaPacket { SYNC_DELTA_FIELDS(PROTOCOL_FIELD) };
+struct __attribute__((packed)) LinkStats { LINK_STATS_FIELDS(PROTOCOL_FIELD) };
+
+// Bit positions for each AttenuatorSyncData field (in struct order) within a PACKET_SYNC_DELTA field mask.
+enum SYNC_FIELDS : uint8_t { ATTENUATOR_SYNC_FIELDS(PROTOCOL_SYNC_ID) SYNC_FIELD_COUNT };
+
+/*
+ * Schema hash.
+ * Every name, type and value above is spelled out in one string, which is hashed at compile time. The string
+ * only exists while compiling, so it costs nothing in flash or RAM.
+ */
+#define PROTOCOL_TEXT_NAME(name) #name ","
+#define PROTOCOL_TEXT_VALUE(name, value) #name "=" #value ","
+#define PROTOCOL_TEXT_FIELD(type, name) #type " " #name ";"
+#define PROTOCOL_TEXT_SYNC_FIELD(type, name, id) #type " " #name ";"
+
+constexpr char protocol_schema[] =
+  "device_ids{" DEVICE_IDS(PROTOCOL_TEXT_NAME) "}"
+  "pack_messages{" PACK_MESSAGES(PROTOCOL_TEXT_NAME) "}"
+  "wand_messages{" WAND_MESSAGES(PROTOCOL_TEXT_NAME) "}"
+  "api_messages{" API_MESSAGES(PROTOCOL_TEXT_NAME) "}"
+  "PACKET_TYPE{" PACKET_TYPES(PROTOCOL_TEXT_VALUE) "}"
+  "CommandPacket{" COMMAND_PACKET_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "MessagePacket{" MESSAGE_PACKET_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "ReliableHeader{" RELIABLE_HEADER_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "PackPrefs{" PACK_PREFS_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "WandPrefs{" WAND_PREFS_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "SmokePrefs{" SMOKE_PREFS_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "WandSyncData{" WAND_SYNC_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "AttenuatorSyncData{" ATTENUATOR_SYNC_FIELDS(PROTOCOL_TEXT_SYNC_FIELD) "}"
+  "SyncDeltaPacket{" SYNC_DELTA_FIELDS(PROTOCOL_TEXT_FIELD) "}"
+  "LinkStats{" LINK_STATS_FIELDS(PROTOCOL_TEXT_FIELD) "}";
+
+// Returns i_base raised to the power i_exp (modulo 2^32).
+constexpr uint32_t protocolHashPower(uint32_t i_base, uint16_t i_exp) {
+  return i_exp == 0 ? 1 : ((i_exp & 1) ? i_base : 1) * protocolHashPower(i_base * i_base, i_exp >> 1);
+}
+
+// Polynomial hash of a range of characters. Each half is hashed separately and then combined, which keeps
+// the depth of compile-time recursion small for a string of this length.
+constexpr uint32_t protocolHashRange(const char *s, uint16_t i_start, uint16_t i_length) {
+  return i_length == 0 ? 0 :
+         i_length == 1 ? (uint8_t) s[i_start] :
+         protocolHashRange(s, i_start, i_length / 2) * protocolHashPower(131, i_length - i_length / 2) +
+         protocolHashRange(s, i_start + i_length / 2, i_length - i_length / 2);
+}
+
+// Folds a hash to 16 bits, never returning 0 as that means no hash was sent.
+constexpr uint16_t protocolHashFold(uint32_t i_hash) {
+  return (uint16_t) (i_hash ^ (i_hash >> 16)) == 0 ? 1 : (uint16_t) (i_hash ^ (i_hash >> 16));
+}
+
+// Sent by every device while synchronizing, to confirm both ends were built from the same schema.
+constexpr uint16_t i_protocol_hash = protocolHashFold(protocolHashRange(protocol_schema, 0, sizeof(protocol_schema) - 1));
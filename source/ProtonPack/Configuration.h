@@ -297,6 +297,16 @@ const uint8_t VOLUME_MUSIC_MULTIPLIER = 5;
  */
 const uint8_t VOLUME_EFFECTS_MULTIPLIER = 5;
 
+/*
+ * Music ducking: while the wand is firing or the pack is overheating or venting, the music is faded down so those
+ * sound effects are not drowned out, then faded back up once they are all over.
+ * MUSIC_DUCKING_DEPTH is how far the music is lowered, in decibels. Set to 0 to disable ducking.
+ * MUSIC_DUCKING_ATTACK and MUSIC_DUCKING_RELEASE are the fade times (in milliseconds) going down and coming back up.
+ */
+const uint8_t MUSIC_DUCKING_DEPTH = 12;
+const uint16_t MUSIC_DUCKING_ATTACK = 150;
+const uint16_t MUSIC_DUCKING_RELEASE = 1500;
+
 /*
  * Set to true to enable the onboard amplifier on the WAV Trigger.
  * This is for the WAV Trigger only and does not affect GPStar Audio.
@@ -171,14 +171,39 @@ CRGB cyclotron_leds[INNER_CYCLOTRON_LED_PANEL_MAX + INNER_CYCLOTRON_CAKE_LED_MAX
  * for the Inner Cyclotron, and the optional "sparking" cyclotron cavity LEDs.
  * 0.0312 ms to update each LED, then a 0.05 ms resting period once all are updated.
  * So 4 ms should be okay. Let's bump it up to 5 just in case.
- * For cyclotrons with high density LEDs, increase this based on the cyclotron speed multiplier to simulate a faster spinning cyclotron.
- * This works by "skipping frames" in the animation, which can be done up until about 15 ms.
- * After 15ms it will become painfully obvious to most people that the animation is not smooth.
+ * The Afterlife/Frozen Empire Cyclotron spin is timed against micros() (see cyclotronSpinSteps()), so its speed does not
+ * depend on how often the LEDs are refreshed and this no longer needs raising for high density lids.
  */
 #define FAST_LED_UPDATE_MS 5
 uint8_t i_fast_led_delay = FAST_LED_UPDATE_MS;
 millisDelay ms_fast_led;
 
+/*
+ * The two LED chains are pushed out on alternating frames (at twice the rate), so interrupts are only ever held
+ * off for one chain at a time. A frame is also held back while a serial packet is arriving, though for no more
+ * than 15 ms so the animations cannot stall under constant traffic. The counters show how often each happened.
+ */
+const uint8_t i_fast_led_hold_max = 15;
+CLEDController *pack_led_controller = nullptr;
+CLEDController *cyclotron_led_controller = nullptr;
+bool b_fast_led_cyclotron_next = false; // Which chain the next frame will update.
+bool b_fast_led_held = false; // The current frame is waiting for a serial packet to finish.
+uint32_t i_fast_led_held_since = 0;
+uint16_t i_fast_led_frames_deferred = 0; // Frames which had to wait for a serial packet.
+uint16_t i_fast_led_frames_forced = 0; // Frames sent while a packet was still arriving, after waiting the maximum.
+
+/*
+ * Each chain is only pushed out when its pixels (or the global brightness) changed since it was last sent, which is
+ * tracked with a cheap checksum of the buffer rather than a second copy of it. An unchanged chain is still refreshed
+ * once a second, in case a pixel was corrupted by noise on the data line or the checksum happened to collide.
+ */
+const uint16_t i_fast_led_refresh_max = 1000;
+uint32_t i_fast_led_pack_checksum = 0;
+uint32_t i_fast_led_cyclotron_checksum = 0;
+uint32_t i_fast_led_pack_sent = 0; // When each chain was last sent (ms).
+uint32_t i_fast_led_cyclotron_sent = 0;
+uint32_t i_fast_led_frames_skipped = 0; // Frames not sent because the chain was unchanged.
+
 /*
  * Power Cell LEDs control.
  */
@@ -230,10 +255,33 @@ bool b_1984_led_start = true;
 millisDelay ms_cyclotron;
 millisDelay ms_cyclotron_slime_effect;
 rampUnsignedInt r_outer_cyclotron_ramp;
-bool b_cyclotron_led_fading_in[OUTER_CYCLOTRON_LED_MAX] = { false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false };
-ramp r_cyclotron_led_fade_out[OUTER_CYCLOTRON_LED_MAX] = {};
-ramp r_cyclotron_led_fade_in[OUTER_CYCLOTRON_LED_MAX] = {};
 uint8_t i_cyclotron_led_value[OUTER_CYCLOTRON_LED_MAX] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/*
+ * Outer Cyclotron LED fades.
+ * Each LED (or ring position) has at most one fade at a time: in from 0 to a level, or out from a level to 0.
+ * Fades are kept in packed arrays indexed like i_cyclotron_led_value, and a bitmap of the LEDs which still have
+ * work to do lets cyclotronFade() skip every idle LED.
+ */
+enum FADE_CURVES : uint8_t { FADE_CIRCULAR_IN, FADE_CIRCULAR_OUT, FADE_QUARTIC_IN, FADE_QUARTIC_OUT };
+
+// Easing curves (as in the Ramp library) sampled at 129 even steps from 0 to 255, interpolated in between.
+// Only the "in" half of each curve is stored; the "out" half is the same curve mirrored.
+const uint8_t i_fade_curve_circular[129] PROGMEM = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 5, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 13, 13, 14, 15, 16, 16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 37, 38, 39, 40, 42, 43, 44, 46, 47, 48, 50, 51, 53, 54, 56, 58, 59, 61, 63, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 89, 91, 93, 96, 98, 101, 104, 106, 109, 112, 115, 118, 121, 125, 128, 132, 135, 139, 143, 147, 152, 156, 161, 166, 172, 178, 184, 192, 200, 210, 223, 255 };
+const uint8_t i_fade_curve_quartic[129] PROGMEM = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7, 8, 9, 9, 10, 11, 12, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 26, 27, 28, 30, 32, 33, 35, 37, 39, 41, 43, 45, 47, 50, 52, 54, 57, 60, 62, 65, 68, 71, 74, 77, 81, 84, 88, 91, 95, 99, 103, 107, 111, 115, 120, 125, 129, 134, 139, 144, 149, 155, 160, 166, 172, 178, 184, 190, 197, 204, 210, 217, 225, 232, 239, 247, 255 };
+
+const uint8_t FADE_RUNNING = 0x01; // The fade has not reached its end yet.
+const uint8_t FADE_OUT = 0x02; // The fade runs from the level down to 0 (otherwise from 0 up to the level).
+const uint8_t FADE_LED_FADING_IN = 0x04; // The LED is waiting to fade in (or is fading in) rather than fading out.
+
+struct CyclotronFades {
+  uint16_t i_start[OUTER_CYCLOTRON_LED_MAX]; // Low 16 bits of millis() when the fade started.
+  uint16_t i_duration[OUTER_CYCLOTRON_LED_MAX]; // Length of the fade in milliseconds.
+  uint8_t i_level[OUTER_CYCLOTRON_LED_MAX]; // Brightness faded up to, or down from.
+  uint8_t i_curve[OUTER_CYCLOTRON_LED_MAX]; // One of FADE_CURVES.
+  uint8_t i_flags[OUTER_CYCLOTRON_LED_MAX]; // FADE_RUNNING, FADE_OUT and FADE_LED_FADING_IN.
+  uint8_t i_active[(OUTER_CYCLOTRON_LED_MAX + 7) / 8]; // One bit per LED which is fading or lit.
+} cyclotronFades;
 uint8_t i_cyclotron_fake_ring_counter = 0; // Counter used by the ring simulation code to count how many times we have processed the "0" value in the matrix.
 bool b_cyclotron_lid_on = true;
 bool b_brass_pack_sound_loop = false;
@@ -244,6 +292,23 @@ const uint8_t i_cyclotron_20led_matrix[OUTER_CYCLOTRON_LED_MAX] PROGMEM = { 1, 2
 const uint8_t i_cyclotron_36led_matrix[OUTER_CYCLOTRON_LED_MAX] PROGMEM = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 28, 29, 30, 31, 32, 33, 34, 35, 36, 0 };
 const uint8_t i_cyclotron_40led_matrix[OUTER_CYCLOTRON_LED_MAX] PROGMEM = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40 };
 
+// The inverse of the matrix above: for each physical lid LED (in order), the position on the 40 position circle it sits at.
+const uint8_t i_cyclotron_12led_positions[HASLAB_CYCLOTRON_LED_COUNT] PROGMEM = { 0, 1, 2, 10, 11, 12, 20, 21, 22, 30, 31, 32 };
+const uint8_t i_cyclotron_20led_positions[FRUTTO_CYCLOTRON_LED_COUNT] PROGMEM = { 0, 1, 2, 3, 4, 10, 11, 12, 13, 14, 20, 21, 22, 23, 24, 30, 31, 32, 33, 34 };
+const uint8_t i_cyclotron_36led_positions[FRUTTO_MAX_CYCLOTRON_LED_COUNT] PROGMEM = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 30, 31, 32, 33, 34, 35, 36, 37, 38 };
+const uint8_t i_cyclotron_40led_positions[OUTER_CYCLOTRON_LED_MAX] PROGMEM = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 };
+
+// Frame tables for the fitted lid, resolved from i_cyclotron_leds and b_clockwise by cyclotronFrameTableUpdate().
+// All pointers refer to the PROGMEM tables above (and the 1984 tables in Configuration.h).
+struct CyclotronFrameTable {
+  uint8_t i_lid_leds = 0; // Value of i_cyclotron_leds the tables were resolved for (0 = not yet resolved).
+  bool b_clockwise = true; // Value of b_clockwise the 1984 table was resolved for.
+  uint8_t i_count = 0; // Number of populated positions (physical LEDs) on the lid.
+  const uint8_t *p_matrix = nullptr; // Position -> lid LED (1-based, 0 for a gap).
+  const uint8_t *p_positions = nullptr; // Lid LED -> position, populated positions only.
+  const uint8_t *p_1984 = nullptr; // The four 1984/1989 lens LEDs in spin order.
+} cyclotronFrames;
+
 /*
  * Inner Cyclotron LED Panel
  * Individual = Use stock connectors on the pack controller for individual LEDs [Default]
@@ -273,6 +338,30 @@ uint8_t i_ic_cake_end = i_ic_cake_start + INNER_CYCLOTRON_CAKE_LED_MAX - 1;
 uint8_t i_ic_cavity_start = i_ic_cake_end + 1;
 uint8_t i_ic_cavity_end = i_ic_cavity_start + INNER_CYCLOTRON_CAVITY_LED_MAX - 1;
 
+/*
+ * Animation clock.
+ * The Cyclotron speed ramps are sampled once per pass of loop() by animationFrameTick(), and every consumer (Cyclotron,
+ * Inner Cyclotron, Power Cell and switch plate LEDs) reads the snapshot so they all see the same value within a pass.
+ */
+struct AnimationFrame {
+  uint16_t i_outer_ramp = 0; // Current value of r_outer_cyclotron_ramp.
+  uint16_t i_inner_ramp = 0; // Current value of r_inner_cyclotron_ramp.
+} animationFrame;
+
+/*
+ * Cyclotron spin clock.
+ * The step timers for the Afterlife/Frozen Empire outer Cyclotron and the Inner Cyclotron ring still set the speed,
+ * but when one fires the number of LEDs to advance comes from the micros() elapsed since the last step, so a slow
+ * pass of loop() cannot slow the spin down. The Inner Cyclotron ring also uses the time since the last step to blend
+ * the lit LED into the next one between steps.
+ * Catching up is limited to a few steps; anything longer (such as the timer having been stopped) starts afresh.
+ */
+const uint8_t i_cyclotron_spin_max_steps = 4;
+uint32_t i_outer_cyclotron_last_step = 0; // micros() of the last whole LED step.
+uint32_t i_inner_cyclotron_last_step = 0;
+int8_t i_cyclotron_ring_drawn[2] = { -1, -1 }; // Inner Cyclotron ring LEDs currently lit by the blend (trailing, leading).
+CRGB c_cyclotron_ring_colour; // Inner Cyclotron ring colour for the current step, resolved once when the step is taken.
+
 /*
  * Cyclotron Switch Plate LEDs
  */
@@ -484,11 +573,19 @@ millisDelay ms_fadeout;
 void packSerialSend(uint8_t i_command, uint16_t i_value);
 void packSerialSend(uint8_t i_command);
 void packSerialSendData(uint8_t i_message);
+void packSerialFlush();
 void serial1Send(uint8_t i_command, uint16_t i_value);
 void serial1Send(uint8_t i_command);
 void serial1SendData(uint8_t i_message);
+void serial1Flush();
+void serial1SendSyncDelta();
+void serial1SendLinkStats();
+void updateAttenuatorSyncData();
 void checkSerial1();
 void checkWand();
+bool serialReceiveInProgress();
+void serial1BaudRateFallback(bool b_lock);
+void wandBaudRateFallback(bool b_lock);
 void powercellDraw(uint8_t i_start = 0);
 
 /*
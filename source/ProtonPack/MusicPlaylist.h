@@ -0,0 +1,284 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/*
+ * Decides which music track follows the current one.
+ * By default every track on the SD card is played in file order. The Attenuator may push its own order of up to
+ * MUSIC_PLAYLIST_SIZE tracks, which is then played instead until it is cleared. With shuffle enabled, whichever list is
+ * in use is played in a random order where every entry is heard once before any is repeated (one pass), and a new
+ * order is drawn for each pass. The first track of a pass is never the last track of the one before it.
+ * A shuffled order is not stored. Each entry position is scrambled by a small invertible mix of its bits (seeded per
+ * pass), repeating the mix while the result falls outside the list ("cycle walking"), which maps the positions of the
+ * list onto themselves. This keeps the cost to a few bytes no matter how many tracks are on the SD card. The order of
+ * the following pass is drawn ahead of time so the track after the current one is always known, even at the end of a
+ * pass, which is what allows it to be handed to the audio board before the current track finishes.
+ * The position in the list is kept in step with the track actually playing: if the current track is not the entry at
+ * the stored position (such as after a track was picked from the Attenuator), the track is looked up first. Only a
+ * shuffled list of every track on the SD card is not searched, as that would be too slow; the stored position is used.
+ * Whenever the list or the shuffle setting changes, a shuffled list starts a fresh pass from its first entry while an
+ * ordered one carries on from the current track.
+ * MUSIC_PLAYLIST_SIZE comes from Communication.h, as it also bounds the order the Attenuator may send.
+ */
+
+class MusicPlaylist {
+  public:
+    // Every track from i_first onwards, in file order. An order pushed by the Attenuator is kept, less any tracks which
+    // are not on the SD card, so one sent before the audio board answered is not lost.
+    void begin(uint16_t i_first, uint16_t i_count) {
+      uint16_t i_kept = 0;
+
+      if(b_tracks_known && i_first == i_first_track && i_count == i_track_count) {
+        return;
+      }
+
+      b_tracks_known = true;
+      i_first_track = i_first;
+      i_track_count = i_count;
+
+      for(uint16_t i = 0; i < i_length; i++) {
+        if(exists(i_tracks[i])) {
+          i_tracks[i_kept++] = i_tracks[i];
+        }
+      }
+
+      i_length = i_kept;
+      resize();
+    }
+
+    // Goes back to playing every track on the SD card.
+    void clear() {
+      i_length = 0;
+      resize();
+    }
+
+    // Appends a track to the user-defined order. False if the track does not exist or the list is full.
+    // Until begin() gives the tracks on the SD card, any track is taken.
+    bool add(uint16_t i_track) {
+      if((b_tracks_known && !exists(i_track)) || i_length >= MUSIC_PLAYLIST_SIZE) {
+        return false;
+      }
+
+      i_tracks[i_length++] = i_track;
+      resize();
+
+      return true;
+    }
+
+    void shuffle(bool b_enable) {
+      if(b_shuffle != b_enable) {
+        b_shuffle = b_enable;
+
+        // Start a fresh pass rather than carrying on from a position which means something else in the new order.
+        resize();
+      }
+    }
+
+    bool isShuffled() const {
+      return b_shuffle;
+    }
+
+    // Number of entries in the list being played.
+    uint16_t size() const {
+      return i_length > 0 ? i_length : i_track_count;
+    }
+
+    // The track which next() would return, without moving on to it.
+    uint16_t peekNext(uint16_t i_current) {
+      uint16_t i_position;
+      uint8_t i_pass;
+
+      if(size() == 0) {
+        return i_current;
+      }
+
+      locate(i_current);
+      i_position = i_position_now;
+      i_pass = i_pass_now;
+      stepForward(i_current, i_position, i_pass);
+
+      return entry(i_position, i_pass);
+    }
+
+    uint16_t next(uint16_t i_current) {
+      uint8_t i_pass = i_pass_now;
+
+      if(size() == 0) {
+        return i_current;
+      }
+
+      locate(i_current);
+      stepForward(i_current, i_position_now, i_pass_now);
+
+      if(i_pass_now != i_pass) {
+        // A new pass has started; draw the order of the one after it.
+        reseed(i_pass);
+      }
+
+      return entry(i_position_now, i_pass_now);
+    }
+
+    uint16_t prev(uint16_t i_current) {
+      if(size() == 0) {
+        return i_current;
+      }
+
+      locate(i_current);
+
+      // Going back stays within the current pass, so wraps around to its last entry.
+      for(uint8_t i = 0; i < 2; i++) {
+        i_position_now = (i_position_now == POSITION_NONE || i_position_now == 0) ? size() - 1 : i_position_now - 1;
+
+        if(size() < 2 || entry(i_position_now, i_pass_now) != i_current) {
+          break;
+        }
+      }
+
+      return entry(i_position_now, i_pass_now);
+    }
+
+  private:
+    static const uint16_t POSITION_NONE = 0xFFFF;
+
+    struct PassSeed {
+      uint16_t i_mult; // Always odd.
+      uint16_t i_add;
+    };
+
+    uint16_t i_tracks[MUSIC_PLAYLIST_SIZE];
+    uint16_t i_length = 0; // Entries in i_tracks; 0 when playing every track in file order.
+    uint16_t i_first_track = 0;
+    uint16_t i_track_count = 0;
+    uint16_t i_position_now = POSITION_NONE; // Entry of the current track, or none before the first track of a list.
+    uint8_t i_pass_now = 0; // Which of the two seeds orders the current pass.
+    PassSeed seeds[2] = {};
+    uint16_t i_mask = 0; // All ones, covering every entry position.
+    uint8_t i_shift = 1;
+    bool b_shuffle = false;
+    bool b_tracks_known = false; // Whether begin() has been told the tracks on the SD card yet.
+
+    // Moves one entry on, skipping the current track so it is not heard twice in a row.
+    void stepForward(uint16_t i_current, uint16_t &i_position, uint8_t &i_pass) {
+      for(uint8_t i = 0; i < 2; i++) {
+        if(i_position == POSITION_NONE) {
+          i_position = 0;
+        }
+        else if(i_position + 1 < size()) {
+          i_position++;
+        }
+        else {
+          i_position = 0;
+
+          if(b_shuffle) {
+            i_pass ^= 1;
+          }
+        }
+
+        if(size() < 2 || entry(i_position, i_pass) != i_current) {
+          break;
+        }
+      }
+    }
+
+    bool exists(uint16_t i_track) const {
+      return i_track >= i_first_track && i_track < i_first_track + i_track_count;
+    }
+
+    uint16_t entry(uint16_t i_position, uint8_t i_pass) const {
+      if(b_shuffle) {
+        i_position = permute(i_position, seeds[i_pass]);
+      }
+
+      return i_length > 0 ? i_tracks[i_position] : i_first_track + i_position;
+    }
+
+    uint16_t permute(uint16_t i_position, const PassSeed &seed) const {
+      do {
+        // Two rounds, as one alone leaves neighbouring positions close together.
+        for(uint8_t i = 0; i < 2; i++) {
+          i_position = ((i_position ^ (i_position >> i_shift)) * seed.i_mult + seed.i_add) & i_mask;
+        }
+      } while(i_position >= size());
+
+      return i_position;
+    }
+
+    // Finds the entry of the current track if the stored position no longer matches it.
+    void locate(uint16_t i_current) {
+      if(i_position_now < size() && entry(i_position_now, i_pass_now) == i_current) {
+        return;
+      }
+
+      if(i_position_now == POSITION_NONE && b_shuffle) {
+        // A new shuffle always starts from its first entry.
+        return;
+      }
+
+      if(i_length == 0) {
+        if(!b_shuffle) {
+          i_position_now = exists(i_current) ? i_current - i_first_track : POSITION_NONE;
+        }
+
+        return;
+      }
+
+      i_position_now = POSITION_NONE;
+
+      for(uint16_t i = 0; i < i_length; i++) {
+        if(entry(i, i_pass_now) == i_current) {
+          i_position_now = i;
+          break;
+        }
+      }
+    }
+
+    // The list changed size or order, so start again from the top with a new shuffle.
+    void resize() {
+      uint8_t i_bits = 0;
+
+      i_mask = 0;
+
+      while(i_mask + 1 < size()) {
+        i_mask = (i_mask << 1) | 1;
+        i_bits++;
+      }
+
+      i_shift = i_bits > 1 ? (i_bits + 1) / 2 : 1;
+      i_position_now = POSITION_NONE;
+      i_pass_now = 0;
+
+      if(b_shuffle && size() > 0) {
+        reseed(0);
+        reseed(1);
+      }
+    }
+
+    // Draws a new order for a pass, such that it does not begin with the track that ends the other pass.
+    void reseed(uint8_t i_pass) {
+      for(uint8_t i = 0; i < 8; i++) {
+        seeds[i_pass].i_mult = (uint16_t) random(0x10000) | 1;
+        seeds[i_pass].i_add = (uint16_t) random(0x10000);
+
+        if(size() < 2 || entry(0, i_pass) != entry(size() - 1, i_pass ^ 1)) {
+          break;
+        }
+      }
+    }
+};
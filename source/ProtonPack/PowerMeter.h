@@ -40,10 +40,66 @@ bool b_power_meter_available = false; // Whether a power meter device exists on
 bool b_pack_started_by_meter = false; // Whether the pack was started via detection through the power meter.
 const uint16_t f_wand_power_up_delay = 1000; // How long to wait and ignore any wand firing events after initial power-up (ms).
 const float f_wand_power_on_threshold = 0.65; // Minimum power (W) to consider as to whether a stock Neutrona Wand is powered on.
-const float f_ema_alpha = 0.2; // Smoothing factor (<1) for Exponential Moving Average (EMA) [Lower Value = Smoother Averaging].
 
 // Special Timers and Timeouts
 millisDelay ms_powerup_debounce; // Timer to lock out firing when the wand powers on.
+millisDelay ms_power_meter_resync; // Timer to periodically re-send the configuration to the power meter.
+const uint16_t i_power_meter_resync_delay = 1000; // How often to re-send the configuration, in case the INA219 is reset by transient current (ms).
+
+// Pack Voltage Sampling (filled by the ADC conversion complete interrupt)
+const uint8_t i_bandgap_samples = 16; // Readings averaged for the pack voltage; 16 (4^2) adds 2 bits of resolution.
+volatile uint16_t i_bandgap_ring[i_bandgap_samples] = {}; // Latest bandgap readings (10-bit).
+volatile uint16_t i_bandgap_sum = 0; // Running sum of the ring (at most 16 x 1023, so this cannot overflow).
+volatile uint8_t i_bandgap_index = 0; // Next ring position to be written.
+volatile uint8_t i_bandgap_settle = 4; // Readings to discard after selecting the bandgap channel.
+volatile bool b_bandgap_ring_full = false; // Whether every ring position holds a reading.
+
+// Rolling window over the latest power readings, giving the mean, variance and slope across the window.
+struct PowerWindow {
+  const static uint8_t Size = 4; // Readings kept; with 64-sample averaging the INA219 has a new reading every ~68ms.
+  float Readings[Size] = {}; // W - Latest readings, oldest first from position Next once the window is full
+  uint8_t Count = 0; // Number of readings held (up to Size)
+  uint8_t Next = 0;  // Position for the next reading
+  float Mean = 0;     // W - Average of the readings
+  float Variance = 0; // W^2 - Spread of the readings around the mean
+  float Slope = 0;    // W - Least-squares change per reading (positive when rising)
+
+  void add(float f_reading) {
+    Readings[Next] = f_reading;
+    Next = (Next + 1) % Size;
+
+    if(Count < Size) {
+      Count++;
+    }
+
+    // Walk the readings from oldest to newest, so x runs 0..Count-1 for the slope.
+    uint8_t i_oldest = (Next + Size - Count) % Size;
+    float f_sum = 0, f_sum_sq = 0, f_sum_xy = 0;
+
+    for(uint8_t x = 0; x < Count; x++) {
+      float f_y = Readings[(i_oldest + x) % Size];
+      f_sum += f_y;
+      f_sum_sq += f_y * f_y;
+      f_sum_xy += x * f_y;
+    }
+
+    Mean = f_sum / Count;
+    Variance = (f_sum_sq / Count) - (Mean * Mean);
+
+    if(Variance < 0) {
+      Variance = 0; // Rounding can take a flat window just below zero.
+    }
+
+    if(Count > 1) {
+      // Sum of (x - x_mean)^2 for x = 0..n-1 is n(n^2 - 1)/12.
+      float f_x_mean = (Count - 1) / 2.0;
+      Slope = (f_sum_xy - (f_x_mean * f_sum)) / ((Count * ((float) Count * Count - 1)) / 12.0);
+    }
+    else {
+      Slope = 0;
+    }
+  }
+};
 
 // Define an object which can store
 struct PowerMeter {
@@ -56,7 +112,8 @@ struct PowerMeter {
   float BusPower = 0;     // W - Calculation of power based on the bus mV*A values
   float AmpHours = 0;     // Ah - An estimation of power consumed over regular intervals
   float RawPower = 0;     // W - Calculation of power based on raw V*A values (non-smoothed)
-  float AvgPower = 0;     // A - Running average from the RawPower value (smoothed)
+  float AvgPower = 0;     // W - Average of the RawPower values across the window (smoothed)
+  PowerWindow Window;     // Rolling statistics of the RawPower values
   float LastAverage = 0;  // A - Last average used when determining a state change
   uint16_t PowerReadDelay = StateChangeDuration / 4; // How often (ms) to read levels for changes
   unsigned long StateChanged = 0; // Time when a potential state change was detected
@@ -79,6 +136,63 @@ void wandFiring();
 void wandStoppedFiring();
 void cyclotronSpeedRevert();
 
+// Sourced from https://community.particle.io/t/battery-voltage-checking/5467
+// Obtains the ATMega chip's actual Vcc voltage value, using internal bandgap reference.
+// This demonstrates ability to read MCU's Vcc voltage and the ability to maintain A/D calibration with changing Vcc.
+// Rather than waiting on a conversion from the main loop, the ADC is auto-triggered by each Timer0 overflow (~1kHz)
+// and its conversion complete interrupt keeps a ring of the latest bandgap readings.
+void packVoltageSamplerInit() {
+  // REFS1 REFS0               --> 0 1, AVcc internal ref. -Selects AVcc reference
+  // MUX4 MUX3 MUX2 MUX1 MUX0  --> 11110 1.1V (VBG)        -Selects channel 30, bandgap voltage, to measure
+  ADMUX = (0<<REFS1) | (1<<REFS0) | (0<<ADLAR)| (0<<MUX5) | (1<<MUX4) | (1<<MUX3) | (1<<MUX2) | (1<<MUX1) | (0<<MUX0);
+
+  // ADTS2 ADTS1 ADTS0 --> 1 0 0, Timer/Counter0 Overflow as the auto trigger source (this also clears MUX5).
+  ADCSRB = (1<<ADTS2) | (0<<ADTS1) | (0<<ADTS0);
+
+  // Keep the prescaler set up by the Arduino core, then enable auto-triggering and the conversion complete interrupt.
+  ADCSRA |= _BV(ADEN) | _BV(ADATE) | _BV(ADIE);
+}
+
+// Conversion complete: replace the oldest reading in the ring and keep the running sum up to date.
+ISR(ADC_vect) {
+  uint16_t i_reading = ADC;
+
+  if(i_bandgap_settle > 0) {
+    // The bandgap reference needs time to settle once selected, so the first few readings are thrown away.
+    i_bandgap_settle--;
+    return;
+  }
+
+  i_bandgap_sum = i_bandgap_sum - i_bandgap_ring[i_bandgap_index] + i_reading;
+  i_bandgap_ring[i_bandgap_index] = i_reading;
+  i_bandgap_index = (i_bandgap_index + 1) % i_bandgap_samples;
+
+  if(i_bandgap_index == 0) {
+    b_bandgap_ring_full = true;
+  }
+}
+
+void doPackVoltageReading() {
+  if(!b_bandgap_ring_full) {
+    return; // Keep the previous value until the ring holds a full set of readings.
+  }
+
+  noInterrupts();
+  uint16_t i_sum = i_bandgap_sum;
+  interrupts();
+
+  // Oversampling 16 readings and decimating by 4 (>> 2) gives a 12-bit result, with full scale at 1023 x 4.
+  uint16_t i_bandgap = i_sum >> 2;
+
+  if(i_bandgap == 0) {
+    return;
+  }
+
+  // Scale the value, which returns the actual value of Vcc x 100
+  const long InternalReferenceVoltage = 1115L; // Adjust this value to your boards specific internal BG voltage x1000.
+  packReading.BusVoltage = (((InternalReferenceVoltage * 1023L * 4L) / i_bandgap) + 5L) / 10L; // Calculates for straight line value.
+}
+
 // Configure and calibrate the power meter device.
 void powerMeterConfig() {
   debugln(F("Configure Power Meter"));
@@ -107,6 +221,7 @@ void powerMeterInit() {
     powerMeterConfig();
     wandReading.LastRead = millis(); // For use with the Ah readings.
     wandReading.ReadTimer.start(wandReading.PowerReadDelay);
+    ms_power_meter_resync.start(i_power_meter_resync_delay);
   }
   else {
     // If returning a non-zero value, device could not be reset.
@@ -114,60 +229,59 @@ void powerMeterInit() {
   }
 
   // Always obtain a voltage reading directly from the pack PCB.
+  packVoltageSamplerInit();
   packReading.ReadTimer.start(packReading.PowerReadDelay);
 }
 
 // Perform a reading of values from the power meter for the wand.
-void doWandPowerReading() {
-  if(b_power_meter_available) {
-    // Only uncomment this debug if absolutely needed!
-    //debugln(F("Reading Power Meter"));
-
-    // Reads the latest values from the monitor.
-    wandReading.ShuntVoltage = monitor.shuntVoltage();
-    wandReading.ShuntCurrent = monitor.shuntCurrent();
-    wandReading.BusVoltage = monitor.busVoltage();
-    wandReading.BusPower = monitor.busPower();
-
-    // Update the smoothed current (A) values using the latest reading using an exponential moving average.
-    wandReading.BattVoltage = wandReading.BusVoltage + wandReading.ShuntVoltage; // Total Volts
-    wandReading.RawPower = wandReading.BattVoltage * wandReading.ShuntCurrent; // P(W) = V*A
-    wandReading.AvgPower = (f_ema_alpha * wandReading.RawPower) + ((1 - f_ema_alpha) * wandReading.AvgPower);
-
-    // Use time and current (A) values to calculate amp-hours consumed.
-    unsigned long i_new_time = millis();
-    wandReading.ReadTick = i_new_time - wandReading.LastRead;
-    wandReading.AmpHours += (wandReading.ShuntCurrent * wandReading.ReadTick) / 3600000.0; // Div. by 1000 x 60 x 60
-    wandReading.LastRead = i_new_time;
-
-    // Prepare for next read -- this is security just in case the INA219 is reset by transient current.
-    monitor.recalibrate();
-    monitor.reconfig();
+// The INA219 is left converting continuously, so it is only read once the conversion ready flag shows a new result.
+// Returns whether a new reading was taken.
+bool doWandPowerReading() {
+  if(!b_power_meter_available) {
+    return false;
   }
-}
 
-// Sourced from https://community.particle.io/t/battery-voltage-checking/5467
-// Obtains the ATMega chip's actual Vcc voltage value, using internal bandgap reference.
-// This demonstrates ability to read MCU's Vcc voltage and the ability to maintain A/D calibration with changing Vcc.
-void doPackVoltageReading() {
-  // REFS1 REFS0               --> 0 1, AVcc internal ref. -Selects AVcc reference
-  // MUX4 MUX3 MUX2 MUX1 MUX0  --> 11110 1.1V (VBG)        -Selects channel 30, bandgap voltage, to measure
-  ADMUX = (0<<REFS1) | (1<<REFS0) | (0<<ADLAR)| (0<<MUX5) | (1<<MUX4) | (1<<MUX3) | (1<<MUX2) | (1<<MUX1) | (0<<MUX0);
+  // The conversion ready flag is a bit of the bus voltage register; ready() only reports it as of this read.
+  int16_t i_bus_voltage_raw = monitor.busVoltageRaw();
 
-  // This appears to work without the delay, but for more accurate readings it may be necessary.
-  // delay(50); // Let mux settle a little to get a more stable A/D conversion.
+  if(!monitor.ready()) {
+    return false;
+  }
 
-  ADCSRA |= _BV( ADSC ); // Start a conversion.
-  while( ( (ADCSRA & (1<<ADSC)) != 0 ) ); // Wait for conversion to complete...
+  // Only uncomment this debug if absolutely needed!
+  //debugln(F("Reading Power Meter"));
+
+  // Reads the rest of the latest values from the monitor. Reading the power register last clears the conversion ready flag.
+  wandReading.BusVoltage = (i_bus_voltage_raw >> 3) * 0.004; // 4mV per bit, above the 3 status bits.
+  wandReading.ShuntCurrent = monitor.shuntCurrent();
+  wandReading.BusPower = monitor.busPower();
+  wandReading.ShuntVoltage = wandReading.ShuntCurrent * SHUNT_R; // V=IR, which saves reading the shunt register.
+
+  // Update the window of power values, from which the smoothed average is taken.
+  wandReading.BattVoltage = wandReading.BusVoltage + wandReading.ShuntVoltage; // Total Volts
+  wandReading.RawPower = wandReading.BattVoltage * wandReading.ShuntCurrent; // P(W) = V*A
+  wandReading.Window.add(wandReading.RawPower);
+  wandReading.AvgPower = wandReading.Window.Mean;
+
+  // Use time and current (A) values to calculate amp-hours consumed.
+  unsigned long i_new_time = millis();
+  wandReading.ReadTick = i_new_time - wandReading.LastRead;
+  wandReading.AmpHours += (wandReading.ShuntCurrent * wandReading.ReadTick) / 3600000.0; // Div. by 1000 x 60 x 60
+  wandReading.LastRead = i_new_time;
+
+  // Re-send the configuration now and then, just in case the INA219 is reset by transient current.
+  if(ms_power_meter_resync.justFinished()) {
+    monitor.recalibrate();
+    monitor.reconfig();
+    ms_power_meter_resync.start(i_power_meter_resync_delay);
+  }
 
-  // Scale the value, which returns the actual value of Vcc x 100
-  const long InternalReferenceVoltage = 1115L; // Adjust this value to your boards specific internal BG voltage x1000.
-  packReading.BusVoltage = (((InternalReferenceVoltage * 1023L) / ADC) + 5L) / 10L; // Calculates for straight line value.
+  return true;
 }
 
 // Perform a reading of values from the power meter for the pack.
 void doPackPowerReading() {
-  // Obtain bandgap voltage from the microcontroller.
+  // Obtain the filtered bandgap voltage from the microcontroller.
   doPackVoltageReading();
 }
 
@@ -224,11 +338,7 @@ void updateWandPowerState() {
             packStartup(false);
             b_pack_started_by_meter = true;
 
-            // Fake a full-power proton stream setting to the Attenuator
-            serial1Send(A_POWER_LEVEL_5);
-            serial1Send(A_PROTON_MODE);
-
-            // Tell the Attenuator the pack is powered on
+            // Tell the Attenuator the pack is powered on (it will be shown a full-power proton stream).
             serial1Send(A_PACK_ON);
 
             // Just powered up, so set a delay for firing.
@@ -309,20 +419,11 @@ void updateWandPowerState() {
       b_pack_started_by_meter = false;
       PACK_ACTION_STATE = ACTION_OFF;
       serial1Send(A_PACK_OFF);
-      serial1Send(A_POWER_LEVEL_1);
       serial1Send(A_WAND_POWER_AMPS, 0);
     }
   }
 }
 
-// Send latest voltage value to the serial1 device, if connected.
-void updatePackPowerState() {
-  if(b_serial1_connected) {
-    // Data is sent as uint16_t so this is already multiplied by 100 to get 2 decimal precision.
-    serial1Send(A_BATTERY_VOLTAGE_PACK, packReading.BusVoltage);
-  }
-}
-
 // Displays the latest gathered power meter values (for debugging only!).
 // Turn on the Serial Plotter in the ArduinoIDE to view graphed results.
 void wandPowerDisplay() {
@@ -359,6 +460,14 @@ void wandPowerDisplay() {
     Serial.print(wandReading.AvgPower);
     Serial.print(F(","));
 
+    // Serial.print(F("W.Var(W2):"));
+    // Serial.print(wandReading.Window.Variance);
+    // Serial.print(F(","));
+
+    Serial.print(F("W.Slope(W):"));
+    Serial.print(wandReading.Window.Slope);
+    Serial.print(F(","));
+
     Serial.print(F("W.State:"));
     Serial.println(wandReading.LastAverage);
   }
@@ -368,16 +477,17 @@ void wandPowerDisplay() {
 void checkPowerMeter() {
   if(wandReading.ReadTimer.justFinished()) {
     if(b_power_meter_available) {
-      doWandPowerReading(); // Get latest V/A readings.
-      wandPowerDisplay(); // Show values on serial plotter.
+      if(doWandPowerReading()) {
+        wandPowerDisplay(); // Show new values on serial plotter.
+      }
+
       updateWandPowerState(); // Take action on V/A values.
       wandReading.ReadTimer.start(wandReading.PowerReadDelay);
     }
   }
 
   if(packReading.ReadTimer.justFinished()) {
-      doPackPowerReading(); // Get latest voltage reading.
-      updatePackPowerState(); // Take action on V/A values.
+      doPackPowerReading(); // Get latest voltage reading, sent to the serial1 device with the next sync delta.
       packReading.ReadTimer.start(packReading.PowerReadDelay);
   }
 }
\ No newline at end of file
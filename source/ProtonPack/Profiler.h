@@ -0,0 +1,254 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Main Loop Profiler
+ * Compiled in only when PROFILER is set to 1 in ProtonPack.ino; otherwise the profile macros expand to nothing.
+ * Records the time spent (in microseconds) in each stage of loop() as min/avg/max plus a coarse histogram,
+ * so that worst-case loop latency can be found for states such as firing, overheating or the ribbon cable alarm.
+ * Send 'p' over the Serial console (9600 baud) to print the results, or 'r' to reset them.
+ * A summary of the average and worst-case times is also forwarded to the Serial1 device while connected.
+ */
+#if PROFILER == 1
+
+// Stages of loop() which are timed. The order must match the Attenuator, which receives the summary.
+enum PROFILE_STAGES : uint8_t {
+  PROFILE_AUDIO,
+  PROFILE_POWER_METER,
+  PROFILE_WAND_SERIAL,
+  PROFILE_SERIAL1,
+  PROFILE_INPUTS,
+  PROFILE_PACK_STATE,
+  PROFILE_CYCLOTRON,
+  PROFILE_POWERCELL,
+  PROFILE_LED_SHOW,
+  PROFILE_LOOP_TOTAL,
+  PROFILE_STAGE_COUNT
+};
+
+// Names used when printing the results, in the same order as above.
+const char profile_stage_0[] PROGMEM = "Audio";
+const char profile_stage_1[] PROGMEM = "PowerMeter";
+const char profile_stage_2[] PROGMEM = "WandSerial";
+const char profile_stage_3[] PROGMEM = "Serial1";
+const char profile_stage_4[] PROGMEM = "Inputs";
+const char profile_stage_5[] PROGMEM = "PackState";
+const char profile_stage_6[] PROGMEM = "Cyclotron";
+const char profile_stage_7[] PROGMEM = "Powercell";
+const char profile_stage_8[] PROGMEM = "LEDShow";
+const char profile_stage_9[] PROGMEM = "LoopTotal";
+const char* const profile_stage_names[PROFILE_STAGE_COUNT] PROGMEM = {
+  profile_stage_0, profile_stage_1, profile_stage_2, profile_stage_3, profile_stage_4,
+  profile_stage_5, profile_stage_6, profile_stage_7, profile_stage_8, profile_stage_9
+};
+
+// Histogram bins double in width: <64us, <128us, <256us ... <4096us, and everything above.
+const uint8_t i_profile_histogram_bins = 8;
+const uint8_t i_profile_histogram_shift = 6; // First bin ends at 2^6 = 64us.
+const uint16_t i_profile_report_delay = 5000; // How often (ms) to send the summary to the Serial1 device.
+
+struct ProfileStage {
+  uint32_t Total = 0;      // us - Sum of all samples, used for the average
+  uint16_t Samples = 0;    // Number of samples taken (halved along with Total when full)
+  uint16_t Min = 0xFFFF;   // us - Shortest sample
+  uint16_t Max = 0;        // us - Longest sample
+  uint16_t Histogram[i_profile_histogram_bins] = {};
+};
+
+ProfileStage profile_stages[PROFILE_STAGE_COUNT];
+uint16_t i_profile_elapsed[PROFILE_STAGE_COUNT] = {}; // Time accumulated by each stage during the current loop.
+uint16_t i_profile_touched = 0; // Bitmask of the stages which ran during the current loop.
+uint32_t i_profile_loop_start = 0;
+uint32_t i_profile_mark = 0;
+millisDelay ms_profile_report;
+
+void profileReset() {
+  for(uint8_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    profile_stages[i] = ProfileStage();
+  }
+
+  i_fast_led_frames_deferred = 0;
+  i_fast_led_frames_forced = 0;
+  i_fast_led_frames_skipped = 0;
+}
+
+void profileRecord(uint8_t i_stage, uint32_t i_elapsed) {
+  ProfileStage &stage = profile_stages[i_stage];
+  uint16_t i_sample = i_elapsed > 0xFFFF ? 0xFFFF : i_elapsed;
+
+  if(stage.Samples == 0xFFFF) {
+    // Halve the history instead of overflowing; the average stays valid and recent loops weigh more.
+    stage.Samples /= 2;
+    stage.Total /= 2;
+
+    for(uint8_t i = 0; i < i_profile_histogram_bins; i++) {
+      stage.Histogram[i] /= 2;
+    }
+  }
+
+  stage.Samples++;
+  stage.Total += i_sample;
+
+  if(i_sample < stage.Min) {
+    stage.Min = i_sample;
+  }
+
+  if(i_sample > stage.Max) {
+    stage.Max = i_sample;
+  }
+
+  uint8_t i_bin = 0;
+  i_sample >>= i_profile_histogram_shift;
+
+  while(i_sample > 0 && i_bin < i_profile_histogram_bins - 1) {
+    i_sample >>= 1;
+    i_bin++;
+  }
+
+  stage.Histogram[i_bin]++;
+}
+
+uint16_t profileAverage(uint8_t i_stage) {
+  if(profile_stages[i_stage].Samples == 0) {
+    return 0;
+  }
+
+  return profile_stages[i_stage].Total / profile_stages[i_stage].Samples;
+}
+
+void loopProfileStart() {
+  i_profile_loop_start = micros();
+  i_profile_mark = i_profile_loop_start;
+}
+
+// Charges the time since the previous mark to the given stage.
+void loopProfileMark(uint8_t i_stage) {
+  uint32_t i_now = micros();
+  uint32_t i_elapsed = i_profile_elapsed[i_stage] + (i_now - i_profile_mark);
+
+  i_profile_elapsed[i_stage] = i_elapsed > 0xFFFF ? 0xFFFF : i_elapsed;
+  i_profile_touched |= (1 << i_stage);
+  i_profile_mark = i_now;
+}
+
+// Prints a value right-aligned to the given width, to keep the table readable.
+void profilePrintColumn(uint16_t i_value, uint8_t i_width) {
+  uint8_t i_digits = 1;
+
+  for(uint16_t i = i_value; i >= 10; i /= 10) {
+    i_digits++;
+  }
+
+  while(i_width-- > i_digits) {
+    Serial.print(' ');
+  }
+
+  Serial.print(i_value);
+}
+
+void profilePrint() {
+  char s_name[12];
+
+  Serial.println(F("Stage         Min   Avg   Max Samples   <64  <128  <256  <512   <1k   <2k   <4k  >=4k (us)"));
+
+  for(uint8_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    ProfileStage &stage = profile_stages[i];
+
+    strcpy_P(s_name, (char*)pgm_read_ptr(&(profile_stage_names[i])));
+    Serial.print(s_name);
+
+    for(uint8_t j = strlen(s_name); j < 11; j++) {
+      Serial.print(' ');
+    }
+
+    profilePrintColumn(stage.Samples > 0 ? stage.Min : 0, 6);
+    profilePrintColumn(profileAverage(i), 6);
+    profilePrintColumn(stage.Max, 6);
+    profilePrintColumn(stage.Samples, 8);
+
+    for(uint8_t j = 0; j < i_profile_histogram_bins; j++) {
+      profilePrintColumn(stage.Histogram[j], 6);
+    }
+
+    Serial.println();
+  }
+
+  Serial.print(F("LED frames deferred for serial RX: "));
+  Serial.print(i_fast_led_frames_deferred);
+  Serial.print(F(", forced: "));
+  Serial.println(i_fast_led_frames_forced);
+
+  Serial.print(F("LED frames skipped as unchanged: "));
+  Serial.println(i_fast_led_frames_skipped);
+}
+
+// Commits the samples for this loop, then handles any console request and the periodic summary.
+void loopProfileEnd() {
+  profileRecord(PROFILE_LOOP_TOTAL, micros() - i_profile_loop_start);
+
+  for(uint8_t i = 0; i < PROFILE_LOOP_TOTAL; i++) {
+    if(i_profile_touched & (1 << i)) {
+      profileRecord(i, i_profile_elapsed[i]);
+      i_profile_elapsed[i] = 0;
+    }
+  }
+
+  i_profile_touched = 0;
+
+  if(Serial.available() > 0) {
+    switch(Serial.read()) {
+      case 'p':
+      case 'P':
+        profilePrint();
+      break;
+
+      case 'r':
+      case 'R':
+        profileReset();
+        Serial.println(F("Profile reset"));
+      break;
+
+      default:
+        // Ignore anything else, including line endings.
+      break;
+    }
+  }
+
+  if(!ms_profile_report.isRunning()) {
+    ms_profile_report.start(i_profile_report_delay);
+  }
+  else if(ms_profile_report.justFinished()) {
+    if(b_serial1_connected) {
+      serial1SendData(A_LOOP_PROFILE);
+    }
+
+    ms_profile_report.start(i_profile_report_delay);
+  }
+}
+
+#define profileStart() loopProfileStart()
+#define profileMark(x) loopProfileMark(x)
+#define profileEnd() loopProfileEnd()
+#else
+#define profileStart()
+#define profileMark(x)
+#define profileEnd()
+#endif
@@ -29,6 +29,9 @@
 #define debugln(x)
 #endif
 
+// Set to 1 to enable the main loop profiler (see Profiler.h)
+#define PROFILER 0
+
 // PROGMEM macro
 #define PROGMEM_READU32(x) pgm_read_dword_near(&(x))
 #define PROGMEM_READU16(x) pgm_read_word_near(&(x))
@@ -51,9 +54,12 @@
 #include "Communication.h"
 #include "Header.h"
 #include "Colours.h"
+#include "AudioQueue.h"
+#include "MusicPlaylist.h"
 #include "Audio.h"
 #include "PowerMeter.h"
 #include "Preferences.h"
+#include "Profiler.h"
 
 void setup() {
   // Setup i2c.
@@ -73,7 +79,7 @@ void setup() {
   serial1Coms.begin(Serial1, false); // Attenuator/Wireless
   packComs.begin(Serial2, false); // Neutrona Wand
 
-  // Setup the audio device for this controller.
+  // Start looking for the audio device for this controller; this carries on from the main loop.
   setupAudioDevice();
 
   // Rotary encoder for volume control.
@@ -113,10 +119,10 @@ void setup() {
   pinModeFast(NFILTER_LED_PIN, OUTPUT);
 
   // Power Cell, Cyclotron Lid, and N-Filter.
-  FastLED.addLeds<NEOPIXEL, PACK_LED_PIN>(pack_leds, FRUTTO_POWERCELL_LED_COUNT + OUTER_CYCLOTRON_LED_MAX + JEWEL_NFILTER_LED_COUNT);
+  pack_led_controller = &FastLED.addLeds<NEOPIXEL, PACK_LED_PIN>(pack_leds, FRUTTO_POWERCELL_LED_COUNT + OUTER_CYCLOTRON_LED_MAX + JEWEL_NFILTER_LED_COUNT);
 
   // Inner Cyclotron LEDs (Inner Panel + Cyclotron + Cavity).
-  FastLED.addLeds<NEOPIXEL, CYCLOTRON_LED_PIN>(cyclotron_leds, INNER_CYCLOTRON_LED_PANEL_MAX + INNER_CYCLOTRON_CAKE_LED_MAX + INNER_CYCLOTRON_CAVITY_LED_MAX);
+  cyclotron_led_controller = &FastLED.addLeds<NEOPIXEL, CYCLOTRON_LED_PIN>(cyclotron_leds, INNER_CYCLOTRON_LED_PANEL_MAX + INNER_CYCLOTRON_CAKE_LED_MAX + INNER_CYCLOTRON_CAVITY_LED_MAX);
 
   // Other FastLED Options
   FastLED.setDither(0); // Disables the "temporal dithering" feature as this software will set brightness on a per-pixel level by device.
@@ -228,13 +234,20 @@ void setup() {
 }
 
 void loop() {
+  profileStart();
+
+  // Sample the animation ramps once for this pass.
+  animationFrameTick();
+
   // Update the available audio device.
   updateAudio();
+  profileMark(PROFILE_AUDIO);
 
   // Check current voltage/amperage draw using available methods if enabled.
   if(b_use_power_meter && b_pack_post_finish) {
     // Only check if power meter if present and self-test has completed.
     checkPowerMeter();
+    profileMark(PROFILE_POWER_METER);
   }
 
   // Check for any new serial commands were received from the Neutrona Wand.
@@ -242,18 +255,21 @@ void loop() {
 
   // Check if the wand is considered to have been disconnected.
   wandDisconnectCheck();
+  profileMark(PROFILE_WAND_SERIAL);
 
   // Check if serial1 device is present.
   serial1HandShake();
 
   // Check if any new serial commands were received.
   checkSerial1();
+  profileMark(PROFILE_SERIAL1);
 
   if(b_pack_post_finish) {
     checkMusic();
     checkSwitches();
     checkRotaryEncoder();
     checkMenuVibration();
+    profileMark(PROFILE_INPUTS);
 
     switch (PACK_STATE) {
       case MODE_OFF:
@@ -291,9 +307,12 @@ void loop() {
             spectralLightsOn();
           }
           else {
+            profileMark(PROFILE_PACK_STATE);
             cyclotronControl();
             cyclotronSwitchLEDLoop();
+            profileMark(PROFILE_CYCLOTRON);
             powercellLoop();
+            profileMark(PROFILE_POWERCELL);
           }
         }
         else {
@@ -506,6 +525,7 @@ void loop() {
           packVenting();
         }
 
+        profileMark(PROFILE_PACK_STATE);
         cyclotronControl(); // Set timers for the cyclotron.
 
         if(b_wand_mash_lockout && ms_mash_lockout.isRunning()) {
@@ -516,6 +536,7 @@ void loop() {
         }
 
         cyclotronSwitchLEDLoop(); // Update the cyclotron.
+        profileMark(PROFILE_CYCLOTRON);
 
         if(b_overheating == true && b_overheat_lights_off == true) {
           powercellRampDown();
@@ -523,6 +544,7 @@ void loop() {
         else {
           powercellLoop();
         }
+        profileMark(PROFILE_POWERCELL);
       break;
     }
 
@@ -544,17 +566,99 @@ void loop() {
   else {
     systemPOST();
   }
+  profileMark(PROFILE_PACK_STATE);
+
+  // Send the commands queued for the wand during this loop.
+  packSerialFlush();
+  profileMark(PROFILE_WAND_SERIAL);
+
+  // Send the commands queued for the serial1 device, then any state changes from this loop as a single update.
+  serial1Flush();
+
+  if(b_serial1_connected && !b_serial1_syncing) {
+    serial1SendSyncDelta();
+    serial1SendLinkStats();
+  }
+  profileMark(PROFILE_SERIAL1);
+
+  // Follow the sound effects playing now with the music level, then send the commands queued during this loop.
+  updateMusicDucking();
+  flushAudio();
+  profileMark(PROFILE_AUDIO);
 
   // Update the LEDs
-  if(ms_fast_led.justFinished()) {
-    FastLED.show();
+  if(ms_fast_led.justFinished() || b_fast_led_held) {
+    if(fastLedShow()) {
+      profileMark(PROFILE_LED_SHOW);
 
-    ms_fast_led.start(i_fast_led_delay);
+      // Each chain is updated every other frame, so frames run at twice the rate.
+      ms_fast_led.start((i_fast_led_delay + 1) / 2);
+    }
+  }
+
+  profileEnd();
+}
+
+// Sends one LED chain per frame, unless a serial packet is part-way received. Returns true once sent.
+bool fastLedShow() {
+  if(serialReceiveInProgress()) {
+    if(!b_fast_led_held) {
+      b_fast_led_held = true;
+      i_fast_led_held_since = millis();
+      i_fast_led_frames_deferred++;
+    }
+
+    if(millis() - i_fast_led_held_since < i_fast_led_hold_max) {
+      return false;
+    }
+
+    i_fast_led_frames_forced++;
+  }
+
+  b_fast_led_held = false;
+
+  if(b_fast_led_cyclotron_next) {
+    fastLedShowChain(cyclotron_led_controller, i_fast_led_cyclotron_checksum, i_fast_led_cyclotron_sent);
+  }
+  else {
+    fastLedShowChain(pack_led_controller, i_fast_led_pack_checksum, i_fast_led_pack_sent);
 
     if(b_powercell_updating == true) {
       b_powercell_updating = false;
     }
   }
+
+  b_fast_led_cyclotron_next = !b_fast_led_cyclotron_next;
+
+  return true;
+}
+
+// Sends one LED chain if its pixels changed since it was last sent, or if it is due a refresh.
+void fastLedShowChain(CLEDController *controller, uint32_t &i_checksum, uint32_t &i_sent) {
+  uint32_t i_new_checksum = fastLedChecksum(controller->leds(), controller->size());
+
+  if(i_new_checksum == i_checksum && millis() - i_sent < i_fast_led_refresh_max) {
+    i_fast_led_frames_skipped++;
+    return;
+  }
+
+  controller->showLeds(FastLED.getBrightness());
+  i_checksum = i_new_checksum;
+  i_sent = millis();
+}
+
+// Fletcher-style sum of the pixel data and global brightness, so a reordered or shifted animation still registers.
+uint32_t fastLedChecksum(const CRGB *leds, uint8_t i_count) {
+  const uint8_t *p_data = (const uint8_t *)leds;
+  uint16_t i_sum = FastLED.getBrightness();
+  uint16_t i_sum_of_sums = i_sum;
+
+  for(uint16_t i = 0; i < (uint16_t)i_count * 3; i++) {
+    i_sum += p_data[i];
+    i_sum_of_sums += i_sum;
+  }
+
+  return ((uint32_t)i_sum_of_sums << 16) | i_sum;
 }
 
 void systemPOST() {
@@ -841,10 +945,13 @@ bool fadeOutCyclotron() {
     uint8_t i_cyclotron_leds_total = i_pack_num_leds - i_nfilter_jewel_leds - i_cyclotron_led_start;
 
     if(b_cyclotron_simulate_ring == true) {
-      i_cyclotron_leds_total = OUTER_CYCLOTRON_LED_MAX;
+      cyclotronFrameTableUpdate();
+      i_cyclotron_leds_total = cyclotronFrames.i_count;
     }
 
-    for(uint8_t i = 0; i < i_cyclotron_leds_total; i++) {
+    for(uint8_t i_led = 0; i_led < i_cyclotron_leds_total; i_led++) {
+      // With the ring simulation the fade values are kept per position, so only visit the populated ones.
+      uint8_t i = (b_cyclotron_simulate_ring == true) ? cyclotronPositionTable(i_led) : i_led;
       uint8_t i_curr_brightness = i_cyclotron_led_value[i] - 10;
 
       if(i_curr_brightness > i_cyclotron_led_value[i]) {
@@ -857,24 +964,10 @@ bool fadeOutCyclotron() {
 
         b_return = true;
 
-        if(b_cyclotron_simulate_ring == true) {
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1].maximizeBrightness(i_curr_brightness);
-          }
-        }
-        else {
-          pack_leds[i + i_cyclotron_led_start].maximizeBrightness(i_curr_brightness);
-        }
+        pack_leds[i_led + i_cyclotron_led_start].maximizeBrightness(i_curr_brightness);
       }
       else {
-        if(b_cyclotron_simulate_ring == true) {
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
-          }
-        }
-        else {
-          pack_leds[i + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
-        }
+        pack_leds[i_led + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
       }
     }
   }
@@ -1268,9 +1361,8 @@ void setYearModeByToggle() {
         SYSTEM_YEAR = SYSTEM_1989;
         SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
 
-        // Tell the wand/serial1 to switch to 1989 mode.
+        // Tell the wand to switch to 1989 mode.
         packSerialSend(P_YEAR_1989);
-        serial1Send(A_YEAR_1989);
 
         // Play audio cue confirming the change. Only play the audio queue when the user physically flicks the switch.
         if(switch_mode.isPressed() || switch_mode.isReleased()) {
@@ -1281,9 +1373,8 @@ void setYearModeByToggle() {
         SYSTEM_YEAR = SYSTEM_1984;
         SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
 
-        // Tell the wand/serial1 to switch to 1984 mode.
+        // Tell the wand to switch to 1984 mode.
         packSerialSend(P_YEAR_1984);
-        serial1Send(A_YEAR_1984);
 
         // Play audio cue confirming the change. Only play the audio queue when the user physically flicks the switch.
         if(switch_mode.isPressed() || switch_mode.isReleased()) {
@@ -1299,9 +1390,8 @@ void setYearModeByToggle() {
         SYSTEM_YEAR = SYSTEM_AFTERLIFE;
         SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
 
-        // Tell the wand/serial1 to switch to Afterlife mode.
+        // Tell the wand to switch to Afterlife mode.
         packSerialSend(P_YEAR_AFTERLIFE);
-        serial1Send(A_YEAR_AFTERLIFE);
 
         // Play audio cue confirming the change. Only play the audio queue when the user physically flicks the switch.
         if(switch_mode.isPressed() || switch_mode.isReleased()) {
@@ -1312,9 +1402,8 @@ void setYearModeByToggle() {
         SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
         SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
 
-        // Tell the wand/serial1 to switch to Afterlife mode.
+        // Tell the wand to switch to Frozen Empire mode.
         packSerialSend(P_YEAR_FROZEN_EMPIRE);
-        serial1Send(A_YEAR_FROZEN_EMPIRE);
 
         // Play audio cue confirming the change. Only play the audio queue when the user physically flicks the switch.
         if(switch_mode.isPressed() || switch_mode.isReleased()) {
@@ -1396,9 +1485,8 @@ void checkSwitches() {
       // The Cyclotron Lid is now on.
       b_cyclotron_lid_on = true;
 
-      // Tell the connected devices.
+      // Tell the wand; the serial1 device picks this up from the next sync delta.
       packSerialSend(P_CYCLOTRON_LID_ON);
-      serial1Send(A_CYCLOTRON_LID_ON);
 
       // Turn off Inner Cyclotron LEDs.
       innerCyclotronCakeOff();
@@ -1413,9 +1501,8 @@ void checkSwitches() {
       // Make sure we clear the Outer Cyclotron LED states.
       cyclotronLidLedsOff();
 
-      // Tell the connected devices.
+      // Tell the wand; the serial1 device picks this up from the next sync delta.
       packSerialSend(P_CYCLOTRON_LID_OFF);
-      serial1Send(A_CYCLOTRON_LID_OFF);
 
       // Make sure the Inner Cyclotron turns on if we are in the EEPROM LED menu.
       if(b_spectral_lights_on) {
@@ -1561,11 +1648,6 @@ void checkSwitches() {
       if(b_wand_connected) {
         packSerialSend(P_ION_ARM_SWITCH_ON);
       }
-
-      // Tell the Attenuator or any other device that the power to the Proton Pack is on.
-      if(b_serial1_connected) {
-        serial1Send(A_ION_ARM_SWITCH_ON);
-      }
     }
     else {
       if(PACK_STATE == MODE_ON) {
@@ -1576,11 +1658,6 @@ void checkSwitches() {
       if(b_wand_connected) {
         packSerialSend(P_ION_ARM_SWITCH_OFF);
       }
-
-      // Tell the Attenuator or any other device that the power to the Proton Pack is off.
-      if(b_serial1_connected) {
-        serial1Send(A_ION_ARM_SWITCH_OFF);
-      }
     }
   }
 
@@ -1600,8 +1677,6 @@ void checkSwitches() {
               packSerialSend(P_YEAR_1984);
 
               SYSTEM_YEAR = SYSTEM_1984;
-
-              serial1Send(A_YEAR_1984);
             break;
 
             case SYSTEM_1989:
@@ -1609,8 +1684,6 @@ void checkSwitches() {
               packSerialSend(P_YEAR_1989);
 
               SYSTEM_YEAR = SYSTEM_1989;
-
-              serial1Send(A_YEAR_1989);
             break;
 
             case SYSTEM_FROZEN_EMPIRE:
@@ -1618,8 +1691,6 @@ void checkSwitches() {
               packSerialSend(P_YEAR_FROZEN_EMPIRE);
 
               SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
-
-              serial1Send(A_YEAR_FROZEN_EMPIRE);
             break;
 
             case SYSTEM_AFTERLIFE:
@@ -1629,8 +1700,6 @@ void checkSwitches() {
 
               SYSTEM_YEAR = SYSTEM_AFTERLIFE;
               SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
-
-              serial1Send(A_YEAR_AFTERLIFE);
             break;
           }
 
@@ -1961,18 +2030,18 @@ void cyclotronSwitchLEDLoop() {
       default:
         if(ms_idle_fire_fade.remaining() > 0) {
           if(b_2021_ramp_up == true) {
-            i_cyc_led_delay = i_cyclotron_switch_led_delay + (i_2021_ramp_delay - r_outer_cyclotron_ramp.update());
+            i_cyc_led_delay = i_cyclotron_switch_led_delay + (i_2021_ramp_delay - animationFrame.i_outer_ramp);
           }
           else if(b_2021_ramp_down == true) {
-            i_cyc_led_delay = i_cyclotron_switch_led_delay + r_outer_cyclotron_ramp.update();
+            i_cyc_led_delay = i_cyclotron_switch_led_delay + animationFrame.i_outer_ramp;
           }
         }
         else {
           if(b_2021_ramp_up == true) {
-            i_cyc_led_delay = i_cyclotron_switch_led_delay + ((i_2021_ramp_delay / 2) - r_outer_cyclotron_ramp.update());
+            i_cyc_led_delay = i_cyclotron_switch_led_delay + ((i_2021_ramp_delay / 2) - animationFrame.i_outer_ramp);
           }
           else if(b_2021_ramp_down == true) {
-            i_cyc_led_delay = i_cyclotron_switch_led_delay + r_outer_cyclotron_ramp.update();
+            i_cyc_led_delay = i_cyclotron_switch_led_delay + animationFrame.i_outer_ramp;
           }
         }
       break;
@@ -1980,10 +2049,10 @@ void cyclotronSwitchLEDLoop() {
       case SYSTEM_1984:
       case SYSTEM_1989:
         if(b_2021_ramp_up == true) {
-          i_cyc_led_delay = i_cyclotron_switch_led_delay + (r_outer_cyclotron_ramp.update() - i_1984_delay);
+          i_cyc_led_delay = i_cyclotron_switch_led_delay + (animationFrame.i_outer_ramp - i_1984_delay);
         }
         else if(b_2021_ramp_down == true) {
-          i_cyc_led_delay = i_cyclotron_switch_led_delay / 6 + r_outer_cyclotron_ramp.update();
+          i_cyc_led_delay = i_cyclotron_switch_led_delay / 6 + animationFrame.i_outer_ramp;
         }
       break;
     }
@@ -2008,7 +2077,7 @@ void powercellRampDown() {
     }
 
     if(b_powercell_sound_loop) {
-      audio.trackLoop(S_POWERCELL, 0); // Turn off looping which stops the track.
+      loopEffect(S_POWERCELL, false); // Turn off looping which stops the track.
       b_powercell_sound_loop = false;
     }
 
@@ -2019,7 +2088,7 @@ void powercellRampDown() {
       case SYSTEM_1984:
       case SYSTEM_1989:
         if(b_2021_ramp_up == true || b_2021_ramp_down == true) {
-          i_pc_delay = i_powercell_delay + (r_outer_cyclotron_ramp.update() - i_1984_delay);
+          i_pc_delay = i_powercell_delay + (animationFrame.i_outer_ramp - i_1984_delay);
         }
       break;
 
@@ -2027,7 +2096,7 @@ void powercellRampDown() {
       case SYSTEM_FROZEN_EMPIRE:
       default:
         if(b_2021_ramp_up == true || b_2021_ramp_down == true) {
-          i_pc_delay = i_powercell_delay + r_outer_cyclotron_ramp.update();
+          i_pc_delay = i_powercell_delay + animationFrame.i_outer_ramp;
         }
       break;
     }
@@ -2071,7 +2140,7 @@ void powercellLoop() {
     }
 
     if((b_overheating || b_2021_ramp_down || b_2021_ramp_up || b_alarm || (SYSTEM_YEAR == SYSTEM_FROZEN_EMPIRE && (!b_cyclotron_lid_on || b_wand_mash_lockout))) && b_powercell_sound_loop) {
-      audio.trackLoop(S_POWERCELL, 0); // Turn off looping which stops the track.
+      loopEffect(S_POWERCELL, false); // Turn off looping which stops the track.
       b_powercell_sound_loop = false;
     }
 
@@ -2082,7 +2151,7 @@ void powercellLoop() {
       case SYSTEM_1984:
       case SYSTEM_1989:
         if(b_2021_ramp_up == true || b_2021_ramp_down == true) {
-          i_pc_delay = i_powercell_delay + (r_outer_cyclotron_ramp.update() - i_1984_delay);
+          i_pc_delay = i_powercell_delay + (animationFrame.i_outer_ramp - i_1984_delay);
         }
       break;
 
@@ -2090,7 +2159,7 @@ void powercellLoop() {
       case SYSTEM_FROZEN_EMPIRE:
       default:
         if(b_2021_ramp_up == true || b_2021_ramp_down == true) {
-          i_pc_delay = i_powercell_delay + r_outer_cyclotron_ramp.update();
+          i_pc_delay = i_powercell_delay + animationFrame.i_outer_ramp;
         }
       break;
     }
@@ -2291,89 +2360,101 @@ void powercellDraw(uint8_t i_start) {
   }
 }
 
-// This function handles returning 1984 Cyclotron lookup table values.
-uint8_t cyclotron84LookupTable(uint8_t index) {
-  // First include a sanity check that will reject indexes above 3.
-  if(index > 3) {
-    index = 0;
+// Resolves the Cyclotron frame tables for the fitted lid and spin direction.
+// This only does any work when the lid LED count or direction has changed since the last call.
+void cyclotronFrameTableUpdate() {
+  if(cyclotronFrames.i_lid_leds == i_cyclotron_leds && cyclotronFrames.b_clockwise == b_clockwise) {
+    return;
   }
 
-  if(b_clockwise) {
-    switch(i_cyclotron_leds) {
-      case HASLAB_CYCLOTRON_LED_COUNT:
-      default:
-        // 1984 CW 12 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_12_leds_cw[index]);
-      break;
-
-      case FRUTTO_CYCLOTRON_LED_COUNT:
-        // 1984 CW 20 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_20_leds_cw[index]);
-      break;
-
-      case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
-        // 1984 CW 36 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_36_leds_cw[index]);
-      break;
-
-      case OUTER_CYCLOTRON_LED_MAX:
-        // 1984 CW 40 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_40_leds_cw[index]);
-      break;
-    }
-  }
-  else {
-    switch(i_cyclotron_leds) {
-      case HASLAB_CYCLOTRON_LED_COUNT:
-      default:
-        // 1984 CCW 12 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_12_leds_ccw[index]);
-      break;
+  cyclotronFrames.i_lid_leds = i_cyclotron_leds;
+  cyclotronFrames.b_clockwise = b_clockwise;
 
-      case FRUTTO_CYCLOTRON_LED_COUNT:
-        // 1984 CCW 20 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_20_leds_ccw[index]);
-      break;
-
-      case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
-        // 1984 CCW 36 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_36_leds_ccw[index]);
-      break;
-
-      case OUTER_CYCLOTRON_LED_MAX:
-        // 1984 CCW 40 LED array.
-        return PROGMEM_READU8(i_1984_cyclotron_40_leds_ccw[index]);
-      break;
-    }
-  }
-}
-
-// This function handles returning ring-simulated Cyclotron lookup table values.
-uint8_t cyclotronLookupTable(uint8_t index) {
   switch(i_cyclotron_leds) {
     case HASLAB_CYCLOTRON_LED_COUNT:
     default:
       // Hasbro 12 LED array.
-      return PROGMEM_READU8(i_cyclotron_12led_matrix[index]);
+      cyclotronFrames.i_count = HASLAB_CYCLOTRON_LED_COUNT;
+      cyclotronFrames.p_matrix = i_cyclotron_12led_matrix;
+      cyclotronFrames.p_positions = i_cyclotron_12led_positions;
+      cyclotronFrames.p_1984 = b_clockwise ? i_1984_cyclotron_12_leds_cw : i_1984_cyclotron_12_leds_ccw;
     break;
 
     case FRUTTO_CYCLOTRON_LED_COUNT:
       // Frutto 20 LED array.
-      return PROGMEM_READU8(i_cyclotron_20led_matrix[index]);
+      cyclotronFrames.i_count = FRUTTO_CYCLOTRON_LED_COUNT;
+      cyclotronFrames.p_matrix = i_cyclotron_20led_matrix;
+      cyclotronFrames.p_positions = i_cyclotron_20led_positions;
+      cyclotronFrames.p_1984 = b_clockwise ? i_1984_cyclotron_20_leds_cw : i_1984_cyclotron_20_leds_ccw;
     break;
 
     case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
       // Frutto Max 36 LED array.
-      return PROGMEM_READU8(i_cyclotron_36led_matrix[index]);
+      cyclotronFrames.i_count = FRUTTO_MAX_CYCLOTRON_LED_COUNT;
+      cyclotronFrames.p_matrix = i_cyclotron_36led_matrix;
+      cyclotronFrames.p_positions = i_cyclotron_36led_positions;
+      cyclotronFrames.p_1984 = b_clockwise ? i_1984_cyclotron_36_leds_cw : i_1984_cyclotron_36_leds_ccw;
     break;
 
     case OUTER_CYCLOTRON_LED_MAX:
       // NeoPixel Ring 40 LED array.
-      return PROGMEM_READU8(i_cyclotron_40led_matrix[index]);
+      cyclotronFrames.i_count = OUTER_CYCLOTRON_LED_MAX;
+      cyclotronFrames.p_matrix = i_cyclotron_40led_matrix;
+      cyclotronFrames.p_positions = i_cyclotron_40led_positions;
+      cyclotronFrames.p_1984 = b_clockwise ? i_1984_cyclotron_40_leds_cw : i_1984_cyclotron_40_leds_ccw;
     break;
   }
 }
 
+// Advances the Cyclotron speed ramps and stores their values for everything animated during this pass of loop().
+void animationFrameTick() {
+  animationFrame.i_outer_ramp = r_outer_cyclotron_ramp.update();
+  animationFrame.i_inner_ramp = r_inner_cyclotron_ramp.update();
+}
+
+// This function handles returning 1984 Cyclotron lookup table values.
+uint8_t cyclotron84LookupTable(uint8_t index) {
+  // First include a sanity check that will reject indexes above 3.
+  if(index > 3) {
+    index = 0;
+  }
+
+  cyclotronFrameTableUpdate();
+
+  return PROGMEM_READU8(cyclotronFrames.p_1984[index]);
+}
+
+// This function handles returning ring-simulated Cyclotron lookup table values.
+uint8_t cyclotronLookupTable(uint8_t index) {
+  cyclotronFrameTableUpdate();
+
+  return PROGMEM_READU8(cyclotronFrames.p_matrix[index]);
+}
+
+// Returns the position on the 40 position circle for a physical lid LED (0 to cyclotronFrames.i_count - 1).
+uint8_t cyclotronPositionTable(uint8_t i_led) {
+  return PROGMEM_READU8(cyclotronFrames.p_positions[i_led]);
+}
+
+// Returns how many whole LED steps of the given length (ms) have passed since the last one, and moves the step time on.
+uint8_t cyclotronSpinSteps(uint32_t &i_last_step, uint32_t i_step_ms) {
+  uint32_t i_now = micros();
+  uint32_t i_step_us = i_step_ms * 1000UL;
+  int32_t i_elapsed = (int32_t)(i_now - i_last_step);
+
+  if(i_step_us == 0 || i_elapsed < -(int32_t)i_step_us || i_elapsed >= (int32_t)(i_step_us * i_cyclotron_spin_max_steps)) {
+    // Just started, or stalled for longer than is worth catching up; take one step from now.
+    i_last_step = i_now;
+    return 1;
+  }
+
+  // The timer only has millisecond resolution, so it may fire a little early; that still counts as one step.
+  uint8_t i_steps = (i_elapsed < (int32_t)i_step_us ? 1 : i_elapsed / i_step_us);
+  i_last_step += i_step_us * i_steps;
+
+  return i_steps;
+}
+
 // Reset the Cyclotron LED colours.
 void cyclotronColourReset() {
   uint8_t i_colour_scheme = getDeviceColour(CYCLOTRON_OUTER, STREAM_MODE, b_cyclotron_colour_toggle);
@@ -2516,6 +2597,9 @@ void cyclotronControl() {
           }
         break;
       }
+
+      // The ramps were restarted, so refresh the snapshot for the rest of this pass.
+      animationFrameTick();
     }
     else if(b_2021_ramp_down_start == true) {
       b_2021_ramp_down_start = false;
@@ -2541,6 +2625,9 @@ void cyclotronControl() {
           r_inner_cyclotron_ramp.go(i_inner_ramp_delay, i_2021_ramp_down_length, QUARTIC_IN);
         }
       }
+
+      // The ramps were restarted, so refresh the snapshot for the rest of this pass.
+      animationFrameTick();
     }
 
     if(SYSTEM_YEAR == SYSTEM_1984 || SYSTEM_YEAR == SYSTEM_1989) {
@@ -2571,7 +2658,6 @@ void cyclotronControl() {
 
 void cyclotronFade() {
   uint8_t i_colour_scheme = getDeviceColour(CYCLOTRON_OUTER, STREAM_MODE, b_cyclotron_colour_toggle);
-  uint8_t i_cyclotron_leds_total = i_pack_num_leds - i_nfilter_jewel_leds - i_cyclotron_led_start;
 
   // We override the colour changes when using stock HasLab Cyclotron LEDs.
   // Changing the colour space with a CHSV Object affects the brightness slightly for non RGB pixels.
@@ -2583,61 +2669,61 @@ void cyclotronFade() {
     case SYSTEM_AFTERLIFE:
     case SYSTEM_FROZEN_EMPIRE:
     default:
-      i_cyclotron_leds_total = OUTER_CYCLOTRON_LED_MAX;
+      // Only the ring positions with a fade in progress are visited.
+      for(int8_t i = cyclotronFadeNext(0); i >= 0; i = cyclotronFadeNext(i + 1)) {
+        uint8_t i_matrix_led = cyclotronLookupTable(i);
+
+        if(i_matrix_led == 0) {
+          // Left over from the 1984/1989 LED layout; nothing is shown at this position of the ring.
+          cyclotronFadeSetActive(i, false);
+          continue;
+        }
 
-      for(uint8_t i = 0; i < i_cyclotron_leds_total; i++) {
-        if(r_cyclotron_led_fade_in[i].isRunning()) {
-          b_cyclotron_led_fading_in[i] = true;
+        uint8_t i_pixel = i_matrix_led + i_cyclotron_led_start - 1;
 
-          uint8_t i_curr_brightness = r_cyclotron_led_fade_in[i].update();
+        if(cyclotronFadeRunning(i, false)) {
+          cyclotronFades.i_flags[i] |= FADE_LED_FADING_IN;
+
+          uint8_t i_curr_brightness = cyclotronFadeUpdate(i);
           i_cyclotron_led_value[i] = i_curr_brightness;
 
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness);
-          }
+          pack_leds[i_pixel] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness);
         }
 
         uint8_t i_new_brightness = getBrightness(i_cyclotron_brightness);
-        if(r_cyclotron_led_fade_in[i].isFinished() && i_cyclotron_led_value[i] > (i_new_brightness - 1) && b_cyclotron_led_fading_in[i] == true) {
+        if(!cyclotronFadeRunning(i, false) && i_cyclotron_led_value[i] > (i_new_brightness - 1) && (cyclotronFades.i_flags[i] & FADE_LED_FADING_IN)) {
           i_cyclotron_led_value[i] = i_new_brightness;
-          b_cyclotron_led_fading_in[i] = false;
-
-          r_cyclotron_led_fade_out[i].go(i_new_brightness);
+          cyclotronFades.i_flags[i] &= ~FADE_LED_FADING_IN;
 
           switch(i_cyclotron_leds) {
             case OUTER_CYCLOTRON_LED_MAX:
             case FRUTTO_CYCLOTRON_LED_COUNT:
             case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
-              r_cyclotron_led_fade_out[i].go(0, i_outer_current_ramp_speed * 3, CIRCULAR_OUT);
+              cyclotronFadeStart(i, i_new_brightness, i_outer_current_ramp_speed * 3, FADE_CIRCULAR_OUT, true);
             break;
 
             case HASLAB_CYCLOTRON_LED_COUNT:
             default:
-              r_cyclotron_led_fade_out[i].go(0, i_outer_current_ramp_speed * 2, CIRCULAR_OUT);
+              cyclotronFadeStart(i, i_new_brightness, i_outer_current_ramp_speed * 2, FADE_CIRCULAR_OUT, true);
             break;
           }
 
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_new_brightness);
-          }
+          pack_leds[i_pixel] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_new_brightness);
         }
 
-        if(r_cyclotron_led_fade_out[i].isRunning()) {
-          uint8_t i_curr_brightness = r_cyclotron_led_fade_out[i].update();
+        if(cyclotronFadeRunning(i, true)) {
+          uint8_t i_curr_brightness = cyclotronFadeUpdate(i);
           i_cyclotron_led_value[i] = i_curr_brightness;
 
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness);
-          }
+          pack_leds[i_pixel] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness);
         }
 
-        if(r_cyclotron_led_fade_out[i].isFinished() && b_cyclotron_led_fading_in[i] == false) {
+        if(!cyclotronFadeRunning(i, true) && !(cyclotronFades.i_flags[i] & FADE_LED_FADING_IN)) {
           i_cyclotron_led_value[i] = 0;
-          b_cyclotron_led_fading_in[i] = true;
+          cyclotronFades.i_flags[i] |= FADE_LED_FADING_IN;
+          cyclotronFadeSetActive(i, false);
 
-          if(cyclotronLookupTable(i) > 0) {
-            pack_leds[cyclotronLookupTable(i) + i_cyclotron_led_start - 1] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
-          }
+          pack_leds[i_pixel] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
         }
       }
     break;
@@ -2650,10 +2736,11 @@ void cyclotronFade() {
           i_colour_scheme = C_RED;
         }
 
-        for(uint8_t i = 0; i < i_cyclotron_leds_total; i++) {
-          if(r_cyclotron_led_fade_in[i].isRunning()) {
-            b_cyclotron_led_fading_in[i] = true;
-            uint8_t i_curr_brightness = r_cyclotron_led_fade_in[i].update();
+        // Only the LEDs which are fading or lit are visited.
+        for(int8_t i = cyclotronFadeNext(0); i >= 0; i = cyclotronFadeNext(i + 1)) {
+          if(cyclotronFadeRunning(i, false)) {
+            cyclotronFades.i_flags[i] |= FADE_LED_FADING_IN;
+            uint8_t i_curr_brightness = cyclotronFadeUpdate(i);
 
             pack_leds[i + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness, false, !b_overheating);
             i_cyclotron_led_value[i] = i_curr_brightness;
@@ -2661,23 +2748,24 @@ void cyclotronFade() {
 
           uint8_t i_new_brightness = getBrightness(i_cyclotron_brightness);
 
-          if(r_cyclotron_led_fade_in[i].isFinished() && i_cyclotron_led_value[i] > (i_new_brightness - 1) && b_cyclotron_led_fading_in[i] == true) {
+          if(!cyclotronFadeRunning(i, false) && i_cyclotron_led_value[i] > (i_new_brightness - 1) && (cyclotronFades.i_flags[i] & FADE_LED_FADING_IN)) {
             pack_leds[i + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_new_brightness, false, !b_overheating);
             i_cyclotron_led_value[i] = i_new_brightness;
           }
 
-          if(r_cyclotron_led_fade_out[i].isRunning()) {
-            uint8_t i_curr_brightness = r_cyclotron_led_fade_out[i].update();
+          if(cyclotronFadeRunning(i, true)) {
+            uint8_t i_curr_brightness = cyclotronFadeUpdate(i);
 
             pack_leds[i + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, i_colour_scheme, i_curr_brightness, false, !b_overheating);
             i_cyclotron_led_value[i] = i_curr_brightness;
-            b_cyclotron_led_fading_in[i] = false;
+            cyclotronFades.i_flags[i] &= ~FADE_LED_FADING_IN;
           }
 
-          if(r_cyclotron_led_fade_out[i].isFinished() && b_cyclotron_led_fading_in[i] == false) {
+          if(!cyclotronFadeRunning(i, true) && !(cyclotronFades.i_flags[i] & FADE_LED_FADING_IN)) {
             pack_leds[i + i_cyclotron_led_start] = getHueAsRGB(CYCLOTRON_OUTER, C_BLACK);
             i_cyclotron_led_value[i] = 0;
-            b_cyclotron_led_fading_in[i] = true;
+            cyclotronFades.i_flags[i] |= FADE_LED_FADING_IN;
+            cyclotronFadeSetActive(i, false);
           }
         }
       }
@@ -2687,10 +2775,10 @@ void cyclotronFade() {
 
 void cyclotron2021(uint16_t iRampDelay) {
   uint8_t i_brightness = getBrightness(i_cyclotron_brightness); // Calculate desired brightness.
-  uint8_t i_curr_cyclotron_position = i_led_cyclotron - i_cyclotron_led_start; // Variable to store current cyclotron LED position.
 
   if(ms_cyclotron.justFinished()) {
-    uint8_t i_cyclotron_matrix_led = cyclotronLookupTable(i_curr_cyclotron_position);
+    // Advance by however many steps have elapsed at the speed this step was timed for.
+    uint8_t i_steps = cyclotronSpinSteps(i_outer_cyclotron_last_step, ms_cyclotron.delay());
 
     if(b_2021_ramp_up) {
       i_fast_led_delay = FAST_LED_UPDATE_MS;
@@ -2704,7 +2792,7 @@ void cyclotron2021(uint16_t iRampDelay) {
         i_vibration_level = i_vibration_idle_level_2021;
       }
       else {
-        i_outer_current_ramp_speed = r_outer_cyclotron_ramp.update();
+        i_outer_current_ramp_speed = animationFrame.i_outer_ramp;
 
         ms_cyclotron.start(i_outer_current_ramp_speed);
 
@@ -2726,7 +2814,7 @@ void cyclotron2021(uint16_t iRampDelay) {
         b_2021_ramp_down = false;
       }
       else {
-        i_outer_current_ramp_speed = r_outer_cyclotron_ramp.update();
+        i_outer_current_ramp_speed = animationFrame.i_outer_ramp;
 
         ms_cyclotron.start(i_outer_current_ramp_speed);
 
@@ -2747,47 +2835,16 @@ void cyclotron2021(uint16_t iRampDelay) {
 
       uint16_t t_iRampDelay = iRampDelay;
 
-      switch(i_cyclotron_leds) {
-        case OUTER_CYCLOTRON_LED_MAX:
-        case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
-          if(i_cyclotron_multiplier > 1) {
-            if(t_iRampDelay - i_cyclotron_multiplier < t_iRampDelay) {
-              t_iRampDelay = t_iRampDelay - i_cyclotron_multiplier;
-            }
-            else {
-              t_iRampDelay = 0;
-            }
-
-            if(b_cyclotron_lid_on) {
-              i_fast_led_delay = FAST_LED_UPDATE_MS + i_cyclotron_multiplier;
-            }
-            else {
-              i_fast_led_delay = FAST_LED_UPDATE_MS;
-            }
-          }
-          else {
-            i_fast_led_delay = FAST_LED_UPDATE_MS;
-          }
-
-          if(i_fast_led_delay > 10) {
-            i_fast_led_delay = 10;
-          }
-        break;
-
-        case FRUTTO_CYCLOTRON_LED_COUNT:
-        case HASLAB_CYCLOTRON_LED_COUNT:
-        default:
-          i_fast_led_delay = FAST_LED_UPDATE_MS;
+      // The spin is timed in micros(), so high density lids no longer need frames skipped to keep up.
+      i_fast_led_delay = FAST_LED_UPDATE_MS;
 
-          if(i_cyclotron_multiplier > 1) {
-            if(t_iRampDelay - i_cyclotron_multiplier < t_iRampDelay) {
-              t_iRampDelay = t_iRampDelay - i_cyclotron_multiplier;
-            }
-            else {
-              t_iRampDelay = 0;
-            }
-          }
-        break;
+      if(i_cyclotron_multiplier > 1) {
+        if(t_iRampDelay - i_cyclotron_multiplier < t_iRampDelay) {
+          t_iRampDelay = t_iRampDelay - i_cyclotron_multiplier;
+        }
+        else {
+          t_iRampDelay = 0;
+        }
       }
 
       if(t_iRampDelay < 1) {
@@ -2866,138 +2923,147 @@ void cyclotron2021(uint16_t iRampDelay) {
       return;
     }
 
-    if(i_cyclotron_led_value[i_curr_cyclotron_position] == 0 && i_cyclotron_matrix_led > 0 && b_cyclotron_lid_on) {
-      r_cyclotron_led_fade_in[i_curr_cyclotron_position].go(0);
-      r_cyclotron_led_fade_in[i_curr_cyclotron_position].go(i_brightness, iRampDelay, CIRCULAR_IN);
+    for(uint8_t i = 0; i < i_steps; i++) {
+      cyclotron2021Step(i_brightness, iRampDelay);
     }
+  }
+}
 
-    uint8_t i_cyclotron_lens_gap = 0;
-    if(b_cyclotron_simulate_ring) {
-      switch(i_cyclotron_leds) {
-        case OUTER_CYCLOTRON_LED_MAX:
-          // Do nothing; already 0.
-        break;
+// Lights the current outer Cyclotron LED and moves on to the next one, skipping the gaps between lenses.
+void cyclotron2021Step(uint8_t i_brightness, uint16_t iRampDelay) {
+  uint8_t i_curr_cyclotron_position = i_led_cyclotron - i_cyclotron_led_start; // Variable to store current cyclotron LED position.
+  uint8_t i_cyclotron_matrix_led = cyclotronLookupTable(i_curr_cyclotron_position);
 
-        case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
-          if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
-            if(i_curr_cyclotron_position == 39) {
-              // Top gap between lenses is about 27 pixels wide.
-              i_cyclotron_lens_gap = 27;
-            }
-            else if(i_curr_cyclotron_position == 19) {
-              // Bottom gap between lenses is about 15 pixels wide.
-              i_cyclotron_lens_gap = 15;
-            }
-            else {
-              // Side gaps between lenses are about 21 pixels wide.
-              i_cyclotron_lens_gap = 21;
-            }
+  if(i_cyclotron_led_value[i_curr_cyclotron_position] == 0 && i_cyclotron_matrix_led > 0 && b_cyclotron_lid_on) {
+    cyclotronFadeStart(i_curr_cyclotron_position, i_brightness, iRampDelay, FADE_CIRCULAR_IN, false);
+  }
+
+  uint8_t i_cyclotron_lens_gap = 0;
+  if(b_cyclotron_simulate_ring) {
+    switch(i_cyclotron_leds) {
+      case OUTER_CYCLOTRON_LED_MAX:
+        // Do nothing; already 0.
+      break;
+
+      case FRUTTO_MAX_CYCLOTRON_LED_COUNT:
+        if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
+          if(i_curr_cyclotron_position == 39) {
+            // Top gap between lenses is about 27 pixels wide.
+            i_cyclotron_lens_gap = 27;
+          }
+          else if(i_curr_cyclotron_position == 19) {
+            // Bottom gap between lenses is about 15 pixels wide.
+            i_cyclotron_lens_gap = 15;
           }
           else {
-            // When ramp to full speed is complete, set all gaps to 3 for speed.
-            i_cyclotron_lens_gap = 3;
+            // Side gaps between lenses are about 21 pixels wide.
+            i_cyclotron_lens_gap = 21;
           }
-        break;
+        }
+        else {
+          // When ramp to full speed is complete, set all gaps to 3 for speed.
+          i_cyclotron_lens_gap = 3;
+        }
+      break;
 
-        case FRUTTO_CYCLOTRON_LED_COUNT:
-          if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
-            if(i_curr_cyclotron_position > 34) {
-              // Top gap between lenses is about 15 pixels wide.
-              i_cyclotron_lens_gap = 15;
-            }
-            else if(i_curr_cyclotron_position > 14 && i_curr_cyclotron_position < 20) {
-              // Bottom gap between lenses is about 9 pixels wide.
-              i_cyclotron_lens_gap = 9;
-            }
-            else {
-              // Side gaps between lenses are about 11 pixels wide.
-              i_cyclotron_lens_gap = 11;
-            }
+      case FRUTTO_CYCLOTRON_LED_COUNT:
+        if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
+          if(i_curr_cyclotron_position > 34) {
+            // Top gap between lenses is about 15 pixels wide.
+            i_cyclotron_lens_gap = 15;
+          }
+          else if(i_curr_cyclotron_position > 14 && i_curr_cyclotron_position < 20) {
+            // Bottom gap between lenses is about 9 pixels wide.
+            i_cyclotron_lens_gap = 9;
           }
           else {
-            // When ramp to full speed is complete, set all gaps to 3 for speed.
-            i_cyclotron_lens_gap = 3;
+            // Side gaps between lenses are about 11 pixels wide.
+            i_cyclotron_lens_gap = 11;
           }
-        break;
+        }
+        else {
+          // When ramp to full speed is complete, set all gaps to 3 for speed.
+          i_cyclotron_lens_gap = 3;
+        }
+      break;
 
-        case HASLAB_CYCLOTRON_LED_COUNT:
-        default:
-          if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
-            if(i_curr_cyclotron_position > 32) {
-              // Top gap between lenses is about 9 pixels wide.
-              i_cyclotron_lens_gap = 9;
-            }
-            else if(i_curr_cyclotron_position > 12 && i_curr_cyclotron_position < 20) {
-              // Bottom gap between lenses is about 5 pixels wide.
-              i_cyclotron_lens_gap = 5;
-            }
-            else {
-              // Side gaps between lenses are about 7 pixels wide.
-              i_cyclotron_lens_gap = 7;
-            }
+      case HASLAB_CYCLOTRON_LED_COUNT:
+      default:
+        if(b_2021_ramp_down || b_2021_ramp_up || b_alarm || b_wand_mash_lockout) {
+          if(i_curr_cyclotron_position > 32) {
+            // Top gap between lenses is about 9 pixels wide.
+            i_cyclotron_lens_gap = 9;
+          }
+          else if(i_curr_cyclotron_position > 12 && i_curr_cyclotron_position < 20) {
+            // Bottom gap between lenses is about 5 pixels wide.
+            i_cyclotron_lens_gap = 5;
           }
           else {
-            // When ramp to full speed is complete, set all gaps to 3 for speed.
-            i_cyclotron_lens_gap = 3;
+            // Side gaps between lenses are about 7 pixels wide.
+            i_cyclotron_lens_gap = 7;
           }
-        break;
-      }
+        }
+        else {
+          // When ramp to full speed is complete, set all gaps to 3 for speed.
+          i_cyclotron_lens_gap = 3;
+        }
+      break;
     }
+  }
 
-    if(b_clockwise) {
-      if(i_cyclotron_matrix_led == 0 && i_cyclotron_fake_ring_counter < i_cyclotron_lens_gap) {
-        i_cyclotron_fake_ring_counter++;
-      }
-      else {
-        i_cyclotron_fake_ring_counter = 0;
+  if(b_clockwise) {
+    if(i_cyclotron_matrix_led == 0 && i_cyclotron_fake_ring_counter < i_cyclotron_lens_gap) {
+      i_cyclotron_fake_ring_counter++;
+    }
+    else {
+      i_cyclotron_fake_ring_counter = 0;
 
-        if(i_cyclotron_matrix_led == 0) {
-          // Skip to the next valid LED value in the array.
-          for(uint8_t i = i_led_cyclotron; i < OUTER_CYCLOTRON_LED_MAX + i_cyclotron_led_start; i++) {
-            if(cyclotronLookupTable(i - i_cyclotron_led_start) > 0) {
-              i_led_cyclotron = i;
-              break;
-            }
-            else if(i == i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1) {
-              // Reset back to the start of the loop.
-              i_led_cyclotron = i_cyclotron_led_start;
-            }
+      if(i_cyclotron_matrix_led == 0) {
+        // Skip to the next valid LED value in the array.
+        for(uint8_t i = i_led_cyclotron; i < OUTER_CYCLOTRON_LED_MAX + i_cyclotron_led_start; i++) {
+          if(cyclotronLookupTable(i - i_cyclotron_led_start) > 0) {
+            i_led_cyclotron = i;
+            break;
+          }
+          else if(i == i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1) {
+            // Reset back to the start of the loop.
+            i_led_cyclotron = i_cyclotron_led_start;
           }
-        }
-        else {
-          i_led_cyclotron++;
         }
       }
-
-      if(i_led_cyclotron > i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1) {
-        i_led_cyclotron = i_cyclotron_led_start;
+      else {
+        i_led_cyclotron++;
       }
     }
+
+    if(i_led_cyclotron > i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1) {
+      i_led_cyclotron = i_cyclotron_led_start;
+    }
+  }
+  else {
+    if(i_cyclotron_matrix_led == 0 && i_cyclotron_fake_ring_counter < i_cyclotron_lens_gap) {
+      i_cyclotron_fake_ring_counter++;
+    }
     else {
-      if(i_cyclotron_matrix_led == 0 && i_cyclotron_fake_ring_counter < i_cyclotron_lens_gap) {
-        i_cyclotron_fake_ring_counter++;
-      }
-      else {
-        i_cyclotron_fake_ring_counter = 0;
+      i_cyclotron_fake_ring_counter = 0;
 
-        if(i_cyclotron_matrix_led == 0) {
-          // Skip to the next valid LED value in the array.
-          for(uint8_t i = i_led_cyclotron; i > i_cyclotron_led_start; i--) {
-            if(cyclotronLookupTable(i - i_cyclotron_led_start) > 0) {
-              i_led_cyclotron = i;
-              break;
-            }
+      if(i_cyclotron_matrix_led == 0) {
+        // Skip to the next valid LED value in the array.
+        for(uint8_t i = i_led_cyclotron; i > i_cyclotron_led_start; i--) {
+          if(cyclotronLookupTable(i - i_cyclotron_led_start) > 0) {
+            i_led_cyclotron = i;
+            break;
           }
         }
-        else {
-          i_led_cyclotron--;
-        }
       }
-
-      if(i_led_cyclotron < i_cyclotron_led_start) {
-        i_led_cyclotron = i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1;
+      else {
+        i_led_cyclotron--;
       }
     }
+
+    if(i_led_cyclotron < i_cyclotron_led_start) {
+      i_led_cyclotron = i_powercell_leds + OUTER_CYCLOTRON_LED_MAX - 1;
+    }
   }
 }
 
@@ -3018,8 +3084,8 @@ void cyclotron1984(uint16_t iRampDelay) {
         i_vibration_level = i_vibration_idle_level_1984;
       }
       else {
-        ms_cyclotron.start(r_outer_cyclotron_ramp.update());
-        i_outer_current_ramp_speed = r_outer_cyclotron_ramp.update();
+        ms_cyclotron.start(animationFrame.i_outer_ramp);
+        i_outer_current_ramp_speed = animationFrame.i_outer_ramp;
 
         i_vibration_level = i_vibration_idle_level_1984;
       }
@@ -3029,8 +3095,8 @@ void cyclotron1984(uint16_t iRampDelay) {
         b_2021_ramp_down = false;
       }
       else {
-        ms_cyclotron.start(r_outer_cyclotron_ramp.update());
-        i_outer_current_ramp_speed = r_outer_cyclotron_ramp.update();
+        ms_cyclotron.start(animationFrame.i_outer_ramp);
+        i_outer_current_ramp_speed = animationFrame.i_outer_ramp;
 
         i_vibration_level = i_vibration_level - 1;
 
@@ -3155,17 +3221,17 @@ void cyclotron1984Alarm() {
 
     if(b_fade_in_now) {
       clearCyclotronFades();
-      r_cyclotron_led_fade_in[led1 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
-      r_cyclotron_led_fade_in[led2 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
-      r_cyclotron_led_fade_in[led3 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
-      r_cyclotron_led_fade_in[led4 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+      cyclotronFadeStart(led1 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
+      cyclotronFadeStart(led2 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
+      cyclotronFadeStart(led3 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
+      cyclotronFadeStart(led4 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
     }
 
     // Turn on all the other cyclotron LEDs if required.
     if(b_cyclotron_single_led != true) {
       for(uint8_t i = 1; i <= i_led_array_width; i++) {
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led1 + i - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led1 + i - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(led1 - i < i_cyclotron_led_start) {
@@ -3176,11 +3242,11 @@ void cyclotron1984Alarm() {
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led1 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led1 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led2 + i - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led2 + i - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(led2 - i < i_cyclotron_led_start) {
@@ -3191,11 +3257,11 @@ void cyclotron1984Alarm() {
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led2 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led2 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led3 + i - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led3 + i - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(led3 - i < i_cyclotron_led_start) {
@@ -3206,11 +3272,11 @@ void cyclotron1984Alarm() {
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led3 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led3 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led4 + i - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led4 + i - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
 
         if(led4 - i < i_cyclotron_led_start) {
@@ -3221,7 +3287,7 @@ void cyclotron1984Alarm() {
         }
 
         if(b_fade_in_now) {
-          r_cyclotron_led_fade_in[led4 - i_cyclotron_led_start].go(i_brightness, i_1984_delay * 2, CIRCULAR_IN);
+          cyclotronFadeStart(led4 - i_cyclotron_led_start, i_brightness, i_1984_delay * 2, FADE_CIRCULAR_IN, false);
         }
       }
     }
@@ -3307,19 +3373,15 @@ void cyclotron84LightOff(uint8_t cLed) {
     }
   }
   else {
-    uint8_t i_brightness_tmp = 0;
-
     if(i_cyclotron_led_value[cLed - i_cyclotron_led_start] == i_brightness) {
-      r_cyclotron_led_fade_out[cLed - i_cyclotron_led_start].go(i_brightness);
-      r_cyclotron_led_fade_out[cLed - i_cyclotron_led_start].go(i_brightness_tmp, (i_1984_delay * 2) / i_cyclotron_multiplier, CIRCULAR_OUT);
+      cyclotronFadeStart(cLed - i_cyclotron_led_start, i_brightness, (i_1984_delay * 2) / i_cyclotron_multiplier, FADE_CIRCULAR_OUT, true);
     }
 
     // Turn off the other 2 LEDs if we are allowing 3 to light up.
     if(b_cyclotron_single_led != true) {
       for(uint8_t i = 1; i <= i_led_array_width; i++) {
         if(i_cyclotron_led_value[cLed + i - i_cyclotron_led_start] == i_brightness) {
-          r_cyclotron_led_fade_out[cLed + i - i_cyclotron_led_start].go(i_brightness);
-          r_cyclotron_led_fade_out[cLed + i - i_cyclotron_led_start].go(i_brightness_tmp, (i_1984_delay * 2) / i_cyclotron_multiplier, CIRCULAR_OUT);
+          cyclotronFadeStart(cLed + i - i_cyclotron_led_start, i_brightness, (i_1984_delay * 2) / i_cyclotron_multiplier, FADE_CIRCULAR_OUT, true);
         }
 
         uint8_t cLedTemp = cLed; // Create new temporary variable for the negative side.
@@ -3332,8 +3394,7 @@ void cyclotron84LightOff(uint8_t cLed) {
         }
 
         if(i_cyclotron_led_value[cLedTemp - i_cyclotron_led_start] == i_brightness) {
-          r_cyclotron_led_fade_out[cLedTemp - i_cyclotron_led_start].go(i_brightness);
-          r_cyclotron_led_fade_out[cLedTemp - i_cyclotron_led_start].go(i_brightness_tmp, (i_1984_delay * 2) / i_cyclotron_multiplier, CIRCULAR_OUT);
+          cyclotronFadeStart(cLedTemp - i_cyclotron_led_start, i_brightness, (i_1984_delay * 2) / i_cyclotron_multiplier, FADE_CIRCULAR_OUT, true);
         }
       }
     }
@@ -3999,10 +4060,96 @@ void resetCyclotronState() {
 void clearCyclotronFades() {
   for(uint8_t i = 0; i < OUTER_CYCLOTRON_LED_MAX; i++) {
     i_cyclotron_led_value[i] = 0;
-    r_cyclotron_led_fade_out[i].go(0);
-    r_cyclotron_led_fade_in[i].go(0);
-    b_cyclotron_led_fading_in[i] = true;
+    cyclotronFades.i_flags[i] = FADE_LED_FADING_IN;
   }
+
+  memset(cyclotronFades.i_active, 0, sizeof(cyclotronFades.i_active));
+}
+
+// Starts a fade on an outer Cyclotron LED (from 0 up to i_level, or from i_level down to 0 if b_out), replacing any fade already running on it.
+void cyclotronFadeStart(uint8_t i_led, uint8_t i_level, uint16_t i_duration, uint8_t i_curve, bool b_out) {
+  cyclotronFades.i_start[i_led] = (uint16_t) millis();
+  cyclotronFades.i_duration[i_led] = i_duration;
+  cyclotronFades.i_level[i_led] = i_level;
+  cyclotronFades.i_curve[i_led] = i_curve;
+  cyclotronFades.i_flags[i_led] = (cyclotronFades.i_flags[i_led] & FADE_LED_FADING_IN) | FADE_RUNNING | (b_out ? FADE_OUT : 0);
+
+  cyclotronFadeSetActive(i_led, true);
+}
+
+// Returns the eased progress (0-255) of a curve at a step (0-255) along it.
+uint8_t fadeEase(uint8_t i_curve, uint8_t i_step) {
+  bool b_mirror = (i_curve == FADE_CIRCULAR_OUT || i_curve == FADE_QUARTIC_OUT);
+  const uint8_t *p_curve = (i_curve == FADE_CIRCULAR_IN || i_curve == FADE_CIRCULAR_OUT) ? i_fade_curve_circular : i_fade_curve_quartic;
+
+  // An "out" curve is the "in" curve run backwards from the far end.
+  uint16_t i_pos = b_mirror ? 256 - i_step : i_step;
+  uint8_t i_ease = PROGMEM_READU8(p_curve[i_pos >> 1]);
+
+  if(i_pos & 0x01) {
+    // Halfway between two samples.
+    i_ease += (PROGMEM_READU8(p_curve[(i_pos >> 1) + 1]) - i_ease) >> 1;
+  }
+
+  return b_mirror ? 255 - i_ease : i_ease;
+}
+
+// Returns the current brightness of an LED's fade, clearing FADE_RUNNING once the fade has reached its end.
+uint8_t cyclotronFadeUpdate(uint8_t i_led) {
+  uint16_t i_elapsed = (uint16_t) millis() - cyclotronFades.i_start[i_led];
+  uint16_t i_duration = cyclotronFades.i_duration[i_led];
+  uint8_t i_level = cyclotronFades.i_level[i_led];
+  bool b_out = (cyclotronFades.i_flags[i_led] & FADE_OUT) != 0;
+
+  if(i_elapsed >= i_duration) {
+    cyclotronFades.i_flags[i_led] &= ~FADE_RUNNING;
+    return b_out ? 0 : i_level;
+  }
+
+  // Position along the fade (0-255) and how far the brightness has moved by then (0-255).
+  uint8_t i_ease = fadeEase(cyclotronFades.i_curve[i_led], ((uint32_t) i_elapsed << 8) / i_duration);
+
+  if(b_out) {
+    return i_level - (((uint16_t) i_level * i_ease + 254) / 255);
+  }
+
+  return ((uint16_t) i_level * i_ease) / 255;
+}
+
+// Whether an LED has a fade in (or fade out, if b_out) which has not yet reached its end.
+bool cyclotronFadeRunning(uint8_t i_led, bool b_out) {
+  uint8_t i_flags = cyclotronFades.i_flags[i_led];
+
+  return (i_flags & FADE_RUNNING) && ((i_flags & FADE_OUT) != 0) == b_out;
+}
+
+void cyclotronFadeSetActive(uint8_t i_led, bool b_active) {
+  if(b_active) {
+    cyclotronFades.i_active[i_led >> 3] |= (1 << (i_led & 0x07));
+  }
+  else {
+    cyclotronFades.i_active[i_led >> 3] &= ~(1 << (i_led & 0x07));
+  }
+}
+
+// Returns the first LED from i_led onwards which still has a fade to service, or -1 if there are none.
+int8_t cyclotronFadeNext(uint8_t i_led) {
+  while(i_led < OUTER_CYCLOTRON_LED_MAX) {
+    uint8_t i_bits = cyclotronFades.i_active[i_led >> 3] >> (i_led & 0x07);
+
+    if(i_bits == 0) {
+      // Nothing else in this group of 8.
+      i_led = (i_led | 0x07) + 1;
+    }
+    else if(i_bits & 0x01) {
+      return i_led;
+    }
+    else {
+      i_led++;
+    }
+  }
+
+  return -1;
 }
 
 void innerCyclotronLEDPanelOff() {
@@ -4026,6 +4173,9 @@ void innerCyclotronCakeOff() {
   for(uint8_t i = i_ic_cake_start; i <= i_ic_cake_end; i++) {
     cyclotron_leds[i] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
   }
+
+  i_cyclotron_ring_drawn[0] = -1;
+  i_cyclotron_ring_drawn[1] = -1;
 }
 
 void innerCyclotronCavityOff() {
@@ -4128,7 +4278,13 @@ void innerCyclotronCavityUpdate(uint16_t iRampDelay) {
 
 // For NeoPixel rings, ramp up and ramp down the LEDs in the ring and set the speed. (optional)
 void innerCyclotronRingUpdate(uint16_t iRampDelay) {
+  bool b_stepped = false;
+
   if(ms_cyclotron_ring.justFinished()) {
+    // Advance by however many steps have elapsed at the speed this step was timed for.
+    uint8_t i_steps = cyclotronSpinSteps(i_inner_cyclotron_last_step, ms_cyclotron_ring.delay());
+    b_stepped = true;
+
     if(b_inner_ramp_up == true) {
       if(r_inner_cyclotron_ramp.isFinished()) {
         b_inner_ramp_up = false;
@@ -4137,8 +4293,8 @@ void innerCyclotronRingUpdate(uint16_t iRampDelay) {
         i_inner_current_ramp_speed = iRampDelay;
       }
       else {
-        ms_cyclotron_ring.start(r_inner_cyclotron_ramp.update());
-        i_inner_current_ramp_speed = r_inner_cyclotron_ramp.update();
+        ms_cyclotron_ring.start(animationFrame.i_inner_ramp);
+        i_inner_current_ramp_speed = animationFrame.i_inner_ramp;
       }
     }
     else if(b_inner_ramp_down == true) {
@@ -4148,9 +4304,9 @@ void innerCyclotronRingUpdate(uint16_t iRampDelay) {
         b_inner_ramp_down = false;
       }
       else {
-        ms_cyclotron_ring.start(r_inner_cyclotron_ramp.update());
+        ms_cyclotron_ring.start(animationFrame.i_inner_ramp);
 
-        i_inner_current_ramp_speed = r_inner_cyclotron_ramp.update();
+        i_inner_current_ramp_speed = animationFrame.i_inner_ramp;
       }
     }
     else {
@@ -4227,7 +4383,40 @@ void innerCyclotronRingUpdate(uint16_t iRampDelay) {
       iRampDelay = 2;
     }
 
-    // Colour control for the Inner Cyclotron LEDs.
+    for(uint8_t i = 0; i < i_steps; i++) {
+      if(b_clockwise == true) {
+        i_led_cyclotron_ring++;
+
+        if(i_led_cyclotron_ring > i_ic_cake_end) {
+          i_led_cyclotron_ring = i_ic_cake_start;
+        }
+      }
+      else {
+        i_led_cyclotron_ring--;
+
+        if(i_led_cyclotron_ring < i_ic_cake_start) {
+          i_led_cyclotron_ring = i_ic_cake_end;
+        }
+      }
+
+      // Update the sparking effect only half as often as the cake is updated.
+      if(i_inner_cyclotron_cavity_num_leds > 0 && (i_led_cyclotron_ring % 2) == 0) {
+        // Update the inner cyclotron cavity LEDs for Frozen Empire w/ a Proton stream.
+        // The delay value is just used to determine when to begin the sparking effect.
+        innerCyclotronCavityUpdate(iRampDelay);
+      }
+    }
+  }
+
+  if(b_cyclotron_lid_on != true && (b_stepped || ms_cyclotron_ring.isRunning())) {
+    innerCyclotronRingBlend(b_stepped);
+  }
+}
+
+// Draws the Inner Cyclotron ring part way between the last LED lit and the next one, by the time elapsed in this step.
+// The colour is only worked out when a step is taken, as the cycling colour schemes move on with every call to getHue.
+void innerCyclotronRingBlend(bool b_new_step) {
+  if(b_new_step || i_cyclotron_ring_drawn[1] < 0) {
     uint8_t i_brightness = getBrightness(i_cyclotron_inner_brightness);
     uint8_t i_colour_scheme = getDeviceColour(CYCLOTRON_INNER, STREAM_MODE, b_cyclotron_colour_toggle);
 
@@ -4238,60 +4427,49 @@ void innerCyclotronRingUpdate(uint16_t iRampDelay) {
       i_colour_scheme = C_ORANGE;
     }
 
-    if(b_clockwise == true) {
-      if(b_cyclotron_lid_on != true) {
-        if(CAKE_LED_TYPE == GRB_LED) {
-          cyclotron_leds[i_led_cyclotron_ring] = getHueAsGRB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
-        }
-        else {
-          cyclotron_leds[i_led_cyclotron_ring] = getHueAsRGB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
-        }
-
-        if(i_led_cyclotron_ring == i_ic_cake_start) {
-          cyclotron_leds[i_ic_cake_end] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
-        }
-        else {
-          cyclotron_leds[i_led_cyclotron_ring - 1] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
-        }
-      }
-
-      i_led_cyclotron_ring++;
-
-      if(i_led_cyclotron_ring > i_ic_cake_end) {
-        i_led_cyclotron_ring = i_ic_cake_start;
-      }
+    if(CAKE_LED_TYPE == GRB_LED) {
+      c_cyclotron_ring_colour = getHueAsGRB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
     }
     else {
-      if(b_cyclotron_lid_on != true) {
-        if(CAKE_LED_TYPE == GRB_LED) {
-          cyclotron_leds[i_led_cyclotron_ring] = getHueAsGRB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
-        }
-        else {
-          cyclotron_leds[i_led_cyclotron_ring] = getHueAsRGB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
-        }
+      c_cyclotron_ring_colour = getHueAsRGB(CYCLOTRON_INNER, i_colour_scheme, i_brightness);
+    }
+  }
 
-        if(i_led_cyclotron_ring + 1 > i_ic_cake_end) {
-          cyclotron_leds[i_ic_cake_start] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
-        }
-        else {
-          cyclotron_leds[i_led_cyclotron_ring + 1] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
-        }
-      }
+  const CRGB &c_ring = c_cyclotron_ring_colour;
 
-      i_led_cyclotron_ring--;
+  // The last LED stepped onto sits behind the current position; the blend moves across to the current position.
+  int8_t i_leading = i_led_cyclotron_ring;
+  int8_t i_trailing = i_leading;
 
-      if(i_led_cyclotron_ring < i_ic_cake_start) {
-        i_led_cyclotron_ring = i_ic_cake_end;
-      }
-    }
+  if(b_clockwise == true) {
+    i_trailing = (i_leading == i_ic_cake_start ? i_ic_cake_end : i_leading - 1);
+  }
+  else {
+    i_trailing = (i_leading == i_ic_cake_end ? i_ic_cake_start : i_leading + 1);
+  }
+
+  uint32_t i_step_us = ms_cyclotron_ring.delay() * 1000UL;
+  int32_t i_elapsed = (int32_t)(micros() - i_inner_cyclotron_last_step);
+  uint8_t i_fraction = 0;
 
-    // Update the sparking effect only half as often as the cake is updated.
-    if(i_inner_cyclotron_cavity_num_leds > 0 && (i_led_cyclotron_ring % 2) == 0) {
-      // Update the inner cyclotron cavity LEDs for Frozen Empire w/ a Proton stream.
-      // The delay value is just used to determine when to begin the sparking effect.
-      innerCyclotronCavityUpdate(iRampDelay);
+  if(i_step_us > 0 && i_elapsed > 0) {
+    i_fraction = ((uint32_t)i_elapsed >= i_step_us ? 255 : ((uint32_t)i_elapsed * 256) / i_step_us);
+  }
+
+  // Clear whatever the previous blend lit which is not part of this one.
+  for(uint8_t i = 0; i < 2; i++) {
+    if(i_cyclotron_ring_drawn[i] >= 0 && i_cyclotron_ring_drawn[i] != i_leading && i_cyclotron_ring_drawn[i] != i_trailing) {
+      cyclotron_leds[i_cyclotron_ring_drawn[i]] = getHueAsRGB(CYCLOTRON_INNER, C_BLACK);
     }
   }
+
+  cyclotron_leds[i_trailing] = c_ring;
+  cyclotron_leds[i_trailing].nscale8(255 - i_fraction);
+  cyclotron_leds[i_leading] = c_ring;
+  cyclotron_leds[i_leading].nscale8(i_fraction);
+
+  i_cyclotron_ring_drawn[0] = i_trailing;
+  i_cyclotron_ring_drawn[1] = i_leading;
 }
 
 void reset2021RampUp() {
@@ -5312,6 +5490,9 @@ void serial1HandShake() {
       // Attenuator has abandoned us.
       b_serial1_syncing = false;
       b_serial1_connected = false;
+
+      // A faster rate may be why we lost contact, so listen at 9600 from now on.
+      serial1BaudRateFallback(true);
     }
     else if(ms_serial1_check.remaining() < (ms_serial1_check.delay() / 2) && !b_serial1_syncing) {
       // Haven't heard from the Attenuator recently; let's check in.
@@ -5336,8 +5517,8 @@ void wandDisconnectCheck() {
       b_wand_syncing = false; // If there is no wand we cannot be syncing with one.
       b_wand_on = false; // No wand means the device is no longer powered on.
 
-      // Tell the serial1 device the wand was disconnected.
-      serial1Send(A_WAND_DISCONNECTED);
+      // A faster rate may be why we lost contact, so listen at 9600 from now on.
+      wandBaudRateFallback(true);
 
       if(b_wand_firing == true) {
         // Reset the pack to a non-firing state.
@@ -5402,11 +5583,11 @@ void wandExtraSoundsBeepLoop() {
 void wandExtraSoundsBeepLoopStop(bool stopNaturally) {
   if(stopNaturally) {
     // Set all beep looping to false so they stop naturally.
-    audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S1, false);
-    audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S2, false);
-    audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S3, false);
-    audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S4, false);
-    audio.trackLoop(S_AFTERLIFE_BEEP_WAND_S5, false);
+    loopEffect(S_AFTERLIFE_BEEP_WAND_S1, false);
+    loopEffect(S_AFTERLIFE_BEEP_WAND_S2, false);
+    loopEffect(S_AFTERLIFE_BEEP_WAND_S3, false);
+    loopEffect(S_AFTERLIFE_BEEP_WAND_S4, false);
+    loopEffect(S_AFTERLIFE_BEEP_WAND_S5, false);
   }
   else {
     // Stop all beeps explicitly to prevent rapid switching from taking up all available channels.
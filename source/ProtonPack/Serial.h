@@ -20,167 +20,156 @@
 
 #pragma once
 
-// Types of packets to be sent.
-enum PACKET_TYPE : uint8_t {
-  PACKET_UNKNOWN = 0,
-  PACKET_COMMAND = 1,
-  PACKET_DATA = 2,
-  PACKET_PACK = 3,
-  PACKET_WAND = 4,
-  PACKET_SMOKE = 5,
-  PACKET_SYNC = 6
-};
-
-// For command signals (1 byte ID, 2 byte optional data).
-struct __attribute__((packed)) CommandPacket {
-  uint8_t s;
-  uint8_t c;
-  uint16_t d1; // Reserved for values over 255 (eg. current music track)
-  uint8_t e;
-};
-
 struct CommandPacket sendCmdW;
 struct CommandPacket recvCmdW;
 struct CommandPacket sendCmdS;
 struct CommandPacket recvCmdS;
 
-// For generic data communication (1 byte ID, 4 byte array).
-struct __attribute__((packed)) MessagePacket {
-  uint8_t s;
-  uint8_t m;
-  uint8_t d[3]; // Reserved for multiple, arbitrary byte values.
-  uint8_t e;
-};
-
 struct MessagePacket sendDataW;
 struct MessagePacket recvDataW;
 struct MessagePacket sendDataS;
 struct MessagePacket recvDataS;
 
-struct __attribute__((packed)) PackPrefs {
-  uint8_t defaultSystemModePack;
-  uint8_t defaultYearThemePack;
-  uint8_t currentYearThemePack;
-  uint8_t defaultSystemVolume;
-  uint8_t packVibration;
-  uint8_t ribbonCableAlarm;
-  uint8_t cyclotronDirection;
-  uint8_t demoLightMode;
-  uint8_t protonStreamEffects;
-  uint8_t overheatStrobeNF;
-  uint8_t overheatSyncToFan;
-  uint8_t overheatLightsOff;
-  uint8_t ledCycLidCount;
-  uint8_t ledCycLidHue;
-  uint8_t ledCycLidSat;
-  uint8_t ledCycLidCenter;
-  uint8_t ledCycLidFade;
-  uint8_t ledCycLidSimRing;
-  uint8_t ledCycInnerPanel;
-  uint8_t ledCycCakeCount;
-  uint8_t ledCycCakeHue;
-  uint8_t ledCycCakeSat;
-  uint8_t ledCycCakeGRB;
-  uint8_t ledCycCavCount;
-  uint8_t ledCycCavType;
-  uint8_t ledVGCyclotron;
-  uint8_t ledPowercellCount;
-  uint8_t ledInvertPowercell;
-  uint8_t ledPowercellHue;
-  uint8_t ledPowercellSat;
-  uint8_t ledVGPowercell;
-} packConfig;
-
-struct __attribute__((packed)) WandPrefs {
-  uint8_t ledWandCount;
-  uint8_t ledWandHue;
-  uint8_t ledWandSat;
-  uint8_t rgbVentEnabled;
-  uint8_t spectralModesEnabled;
-  uint8_t overheatEnabled;
-  uint8_t defaultFiringMode;
-  uint8_t wandVibration;
-  uint8_t wandSoundsToPack;
-  uint8_t quickVenting;
-  uint8_t autoVentLight;
-  uint8_t wandBeepLoop;
-  uint8_t wandBootError;
-  uint8_t defaultYearModeWand;
-  uint8_t defaultYearModeCTS;
-  uint8_t numBargraphSegments;
-  uint8_t invertWandBargraph;
-  uint8_t bargraphOverheatBlink;
-  uint8_t bargraphIdleAnimation;
-  uint8_t bargraphFireAnimation;
-} wandConfig;
-
-struct __attribute__((packed)) SmokePrefs {
-  // Pack
-  uint8_t smokeEnabled;
-  uint8_t overheatContinuous5;
-  uint8_t overheatContinuous4;
-  uint8_t overheatContinuous3;
-  uint8_t overheatContinuous2;
-  uint8_t overheatContinuous1;
-  uint8_t overheatDuration5;
-  uint8_t overheatDuration4;
-  uint8_t overheatDuration3;
-  uint8_t overheatDuration2;
-  uint8_t overheatDuration1;
-  // Wand
-  uint8_t overheatLevel5;
-  uint8_t overheatLevel4;
-  uint8_t overheatLevel3;
-  uint8_t overheatLevel2;
-  uint8_t overheatLevel1;
-  uint8_t overheatDelay5;
-  uint8_t overheatDelay4;
-  uint8_t overheatDelay3;
-  uint8_t overheatDelay2;
-  uint8_t overheatDelay1;
-} smokeConfig;
-
-struct __attribute__((packed)) WandSyncData {
-  uint8_t systemMode;
-  uint8_t ionArmSwitch;
-  uint8_t cyclotronLidState;
-  uint8_t systemYear;
-  uint8_t packOn;
-  uint8_t powerLevel;
-  uint8_t streamMode;
-  uint8_t vibrationEnabled;
-  uint8_t masterVolume;
-  uint8_t effectsVolume;
-  uint8_t masterMuted;
-  uint8_t repeatMusicTrack;
-} wandSyncData;
-
-struct __attribute__((packed)) AttenuatorSyncData {
-  uint8_t systemMode;
-  uint8_t ionArmSwitch;
-  uint8_t cyclotronLidState;
-  uint8_t systemYear;
-  uint8_t packOn;
-  uint8_t powerLevel;
-  uint8_t streamMode;
-  uint8_t wandPresent;
-  uint8_t barrelExtended;
-  uint8_t wandFiring;
-  uint8_t overheatingNow;
-  uint8_t speedMultiplier;
-  uint8_t spectralColour;
-  uint8_t spectralSaturation;
-  uint8_t masterMuted;
-  uint8_t masterVolume;
-  uint8_t effectsVolume;
-  uint8_t musicVolume;
-  uint8_t musicPlaying;
-  uint8_t musicPaused;
-  uint8_t trackLooped;
-  uint16_t currentTrack;
-  uint16_t musicCount;
-  uint16_t packVoltage;
-} attenuatorSyncData;
+/*
+ * Serial link speed negotiation.
+ * Both links always start at 9600 baud. A device which can go faster advertises a bitmask of its supported
+ * rates as the value of its handshake, to which the pack answers with a handshake naming the single rate
+ * to be used. Both ends then switch, and the link drops back to 9600 on repeated CRC/framing errors or when
+ * the far end does not answer at the new rate.
+ * Each link also tracks whether a packet is part-way received, so that LED updates can wait for it to finish.
+ */
+enum BAUD_RATE_OPTIONS : uint8_t {
+  BAUD_RATE_DEFAULT = 0, // 9600
+  BAUD_RATE_57600 = 1,
+  BAUD_RATE_115200 = 2
+};
+
+const uint8_t i_baud_rates_supported = BAUD_RATE_57600 | BAUD_RATE_115200;
+const uint8_t i_baud_error_limit = 3; // Consecutive receive errors allowed before a link falls back to 9600.
+const uint16_t i_baud_confirm_delay = 1000; // Time allowed for the far end to answer at a newly selected rate.
+
+const uint16_t i_serial_rx_idle_gap = 3000; // Microseconds without a byte before a part-received packet is abandoned.
+
+struct SerialLinkState {
+  uint8_t i_rate = BAUD_RATE_DEFAULT; // Currently active rate for the link.
+  uint8_t i_errors = 0; // Consecutive receive errors seen at the active rate.
+  bool b_locked = false; // Set when a faster rate misbehaved; the link then stays at 9600 until a restart.
+  millisDelay ms_confirm; // Runs until the first good packet arrives at a newly selected rate.
+  bool b_rx_partial = false; // The last read stopped part-way through a packet.
+  uint32_t i_rx_partial_time = 0; // When the last byte of that partial packet was read (micros).
+  struct LinkStats stats = {};
+};
+
+struct SerialLinkState wandLink;
+struct SerialLinkState serial1Link;
+
+/*
+ * Outgoing command queues.
+ * Commands are held until the single flush point in loop(), then sent highest priority first and in the order
+ * issued within each priority. A command which sets the same state on the receiver as one already waiting
+ * (eg. alarm on/off) takes the place of that command, so only the newest is sent.
+ */
+enum SERIAL_TX_PRIORITIES : uint8_t {
+  TX_PRIORITY_SAFETY = 0, // Link control, power and alarm states.
+  TX_PRIORITY_FIRING = 1, // Firing, overheat and venting states.
+  TX_PRIORITY_COSMETIC = 2, // Everything else (modes, settings, music).
+  TX_PRIORITY_COUNT = 3
+};
+
+const uint8_t i_serial_tx_queue_size = 8;
+
+struct SerialTxCommand {
+  uint8_t c;
+  uint16_t d1;
+  uint8_t priority;
+  uint8_t group; // Commands with the same non-zero group replace each other while waiting.
+};
+
+struct SerialTxQueue {
+  struct SerialTxCommand commands[i_serial_tx_queue_size];
+  uint8_t count = 0;
+};
+
+struct SerialTxQueue wandTxQueue;
+struct SerialTxQueue serial1TxQueue;
+
+struct PackPrefs packConfig;
+
+struct WandPrefs wandConfig;
+
+struct SmokePrefs smokeConfig;
+
+struct WandSyncData wandSyncData;
+
+struct AttenuatorSyncData attenuatorSyncData;
+
+// Size in bytes of each AttenuatorSyncData field, in the same order as above.
+const uint8_t i_sync_field_sizes[SYNC_FIELD_COUNT] PROGMEM = {
+  ATTENUATOR_SYNC_FIELDS(PROTOCOL_SYNC_SIZE)
+};
+
+struct SyncDeltaPacket syncDelta; // Field mask followed by only the changed AttenuatorSyncData fields.
+
+struct AttenuatorSyncData attenuatorSyncSent; // Last state the Serial1 device was told about.
+
+/*
+ * Acknowledged delivery of critical packets to the wand.
+ * A packet which must not be lost (eg. saving preferences, alarm and overheat transitions) is wrapped in a
+ * PACKET_RELIABLE frame carrying a sequence number, which the far end answers with a PACKET_ACK naming that
+ * number. One frame is in flight per link and is resent until acknowledged, so a dropped packet costs one
+ * retry delay rather than a full resync. A repeated sequence number is acknowledged again but not acted on.
+ * Frames are only used once the far end is known to understand them, as advertised during the sync.
+ */
+const uint8_t i_link_reliable_supported = 0x80; // Capability flag, kept clear of the baud rate bits in a handshake.
+const uint8_t i_reliable_queue_size = 4;
+const uint8_t i_reliable_retry_delay = 50; // Time to wait for an acknowledgement before sending again.
+const uint8_t i_reliable_retry_max = 5; // Resends allowed before a frame is abandoned.
+const uint8_t i_reliable_payload_max = sizeof(WandPrefs) > sizeof(SmokePrefs) ? sizeof(WandPrefs) : sizeof(SmokePrefs);
+
+struct ReliableFrame {
+  uint8_t seq;
+  uint8_t type;
+  uint8_t length;
+  uint8_t d[i_reliable_payload_max];
+};
+
+struct ReliableChannel {
+  struct ReliableFrame frames[i_reliable_queue_size];
+  uint8_t count = 0;
+  uint8_t i_tx_seq = 0; // Last sequence number given to an outgoing frame (never 0).
+  uint8_t i_rx_seq = 0; // Last sequence number handled from the far end.
+  uint8_t i_retries = 0; // Resends of the frame currently in flight.
+  bool b_waiting = false; // The first frame has been sent and is awaiting acknowledgement.
+  bool b_peer_ready = false; // The far end has shown it understands reliable frames.
+  millisDelay ms_retry;
+  uint32_t i_sent_time = 0; // When the frame in flight was first sent (micros).
+  uint16_t i_retransmits = 0; // Total resends since power on.
+  uint16_t i_failures = 0; // Total frames abandoned since power on.
+  uint16_t i_rtt_last = 0; // us - Round trip of the last frame acknowledged without a resend.
+  uint16_t i_rtt_max = 0; // us
+};
+
+struct ReliableChannel wandReliable;
+
+// Counters for both links, sent to the Serial1 device every few seconds.
+const uint16_t i_link_stats_delay = 5000;
+millisDelay ms_link_stats;
+
+struct __attribute__((packed)) LinkStatsData {
+  struct LinkStats wand;
+  struct LinkStats serial1;
+} linkStatsData;
+
+#if PROFILER == 1
+// Summary of the main loop profiler, in microseconds per stage (see Profiler.h).
+struct __attribute__((packed)) LoopProfileData {
+  uint16_t stageAvg[PROFILE_STAGE_COUNT];
+  uint16_t stageMax[PROFILE_STAGE_COUNT];
+  uint16_t ledFramesDeferred;
+  uint16_t ledFramesForced;
+  uint32_t ledFramesSkipped;
+} loopProfileData;
+#endif
 
 // Adjusts which year mode the Proton Pack and Neutrona Wand are in, as switched by the Neutrona Wand.
 void toggleYearModes() {
@@ -262,8 +251,254 @@ void toggleYearModes() {
  * Serial API Communication Handlers
  */
 
-// Outgoing commands to the Serial1 device
-void serial1Send(uint8_t i_command, uint16_t i_value) {
+// Sends a packet built in the transmit buffer, counting the bytes which go out on its link.
+void linkSendData(SerialTransfer &coms, uint16_t i_send_size, uint8_t i_packet_id) {
+  struct SerialLinkState &link = (&coms == &packComs) ? wandLink : serial1Link;
+
+  // Framing adds start, ID, overhead and length bytes ahead of the payload, with a CRC and stop byte after.
+  link.stats.txBytes += coms.sendData(i_send_size, i_packet_id) + 6;
+}
+
+// Adds a command to a queue, replacing any waiting command of the same group. Returns false when full.
+bool serialTxQueueAdd(struct SerialTxQueue &queue, uint8_t i_command, uint16_t i_value, uint8_t i_priority, uint8_t i_group) {
+  if(i_group > 0) {
+    for(uint8_t i = 0; i < queue.count; i++) {
+      if(queue.commands[i].group == i_group) {
+        queue.commands[i].c = i_command;
+        queue.commands[i].d1 = i_value;
+        return true;
+      }
+    }
+  }
+
+  if(queue.count >= i_serial_tx_queue_size) {
+    return false;
+  }
+
+  queue.commands[queue.count].c = i_command;
+  queue.commands[queue.count].d1 = i_value;
+  queue.commands[queue.count].priority = i_priority;
+  queue.commands[queue.count].group = i_group;
+  queue.count++;
+
+  return true;
+}
+
+// Writes out every waiting command by priority, then empties the queue.
+void serialTxQueueFlush(struct SerialTxQueue &queue, void (*sendCommand)(uint8_t, uint16_t)) {
+  for(uint8_t i_priority = 0; i_priority < TX_PRIORITY_COUNT; i_priority++) {
+    for(uint8_t i = 0; i < queue.count; i++) {
+      if(queue.commands[i].priority == i_priority) {
+        sendCommand(queue.commands[i].c, queue.commands[i].d1);
+      }
+    }
+  }
+
+  queue.count = 0;
+}
+
+// Clears a reliable channel, as done whenever the far end is (re)synchronized.
+void reliableReset(struct ReliableChannel &channel) {
+  channel.count = 0;
+  channel.i_rx_seq = 0;
+  channel.i_retries = 0;
+  channel.b_waiting = false;
+  channel.b_peer_ready = false;
+  channel.ms_retry.stop();
+}
+
+// Queues a packet for acknowledged delivery. Returns false when the far end cannot take it or the queue is full.
+bool reliableQueue(struct ReliableChannel &channel, uint8_t i_type, const void *data, uint8_t i_length) {
+  if(!channel.b_peer_ready || channel.count >= i_reliable_queue_size || i_length > i_reliable_payload_max) {
+    return false;
+  }
+
+  channel.i_tx_seq++;
+
+  if(channel.i_tx_seq == 0) {
+    // Zero is never used, so a freshly reset receiver cannot mistake the first frame for a repeat.
+    channel.i_tx_seq = 1;
+  }
+
+  channel.frames[channel.count].seq = channel.i_tx_seq;
+  channel.frames[channel.count].type = i_type;
+  channel.frames[channel.count].length = i_length;
+  memcpy(channel.frames[channel.count].d, data, i_length);
+  channel.count++;
+
+  return true;
+}
+
+// Writes the frame at the head of the queue and starts waiting for its acknowledgement.
+void reliableWrite(SerialTransfer &coms, struct ReliableChannel &channel) {
+  struct ReliableHeader header = {channel.frames[0].seq, channel.frames[0].type};
+  uint16_t i_send_size = coms.txObj(header);
+
+  i_send_size = coms.txObj(channel.frames[0].d, i_send_size, channel.frames[0].length);
+  linkSendData(coms, i_send_size, (uint8_t) PACKET_RELIABLE);
+
+  if(channel.i_retries == 0) {
+    channel.i_sent_time = micros();
+  }
+
+  channel.b_waiting = true;
+  channel.ms_retry.start(i_reliable_retry_delay);
+}
+
+// Removes the frame at the head of the queue.
+void reliablePop(struct ReliableChannel &channel) {
+  for(uint8_t i = 1; i < channel.count; i++) {
+    channel.frames[i - 1] = channel.frames[i];
+  }
+
+  channel.count--;
+  channel.i_retries = 0;
+  channel.b_waiting = false;
+  channel.ms_retry.stop();
+}
+
+// Sends the next waiting frame, or resends the one in flight once its retry delay has passed.
+void reliableService(SerialTransfer &coms, struct ReliableChannel &channel) {
+  if(channel.count == 0) {
+    return;
+  }
+
+  if(channel.b_waiting) {
+    if(!channel.ms_retry.justFinished()) {
+      return;
+    }
+
+    if(channel.i_retries >= i_reliable_retry_max) {
+      // The far end is not answering, so give up on this frame and leave it to the next resync.
+      channel.i_failures++;
+      reliablePop(channel);
+
+      if(channel.count == 0) {
+        return;
+      }
+    }
+    else {
+      channel.i_retries++;
+      channel.i_retransmits++;
+    }
+  }
+
+  reliableWrite(coms, channel);
+}
+
+// Releases the frame in flight if the far end has acknowledged it, then sends the next one.
+void reliableAcknowledged(SerialTransfer &coms, struct ReliableChannel &channel, uint8_t i_seq) {
+  if(channel.b_waiting && channel.count > 0 && channel.frames[0].seq == i_seq) {
+    if(channel.i_retries == 0) {
+      // Only time frames sent once, as an acknowledgement after a resend could be for either send.
+      uint32_t i_rtt = micros() - channel.i_sent_time;
+
+      channel.i_rtt_last = i_rtt > 0xFFFF ? 0xFFFF : i_rtt;
+      channel.i_rtt_max = max(channel.i_rtt_max, channel.i_rtt_last);
+    }
+
+    reliablePop(channel);
+    reliableService(coms, channel);
+  }
+}
+
+// Acknowledges a received frame. Returns true when it has not been seen before and should be handled.
+bool reliableReceived(SerialTransfer &coms, struct ReliableChannel &channel, uint8_t i_seq) {
+  // Always answer, as it may have been our previous acknowledgement which was lost.
+  uint16_t i_send_size = coms.txObj(i_seq);
+  linkSendData(coms, i_send_size, (uint8_t) PACKET_ACK);
+
+  channel.b_peer_ready = true;
+
+  if(i_seq == channel.i_rx_seq) {
+    return false;
+  }
+
+  channel.i_rx_seq = i_seq;
+
+  return true;
+}
+
+uint8_t serial1SendPriority(uint8_t i_command) {
+  switch(i_command) {
+    case A_HANDSHAKE:
+    case A_SYNC_START:
+    case A_SYNC_END:
+    case A_PACK_ON:
+    case A_PACK_OFF:
+    case A_ALARM_ON:
+    case A_ALARM_OFF:
+      return TX_PRIORITY_SAFETY;
+    break;
+
+    case A_FIRING:
+    case A_FIRING_STOPPED:
+    case A_CYCLOTRON_NORMAL_SPEED:
+    case A_CYCLOTRON_INCREASE_SPEED:
+    case A_OVERHEATING:
+    case A_OVERHEATING_FINISHED:
+    case A_VENTING:
+    case A_VENTING_FINISHED:
+      return TX_PRIORITY_FIRING;
+    break;
+
+    default:
+      return TX_PRIORITY_COSMETIC;
+    break;
+  }
+}
+
+// Commands which only set a state on the Attenuator share a group, named after the first command of the set.
+uint8_t serial1SendGroup(uint8_t i_command) {
+  switch(i_command) {
+    case A_PACK_ON:
+    case A_PACK_OFF:
+      return A_PACK_ON;
+    break;
+
+    case A_WAND_ON:
+    case A_WAND_OFF:
+      return A_WAND_ON;
+    break;
+
+    case A_ALARM_ON:
+    case A_ALARM_OFF:
+      return A_ALARM_ON;
+    break;
+
+    case A_FIRING:
+    case A_FIRING_STOPPED:
+      return A_FIRING;
+    break;
+
+    case A_CYCLOTRON_NORMAL_SPEED:
+    case A_CYCLOTRON_INCREASE_SPEED:
+      return A_CYCLOTRON_NORMAL_SPEED;
+    break;
+
+    case A_MUSIC_IS_PLAYING:
+    case A_MUSIC_IS_NOT_PLAYING:
+      return A_MUSIC_IS_PLAYING;
+    break;
+
+    case A_MUSIC_IS_PAUSED:
+    case A_MUSIC_IS_NOT_PAUSED:
+      return A_MUSIC_IS_PAUSED;
+    break;
+
+    case A_WAND_POWER_AMPS:
+      return A_WAND_POWER_AMPS;
+    break;
+
+    default:
+      // Everything else is sent as many times as it is issued.
+      return 0;
+    break;
+  }
+}
+
+// Writes a command to the Serial1 device immediately.
+void serial1Write(uint8_t i_command, uint16_t i_value) {
   uint16_t i_send_size = 0;
 
   // debug(F("Command to Serial1: "));
@@ -275,7 +510,24 @@ void serial1Send(uint8_t i_command, uint16_t i_value) {
   sendCmdS.e = P_COM_END;
 
   i_send_size = serial1Coms.txObj(sendCmdS);
-  serial1Coms.sendData(i_send_size, (uint8_t) PACKET_COMMAND);
+  linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_COMMAND);
+}
+
+// Sends all commands queued for the Serial1 device.
+void serial1Flush() {
+  serialTxQueueFlush(serial1TxQueue, serial1Write);
+}
+
+// Outgoing commands to the Serial1 device, which are held until the next flush.
+void serial1Send(uint8_t i_command, uint16_t i_value) {
+  uint8_t i_priority = serial1SendPriority(i_command);
+  uint8_t i_group = serial1SendGroup(i_command);
+
+  if(!serialTxQueueAdd(serial1TxQueue, i_command, i_value, i_priority, i_group)) {
+    // No room left, so send what is waiting now.
+    serial1Flush();
+    serialTxQueueAdd(serial1TxQueue, i_command, i_value, i_priority, i_group);
+  }
 }
 // Override function to handle calls with a single parameter.
 void serial1Send(uint8_t i_command) {
@@ -290,6 +542,9 @@ void serial1SendData(uint8_t i_message) {
   // debug(F("Data to Serial1: "))
   // debugln(i_message);
 
+  // Payloads are sent immediately, so any commands issued before this one must go first.
+  serial1Flush();
+
   sendDataS.s = P_COM_START;
   sendDataS.m = i_message;
   sendDataS.e = P_COM_END;
@@ -305,12 +560,12 @@ void serial1SendData(uint8_t i_message) {
       sendDataS.d[1] = i_spectral_cyclotron_custom_saturation;
 
       i_send_size = serial1Coms.txObj(sendDataS);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_DATA);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_DATA);
     break;
 
     case A_SYNC_DATA:
       i_send_size = serial1Coms.txObj(attenuatorSyncData);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_SYNC);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_SYNC);
     break;
 
     case A_VOLUME_SYNC:
@@ -320,7 +575,38 @@ void serial1SendData(uint8_t i_message) {
       sendDataS.d[2] = i_volume_music_percentage;
 
       i_send_size = serial1Coms.txObj(sendDataS);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_DATA);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_DATA);
+    break;
+
+    #if PROFILER == 1
+      case A_LOOP_PROFILE:
+        for(uint8_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+          loopProfileData.stageAvg[i] = profileAverage(i);
+          loopProfileData.stageMax[i] = profile_stages[i].Max;
+        }
+
+        loopProfileData.ledFramesDeferred = i_fast_led_frames_deferred;
+        loopProfileData.ledFramesForced = i_fast_led_frames_forced;
+        loopProfileData.ledFramesSkipped = i_fast_led_frames_skipped;
+
+        i_send_size = serial1Coms.txObj(loopProfileData);
+        linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_PROFILE);
+      break;
+    #endif
+
+    case A_LINK_STATS:
+      wandLink.stats.retransmits = wandReliable.i_retransmits;
+      wandLink.stats.failures = wandReliable.i_failures;
+      wandLink.stats.rttLast = wandReliable.i_rtt_last;
+      wandLink.stats.rttMax = wandReliable.i_rtt_max;
+      wandLink.stats.baudRate = wandLink.i_rate;
+      serial1Link.stats.baudRate = serial1Link.i_rate;
+
+      linkStatsData.wand = wandLink.stats;
+      linkStatsData.serial1 = serial1Link.stats;
+
+      i_send_size = serial1Coms.txObj(linkStatsData);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_LINK_STATS);
     break;
 
     case A_SEND_PREFERENCES_PACK:
@@ -411,13 +697,13 @@ void serial1SendData(uint8_t i_message) {
       packConfig.ledVGPowercell = b_powercell_colour_toggle ? 1 : 0;
 
       i_send_size = serial1Coms.txObj(packConfig);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_PACK);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_PACK);
     break;
 
     case A_SEND_PREFERENCES_WAND:
       // Any ENUM or boolean types will simply translate as numeric values.
       i_send_size = serial1Coms.txObj(wandConfig);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_WAND);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_WAND);
     break;
 
     case A_SEND_PREFERENCES_SMOKE:
@@ -454,7 +740,7 @@ void serial1SendData(uint8_t i_message) {
       }
 
       i_send_size = serial1Coms.txObj(smokeConfig);
-      serial1Coms.sendData(i_send_size, (uint8_t) PACKET_SMOKE);
+      linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_SMOKE);
     break;
 
     default:
@@ -463,8 +749,133 @@ void serial1SendData(uint8_t i_message) {
   }
 }
 
-// Outgoing commands to the wand
-void packSerialSend(uint8_t i_command, uint16_t i_value) {
+// Sends the link health counters to the Serial1 device every few seconds.
+void serial1SendLinkStats() {
+  if(!ms_link_stats.isRunning()) {
+    ms_link_stats.start(i_link_stats_delay);
+  }
+  else if(ms_link_stats.justFinished()) {
+    serial1SendData(A_LINK_STATS);
+    ms_link_stats.start(i_link_stats_delay);
+  }
+}
+
+uint8_t packSerialSendPriority(uint8_t i_command) {
+  switch(i_command) {
+    case P_HANDSHAKE:
+    case P_SYNC_START:
+    case P_SYNC_END:
+    case P_POST_FINISH:
+    case P_ON:
+    case P_OFF:
+    case P_ALARM_ON:
+    case P_ALARM_OFF:
+      return TX_PRIORITY_SAFETY;
+    break;
+
+    case P_MANUAL_OVERHEAT:
+    case P_OVERHEATING_FINISHED:
+    case P_VENTING_FINISHED:
+    case P_WARNING_CANCELLED:
+      return TX_PRIORITY_FIRING;
+    break;
+
+    default:
+      return TX_PRIORITY_COSMETIC;
+    break;
+  }
+}
+
+// Commands which only set a state on the wand share a group, named after the first command of the set.
+uint8_t packSerialSendGroup(uint8_t i_command) {
+  switch(i_command) {
+    case P_ON:
+    case P_OFF:
+      return P_ON;
+    break;
+
+    case P_ALARM_ON:
+    case P_ALARM_OFF:
+      return P_ALARM_ON;
+    break;
+
+    case P_VIBRATION_ENABLED:
+    case P_VIBRATION_DISABLED:
+      return P_VIBRATION_ENABLED;
+    break;
+
+    case P_YEAR_1984:
+    case P_YEAR_1989:
+    case P_YEAR_AFTERLIFE:
+    case P_YEAR_FROZEN_EMPIRE:
+      return P_YEAR_1984;
+    break;
+
+    case P_MODE_FROZEN_EMPIRE:
+    case P_MODE_AFTERLIFE:
+    case P_MODE_1989:
+    case P_MODE_1984:
+      return P_MODE_FROZEN_EMPIRE;
+    break;
+
+    case P_SMOKE_DISABLED:
+    case P_SMOKE_ENABLED:
+      return P_SMOKE_DISABLED;
+    break;
+
+    case P_CYCLOTRON_COUNTER_CLOCKWISE:
+    case P_CYCLOTRON_CLOCKWISE:
+      return P_CYCLOTRON_COUNTER_CLOCKWISE;
+    break;
+
+    case P_MASTER_AUDIO_SILENT_MODE:
+    case P_MASTER_AUDIO_NORMAL:
+      return P_MASTER_AUDIO_SILENT_MODE;
+    break;
+
+    case P_MODE_SUPER_HERO:
+    case P_MODE_ORIGINAL:
+      return P_MODE_SUPER_HERO;
+    break;
+
+    case P_ION_ARM_SWITCH_ON:
+    case P_ION_ARM_SWITCH_OFF:
+      return P_ION_ARM_SWITCH_ON;
+    break;
+
+    case P_CYCLOTRON_LID_ON:
+    case P_CYCLOTRON_LID_OFF:
+      return P_CYCLOTRON_LID_ON;
+    break;
+
+    default:
+      // Everything else (eg. relative volume steps) is sent as many times as it is issued.
+      return 0;
+    break;
+  }
+}
+
+// Commands whose loss would leave the wand out of step with the pack until the next resync.
+bool packSerialSendReliable(uint8_t i_command) {
+  switch(i_command) {
+    case P_SAVE_EEPROM_WAND:
+    case P_ALARM_ON:
+    case P_ALARM_OFF:
+    case P_MANUAL_OVERHEAT:
+    case P_OVERHEATING_FINISHED:
+    case P_VENTING_FINISHED:
+    case P_WARNING_CANCELLED:
+      return true;
+    break;
+
+    default:
+      return false;
+    break;
+  }
+}
+
+// Writes a command to the wand immediately, or hands it to the reliable channel where required.
+void packSerialWrite(uint8_t i_command, uint16_t i_value) {
   uint16_t i_send_size = 0;
 
   debug(F("Command to Wand: "));
@@ -475,8 +886,30 @@ void packSerialSend(uint8_t i_command, uint16_t i_value) {
   sendCmdW.d1 = i_value;
   sendCmdW.e = P_COM_END;
 
+  if(packSerialSendReliable(i_command) && reliableQueue(wandReliable, PACKET_COMMAND, &sendCmdW, sizeof(sendCmdW))) {
+    return;
+  }
+
   i_send_size = packComs.txObj(sendCmdW);
-  packComs.sendData(i_send_size, (uint8_t) PACKET_COMMAND);
+  linkSendData(packComs, i_send_size, (uint8_t) PACKET_COMMAND);
+}
+
+// Sends all commands queued for the wand.
+void packSerialFlush() {
+  serialTxQueueFlush(wandTxQueue, packSerialWrite);
+  reliableService(packComs, wandReliable);
+}
+
+// Outgoing commands to the wand, which are held until the next flush.
+void packSerialSend(uint8_t i_command, uint16_t i_value) {
+  uint8_t i_priority = packSerialSendPriority(i_command);
+  uint8_t i_group = packSerialSendGroup(i_command);
+
+  if(!serialTxQueueAdd(wandTxQueue, i_command, i_value, i_priority, i_group)) {
+    // No room left, so send what is waiting now.
+    packSerialFlush();
+    serialTxQueueAdd(wandTxQueue, i_command, i_value, i_priority, i_group);
+  }
 }
 // Override function to handle calls with a single parameter.
 void packSerialSend(uint8_t i_command) {
@@ -490,6 +923,9 @@ void packSerialSendData(uint8_t i_message) {
   // debug(F("Data to Wand: "));
   // debugln(i_message);
 
+  // Payloads are sent immediately, so any commands issued before this one must go first.
+  packSerialFlush();
+
   sendDataW.s = P_COM_START;
   sendDataW.m = i_message;
   sendDataW.s = P_COM_END;
@@ -500,18 +936,29 @@ void packSerialSendData(uint8_t i_message) {
   // Provide additional data with certain messages.
   switch(i_message) {
     case P_SAVE_PREFERENCES_WAND:
-      i_send_size = packComs.txObj(wandConfig);
-      packComs.sendData(i_send_size, (uint8_t) PACKET_WAND);
+      // Preferences are sent with acknowledged delivery where the wand supports it.
+      if(reliableQueue(wandReliable, PACKET_WAND, &wandConfig, sizeof(wandConfig))) {
+        reliableService(packComs, wandReliable);
+      }
+      else {
+        i_send_size = packComs.txObj(wandConfig);
+        linkSendData(packComs, i_send_size, (uint8_t) PACKET_WAND);
+      }
     break;
 
     case P_SAVE_PREFERENCES_SMOKE:
-      i_send_size = packComs.txObj(smokeConfig);
-      packComs.sendData(i_send_size, (uint8_t) PACKET_SMOKE);
+      if(reliableQueue(wandReliable, PACKET_SMOKE, &smokeConfig, sizeof(smokeConfig))) {
+        reliableService(packComs, wandReliable);
+      }
+      else {
+        i_send_size = packComs.txObj(smokeConfig);
+        linkSendData(packComs, i_send_size, (uint8_t) PACKET_SMOKE);
+      }
     break;
 
     case P_SYNC_DATA:
       i_send_size = packComs.txObj(wandSyncData);
-      packComs.sendData(i_send_size, (uint8_t) PACKET_SYNC);
+      linkSendData(packComs, i_send_size, (uint8_t) PACKET_SYNC);
     break;
 
     default:
@@ -520,6 +967,169 @@ void packSerialSendData(uint8_t i_message) {
   }
 }
 
+/*
+ * Serial Link Speed Handlers
+ */
+
+uint32_t baudRateValue(uint8_t i_rate) {
+  switch(i_rate) {
+    case BAUD_RATE_115200:
+      return 115200;
+    break;
+
+    case BAUD_RATE_57600:
+      return 57600;
+    break;
+
+    default:
+      return 9600;
+    break;
+  }
+}
+
+// Returns the fastest rate supported by both ends, or the default if the link should not be upgraded.
+uint8_t baudRateSelect(struct SerialLinkState &link, uint16_t i_supported) {
+  if(link.b_locked || link.i_rate != BAUD_RATE_DEFAULT) {
+    return BAUD_RATE_DEFAULT;
+  }
+
+  i_supported &= i_baud_rates_supported;
+
+  if(i_supported & BAUD_RATE_115200) {
+    return BAUD_RATE_115200;
+  }
+  else if(i_supported & BAUD_RATE_57600) {
+    return BAUD_RATE_57600;
+  }
+
+  return BAUD_RATE_DEFAULT;
+}
+
+// Re-opens a UART at a new rate once anything queued at the old rate has been fully sent.
+void setLinkBaudRate(HardwareSerial &port, SerialTransfer &coms, struct SerialLinkState &link, uint8_t i_rate) {
+  port.flush();
+  port.end();
+  port.begin(baudRateValue(i_rate));
+  coms.reset(); // Discard any partial packet received at the old rate.
+
+  link.i_rate = i_rate;
+  link.i_errors = 0;
+
+  if(i_rate != BAUD_RATE_DEFAULT) {
+    link.ms_confirm.start(i_baud_confirm_delay);
+  }
+  else {
+    link.ms_confirm.stop();
+  }
+}
+
+// A good packet arrived, which confirms any newly selected rate.
+void linkReceived(struct SerialLinkState &link) {
+  link.stats.rxPackets++;
+  link.i_errors = 0;
+  link.ms_confirm.stop();
+  link.b_rx_partial = false;
+}
+
+// Notes whether the last read from a link stopped part-way through a packet, and counts any packet it rejected.
+void linkReceiveProgress(struct SerialLinkState &link, int8_t i_status) {
+  if(i_status == CONTINUE) {
+    link.b_rx_partial = true;
+    link.i_rx_partial_time = micros();
+  }
+  else if(i_status != NO_DATA) {
+    // The packet was either completed or discarded.
+    link.b_rx_partial = false;
+  }
+
+  switch(i_status) {
+    case CRC_ERROR:
+      link.stats.rxCrcErrors++;
+    break;
+
+    case PAYLOAD_ERROR:
+      link.stats.rxPayloadErrors++;
+    break;
+
+    case STOP_BYTE_ERROR:
+      link.stats.rxStopByteErrors++;
+    break;
+
+    case STALE_PACKET_ERROR:
+      link.stats.rxStaleErrors++;
+    break;
+
+    default:
+      // Not an error.
+    break;
+  }
+}
+
+// Returns true while a packet is arriving on either link, when holding off interrupts would drop bytes.
+bool serialReceiveInProgress() {
+  uint32_t i_now = micros();
+
+  if(Serial1.available() > 0 || Serial2.available() > 0) {
+    return true;
+  }
+
+  if(wandLink.b_rx_partial && (i_now - wandLink.i_rx_partial_time) < i_serial_rx_idle_gap) {
+    return true;
+  }
+
+  if(serial1Link.b_rx_partial && (i_now - serial1Link.i_rx_partial_time) < i_serial_rx_idle_gap) {
+    return true;
+  }
+
+  return false;
+}
+
+// Compares the schema hash a device sent while synchronizing against our own (0 means it sent none).
+void linkProtocolCheck(struct SerialLinkState &link, uint16_t i_hash) {
+  if(i_hash == 0) {
+    // Firmware from before the hash was exchanged.
+    link.stats.protocolMatch = 0;
+  }
+  else if(i_hash == i_protocol_hash) {
+    link.stats.protocolMatch = 1;
+  }
+  else {
+    debugln(F("Protocol mismatch: device firmware was built from a different Communication.h"));
+    link.stats.protocolMatch = 2;
+  }
+}
+
+// Returns true when the link is running above 9600 and should give up on the faster rate.
+bool linkSpeedFailed(struct SerialLinkState &link, int8_t i_status) {
+  if(link.i_rate == BAUD_RATE_DEFAULT) {
+    return false;
+  }
+
+  if(i_status <= CRC_ERROR && link.i_errors < 255) {
+    link.i_errors++;
+  }
+
+  return link.i_errors >= i_baud_error_limit || link.ms_confirm.justFinished();
+}
+
+// Returns the wand link to 9600, and optionally refuses any further attempts to upgrade it.
+void wandBaudRateFallback(bool b_lock) {
+  if(wandLink.i_rate != BAUD_RATE_DEFAULT) {
+    debugln(F("Wand link falling back to 9600"));
+    setLinkBaudRate(Serial2, packComs, wandLink, BAUD_RATE_DEFAULT);
+    wandLink.b_locked = wandLink.b_locked || b_lock;
+  }
+}
+
+// Returns the Serial1 link to 9600, and optionally refuses any further attempts to upgrade it.
+void serial1BaudRateFallback(bool b_lock) {
+  if(serial1Link.i_rate != BAUD_RATE_DEFAULT) {
+    debugln(F("Serial1 link falling back to 9600"));
+    setLinkBaudRate(Serial1, serial1Coms, serial1Link, BAUD_RATE_DEFAULT);
+    serial1Link.b_locked = serial1Link.b_locked || b_lock;
+  }
+}
+
 // Forward function declarations.
 void handleSerialCommand(uint8_t i_command, uint16_t i_value);
 void handleWandCommand(uint8_t i_command, uint16_t i_value);
@@ -532,6 +1142,8 @@ void checkSerial1() {
     // debugln(i_packet_id);
 
     if(i_packet_id > 0) {
+      linkReceived(serial1Link);
+
       if(ms_serial1_check.isRunning() && b_serial1_connected) {
         // If the timer is still running and Attenuator is connected, consider any request as proof of life.
         ms_serial1_check.restart();
@@ -546,6 +1158,9 @@ void checkSerial1() {
             debugln(recvCmdS.c);
             handleSerialCommand(recvCmdS.c, recvCmdS.d1);
           }
+          else if(recvCmdS.s != A_COM_START || recvCmdS.e != A_COM_END) {
+            serial1Link.stats.rxBadMarkers++;
+          }
         break;
 
         case PACKET_DATA:
@@ -558,7 +1173,33 @@ void checkSerial1() {
           if(recvDataS.m > 0 && recvDataS.s == A_COM_START && recvDataS.e == A_COM_END) {
             debug(F("Recv. Serial1 Message: "));
             debugln(recvDataS.m);
-            // No handlers at this time.
+
+            switch(recvDataS.m) {
+              case A_MUSIC_PLAYLIST:
+                // The music order chosen on the serial1 device follows the message. An empty order goes back to every track.
+                // A payload which does not hold exactly the number of tracks given is dropped rather than played in part.
+                if(recvDataS.d[0] <= MUSIC_PLAYLIST_SIZE && serial1Coms.bytesRead == sizeof(recvDataS) + recvDataS.d[0] * sizeof(uint16_t)) {
+                  musicPlaylist.clear();
+
+                  for(uint8_t i = 0; i < recvDataS.d[0]; i++) {
+                    uint16_t i_music_track = 0;
+
+                    serial1Coms.rxObj(i_music_track, sizeof(recvDataS) + i * sizeof(uint16_t));
+                    musicPlaylist.add(i_music_track);
+                  }
+                }
+                else {
+                  serial1Link.stats.rxPayloadErrors++;
+                }
+              break;
+
+              default:
+                // No other handlers at this time.
+              break;
+            }
+          }
+          else if(recvDataS.s != A_COM_START || recvDataS.e != A_COM_END) {
+            serial1Link.stats.rxBadMarkers++;
           }
         break;
 
@@ -579,18 +1220,15 @@ void checkSerial1() {
             default:
               SYSTEM_MODE = MODE_SUPER_HERO;
               packSerialSend(P_MODE_SUPER_HERO);
-              serial1Send(A_MODE_SUPER_HERO);
             break;
 
             case 1:
               SYSTEM_MODE = MODE_ORIGINAL;
               packSerialSend(P_MODE_ORIGINAL);
-              serial1Send(A_MODE_ORIGINAL);
 
               if(!b_wand_connected && STREAM_MODE != PROTON) {
                 // If no wand is connected we need to make sure we're in Proton Stream.
                 STREAM_MODE = PROTON;
-                serial1Send(A_PROTON_MODE);
               }
             break;
           }
@@ -621,28 +1259,24 @@ void checkSerial1() {
               SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
               b_switch_mode_override = true; // Explicit mode set, override mode toggle.
               packSerialSend(P_YEAR_1984);
-              serial1Send(A_YEAR_1984);
             break;
             case 3:
               SYSTEM_YEAR = SYSTEM_1989;
               SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
               b_switch_mode_override = true; // Explicit mode set, override mode toggle.
               packSerialSend(P_YEAR_1989);
-              serial1Send(A_YEAR_1989);
             break;
             case 4:
               SYSTEM_YEAR = SYSTEM_AFTERLIFE;
               SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
               b_switch_mode_override = true; // Explicit mode set, override mode toggle.
               packSerialSend(P_YEAR_AFTERLIFE);
-              serial1Send(A_YEAR_AFTERLIFE);
             break;
             case 5:
               SYSTEM_YEAR = SYSTEM_FROZEN_EMPIRE;
               SYSTEM_YEAR_TEMP = SYSTEM_YEAR;
               b_switch_mode_override = true; // Explicit mode set, override mode toggle.
               packSerialSend(P_YEAR_FROZEN_EMPIRE);
-              serial1Send(A_YEAR_FROZEN_EMPIRE);
             break;
           }
 
@@ -836,6 +1470,13 @@ void checkSerial1() {
       }
     }
   }
+  else {
+    linkReceiveProgress(serial1Link, serial1Coms.status);
+
+    if(linkSpeedFailed(serial1Link, serial1Coms.status)) {
+      serial1BaudRateFallback(true);
+    }
+  }
 }
 
 void doSerial1Sync() {
@@ -852,6 +1493,65 @@ void doSerial1Sync() {
   debugln(F("Serial1 Sync Start"));
   serial1Send(A_SYNC_START);
 
+  updateAttenuatorSyncData();
+  serial1SendData(A_SYNC_DATA);
+
+  // Any deltas from here on are relative to the full state just sent.
+  attenuatorSyncSent = attenuatorSyncData;
+
+  // Send the ribbon cable alarm status if the ribbon cable is detached.
+  if(b_alarm && ribbonCableAttached() != true) {
+    serial1Send(A_ALARM_ON);
+  }
+
+  serial1Send(A_SYNC_END, i_protocol_hash);
+  debugln(F("Serial1 Sync End"));
+}
+
+// Sends only the AttenuatorSyncData fields which changed since the last sync or delta, as a single packet.
+void serial1SendSyncDelta() {
+  uint16_t i_send_size = 0;
+  uint8_t i_length = 0;
+  uint8_t i_offset = 0;
+  uint8_t *p_current = (uint8_t *) &attenuatorSyncData;
+  uint8_t *p_sent = (uint8_t *) &attenuatorSyncSent;
+
+  updateAttenuatorSyncData();
+
+  syncDelta.fields = 0;
+
+  for(uint8_t i = 0; i < SYNC_FIELD_COUNT; i++) {
+    uint8_t i_size = pgm_read_byte(&i_sync_field_sizes[i]);
+
+    if(memcmp(p_current + i_offset, p_sent + i_offset, i_size) != 0) {
+      syncDelta.fields |= (1UL << i);
+      memcpy(syncDelta.d + i_length, p_current + i_offset, i_size);
+      i_length += i_size;
+    }
+
+    i_offset += i_size;
+  }
+
+  if(syncDelta.fields != 0) {
+    i_send_size = serial1Coms.txObj(syncDelta, 0, sizeof(syncDelta.fields) + i_length);
+    linkSendData(serial1Coms, i_send_size, (uint8_t) PACKET_SYNC_DELTA);
+
+    attenuatorSyncSent = attenuatorSyncData;
+  }
+}
+
+// The wand left its settings menu by reporting its stream mode again.
+// The Serial1 device only leaves its settings screen when told a stream mode, which the next sync delta would skip if
+// the mode did not change, so forget the one last sent.
+void wandSettingsExit() {
+  playEffect(S_CLICK);
+  b_settings = false;
+
+  attenuatorSyncSent.streamMode = 0;
+}
+
+// Gathers the current pack and wand state into the AttenuatorSyncData struct.
+void updateAttenuatorSyncData() {
   // Tell the serial1 device about the wand status.
   attenuatorSyncData.wandPresent = b_wand_connected ? 1 : 0;
   attenuatorSyncData.barrelExtended = b_neutrona_wand_barrel_extended ? 1 : 0;
@@ -916,6 +1616,12 @@ void doSerial1Sync() {
     break;
   }
 
+  if(b_pack_started_by_meter) {
+    // A stock wand cannot report its settings, so present a full-power proton stream instead.
+    attenuatorSyncData.powerLevel = 5;
+    attenuatorSyncData.streamMode = 1;
+  }
+
   // Current spectral custom colour for outer cyclotron.
   attenuatorSyncData.spectralColour = i_spectral_cyclotron_custom_colour;
   attenuatorSyncData.spectralSaturation = i_spectral_cyclotron_custom_saturation;
@@ -929,22 +1635,13 @@ void doSerial1Sync() {
   attenuatorSyncData.musicPlaying = b_playing_music ? 1 : 0;
   attenuatorSyncData.musicPaused = b_music_paused ? 1 : 0;
   attenuatorSyncData.trackLooped = b_repeat_track ? 2 : 1;
+  attenuatorSyncData.musicShuffled = musicPlaylist.isShuffled() ? 2 : 1;
   attenuatorSyncData.currentTrack = i_current_music_track;
   attenuatorSyncData.musicCount = i_music_count;
   attenuatorSyncData.masterMuted = (i_volume_master == i_volume_abs_min) ? 2 : 1;
   attenuatorSyncData.masterVolume = i_volume_master_percentage;
   attenuatorSyncData.effectsVolume = i_volume_effects_percentage;
   attenuatorSyncData.musicVolume = i_volume_music_percentage;
-
-  serial1SendData(A_SYNC_DATA);
-
-  // Send the ribbon cable alarm status if the ribbon cable is detached.
-  if(b_alarm && ribbonCableAttached() != true) {
-    serial1Send(A_ALARM_ON);
-  }
-
-  serial1Send(A_SYNC_END);
-  debugln(F("Serial1 Sync End"));
 }
 
 void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
@@ -970,10 +1667,24 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
         // While in diagnostic mode, play a sound to indicate the wand is connected.
         playEffect(S_BEEPS_ALT);
       }
+
+      if(serial1Link.i_rate == BAUD_RATE_DEFAULT) {
+        // The handshake value lists any faster rates the Attenuator supports.
+        uint8_t i_rate = baudRateSelect(serial1Link, i_value);
+
+        if(i_rate != BAUD_RATE_DEFAULT) {
+          debug(F("Serial1 link switching to "));
+          debugln(baudRateValue(i_rate));
+          serial1Send(A_HANDSHAKE, i_rate);
+          serial1Flush(); // The selected rate must go out before the switch.
+          setLinkBaudRate(Serial1, serial1Coms, serial1Link, i_rate);
+        }
+      }
     break;
 
     case A_SYNC_END:
       debugln(F("Serial1 Synchronized"));
+      linkProtocolCheck(serial1Link, i_value);
       b_serial1_syncing = false;
       b_serial1_connected = true;
       ms_serial1_check.start(i_serial1_disconnect_delay);
@@ -989,9 +1700,6 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
       if(b_wand_connected) {
         packSerialSend(P_ION_ARM_SWITCH_ON);
       }
-
-      // Tell the Attenuator or any other device that the power to the Proton Pack is on.
-      serial1Send(A_ION_ARM_SWITCH_ON);
     break;
 
     case A_TURN_PACK_OFF:
@@ -1007,9 +1715,6 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
       if(b_wand_connected) {
         packSerialSend(P_ION_ARM_SWITCH_OFF);
       }
-
-      // Tell the Attenuator or any other device that the power to the Proton Pack is off.
-      serial1Send(A_ION_ARM_SWITCH_OFF);
     break;
 
     case A_WARNING_CANCELLED:
@@ -1053,7 +1758,6 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
         i_volume_master = i_volume_revert;
 
         packSerialSend(P_MASTER_AUDIO_NORMAL);
-        serial1Send(A_TOGGLE_MUTE, 1);
       }
       else {
         i_volume_revert = i_volume_master;
@@ -1062,7 +1766,6 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
         i_volume_master = i_volume_abs_min;
 
         packSerialSend(P_MASTER_AUDIO_SILENT_MODE);
-        serial1Send(A_TOGGLE_MUTE, 2);
       }
 
       updateMasterVolume();
@@ -1143,7 +1846,10 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
 
     case A_MUSIC_TRACK_LOOP_TOGGLE:
       toggleMusicLoop();
-      serial1Send(A_MUSIC_TRACK_LOOP_TOGGLE, b_repeat_track ? 2 : 1);
+    break;
+
+    case A_MUSIC_SHUFFLE_TOGGLE:
+      toggleMusicShuffle();
     break;
 
     case A_REQUEST_PREFERENCES_PACK:
@@ -1215,6 +1921,67 @@ void handleSerialCommand(uint8_t i_command, uint16_t i_value) {
   }
 }
 
+// Handles a packet from the wand whose contents begin at the given offset (after the header of a reliable frame).
+void handleWandPacket(uint8_t i_packet_id, uint16_t i_offset) {
+  switch(i_packet_id) {
+    case PACKET_COMMAND:
+      packComs.rxObj(recvCmdW, i_offset);
+      if(recvCmdW.c > 0 && recvCmdW.s == W_COM_START && recvCmdW.e == W_COM_END) {
+        debug(F("Recv. Wand Command: "));
+        debugln(recvCmdW.c);
+        handleWandCommand(recvCmdW.c, recvCmdW.d1);
+      }
+      else if(recvCmdW.s != W_COM_START || recvCmdW.e != W_COM_END) {
+        wandLink.stats.rxBadMarkers++;
+      }
+    break;
+
+    case PACKET_DATA:
+      if(!b_wand_connected) {
+        // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
+        return;
+      }
+
+      packComs.rxObj(recvDataW, i_offset);
+      if(recvDataW.m > 0 && recvDataW.s == W_COM_START && recvDataW.e == W_COM_END) {
+        debug(F("Recv. Wand Data: "));
+        debugln(recvDataW.m);
+        // No handlers at this time.
+      }
+      else if(recvDataW.s != W_COM_START || recvDataW.e != W_COM_END) {
+        wandLink.stats.rxBadMarkers++;
+      }
+    break;
+
+    case PACKET_WAND:
+      if(!b_wand_connected) {
+        // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
+        return;
+      }
+
+      packComs.rxObj(wandConfig, i_offset);
+      debugln(F("Recv. Wand Config Prefs"));
+
+      // Send the EEPROM preferences just returned by the wand.
+      serial1SendData(A_SEND_PREFERENCES_WAND);
+    break;
+
+    case PACKET_SMOKE:
+      if(!b_wand_connected) {
+        // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
+        return;
+      }
+
+      packComs.rxObj(smokeConfig, i_offset);
+      debugln(F("Recv. Wand Smoke Prefs"));
+
+      // Send the EEPROM preferences just returned by the wand.
+      // This data will combine with the pack's smoke settings.
+      serial1SendData(A_SEND_PREFERENCES_SMOKE);
+    break;
+  }
+}
+
 // Incoming messages from the wand.
 void checkWand() {
   if(packComs.available() > 0) {
@@ -1223,6 +1990,8 @@ void checkWand() {
     // debugln(i_packet_id);
 
     if(i_packet_id > 0) {
+      linkReceived(wandLink);
+
       if(ms_wand_check.isRunning() && b_wand_connected) {
         // If the timer is still running and wand is connected, consider any request as proof of life.
         ms_wand_check.restart();
@@ -1230,58 +1999,38 @@ void checkWand() {
 
       // Determine the type of packet which was sent by the wand device.
       switch(i_packet_id) {
-        case PACKET_COMMAND:
-          packComs.rxObj(recvCmdW);
-          if(recvCmdW.c > 0 && recvCmdW.s == W_COM_START && recvCmdW.e == W_COM_END) {
-            debug(F("Recv. Wand Command: "));
-            debugln(recvCmdW.c);
-            handleWandCommand(recvCmdW.c, recvCmdW.d1);
-          }
-        break;
+        case PACKET_RELIABLE:
+        {
+          struct ReliableHeader header;
+          packComs.rxObj(header);
 
-        case PACKET_DATA:
-          if(!b_wand_connected) {
-            // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
-            return;
-          }
-
-          packComs.rxObj(recvDataW);
-          if(recvDataW.m > 0 && recvDataW.s == W_COM_START && recvDataW.e == W_COM_END) {
-            debug(F("Recv. Wand Data: "));
-            debugln(recvDataW.m);
-            // No handlers at this time.
+          if(reliableReceived(packComs, wandReliable, header.seq)) {
+            handleWandPacket(header.type, sizeof(header));
           }
+        }
         break;
 
-        case PACKET_WAND:
-          if(!b_wand_connected) {
-            // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
-            return;
-          }
-
-          packComs.rxObj(wandConfig);
-          debugln(F("Recv. Wand Config Prefs"));
-
-          // Send the EEPROM preferences just returned by the wand.
-          serial1SendData(A_SEND_PREFERENCES_WAND);
+        case PACKET_ACK:
+        {
+          uint8_t i_seq = 0;
+          packComs.rxObj(i_seq);
+          reliableAcknowledged(packComs, wandReliable, i_seq);
+        }
         break;
 
-        case PACKET_SMOKE:
-          if(!b_wand_connected) {
-            // Can't proceed if the wand isn't connected; prevents phantom actions from occurring.
-            return;
-          }
-
-          packComs.rxObj(smokeConfig);
-          debugln(F("Recv. Wand Smoke Prefs"));
-
-          // Send the EEPROM preferences just returned by the wand.
-          // This data will combine with the pack's smoke settings.
-          serial1SendData(A_SEND_PREFERENCES_SMOKE);
+        default:
+          handleWandPacket(i_packet_id, 0);
         break;
       }
     }
   }
+  else {
+    linkReceiveProgress(wandLink, packComs.status);
+
+    if(linkSpeedFailed(wandLink, packComs.status)) {
+      wandBaudRateFallback(true);
+    }
+  }
 }
 
 // Performs the synchronization of pack settings to a connected wand.
@@ -1292,6 +2041,9 @@ void doWandSync() {
   b_wand_connected = false;
   ms_wand_check.stop();
 
+  // Anything still awaiting acknowledgement belongs to the previous connection.
+  reliableReset(wandReliable);
+
   if(b_diagnostic) {
     // While in diagnostic mode, play a sound to indicate the wand is being synchronized.
     playEffect(S_BEEPS);
@@ -1429,8 +2181,8 @@ void doWandSync() {
     packSerialSend(P_ALARM_ON);
   }
 
-  // Tell the wand that we've reached the end of settings to be sync'd.
-  packSerialSend(P_SYNC_END);
+  // Tell the wand that we've reached the end of settings to be sync'd, and that we accept reliable frames.
+  packSerialSend(P_SYNC_END, i_link_reliable_supported);
   debugln(F("Wand Sync End"));
 }
 
@@ -1457,21 +2209,40 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       b_wand_syncing = false; // No longer attempting to force a sync w/ wand.
       b_wand_connected = true; // If we're receiving handshake instead of SYNC_NOW we must be connected
 
-      // Tell the serial1 device the wand is still connected.
-      serial1Send(A_WAND_CONNECTED);
-
       if(b_diagnostic == true) {
         // While in diagnostic mode, play a sound to indicate the wand is connected.
         playEffect(S_BEEPS);
       }
+
+      if(i_value & i_link_reliable_supported) {
+        // The wand accepts reliable frames, so critical commands may now use them.
+        wandReliable.b_peer_ready = true;
+      }
+
+      if(wandLink.i_rate != BAUD_RATE_DEFAULT) {
+        // Echo the active rate so the wand knows we can still hear it; this does not prompt another handshake.
+        packSerialSend(P_HANDSHAKE, wandLink.i_rate);
+      }
+      else {
+        // The handshake value lists any faster rates the wand supports.
+        uint8_t i_rate = baudRateSelect(wandLink, i_value);
+
+        if(i_rate != BAUD_RATE_DEFAULT) {
+          debug(F("Wand link switching to "));
+          debugln(baudRateValue(i_rate));
+          packSerialSend(P_HANDSHAKE, i_rate);
+          packSerialFlush(); // The selected rate must go out before the switch.
+          setLinkBaudRate(Serial2, packComs, wandLink, i_rate);
+        }
+      }
     break;
 
     case W_SYNCHRONIZED:
       debugln(F("Wand Synchronized"));
+      linkProtocolCheck(wandLink, i_value);
       b_wand_syncing = false; // Stop trying to sync since we've successfully synchronized.
       b_wand_connected = true; // Wand sent sync confirmation, so it must be connected.
       ms_wand_check.start(i_wand_disconnect_delay); // Wand is synchronized, so start the keep-alive timer.
-      serial1Send(A_WAND_CONNECTED); // Tell the serial1 device the wand is (re-)connected.
     break;
 
     case W_ON:
@@ -1504,17 +2275,11 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
     case W_BARREL_EXTENDED:
       // Remember the last state sent from the wand (for re-sync with the Serial1 device).
       b_neutrona_wand_barrel_extended = true;
-
-      // Tell the serial1 device that the Neutrona Wand barrel is extended.
-      serial1Send(A_BARREL_EXTENDED);
     break;
 
     case W_BARREL_RETRACTED:
       // Remember the last state sent from the wand (for re-sync with the Serial1 device).
       b_neutrona_wand_barrel_extended = false;
-
-      // Tell the serial1 device that the Neutrona Wand barrel is retracted.
-      serial1Send(A_BARREL_RETRACTED);
     break;
 
     case W_BARGRAPH_OVERHEAT_BLINK_ENABLED:
@@ -1877,8 +2642,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = PROTON;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -1894,8 +2658,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_PROTON_MODE);
     break;
 
     case W_SLIME_MODE:
@@ -1922,8 +2684,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = SLIME;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -1943,8 +2704,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_SLIME_MODE);
     break;
 
     case W_STASIS_MODE:
@@ -1977,8 +2736,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = STASIS;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -1994,8 +2752,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_STASIS_MODE);
     break;
 
     case W_MESON_MODE:
@@ -2023,8 +2779,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = MESON;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(AUDIO_DEVICE == A_GPSTAR_AUDIO || AUDIO_DEVICE == A_GPSTAR_AUDIO_ADV) {
@@ -2045,8 +2800,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_MESON_MODE);
     break;
 
     case W_SPECTRAL_MODE:
@@ -2078,8 +2831,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = SPECTRAL;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -2095,8 +2847,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_SPECTRAL_MODE);
     break;
 
     case W_HALLOWEEN_MODE:
@@ -2128,8 +2878,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = HOLIDAY_HALLOWEEN;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -2145,8 +2894,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_HALLOWEEN_MODE, i_value);
     break;
 
     case W_CHRISTMAS_MODE:
@@ -2178,8 +2925,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = HOLIDAY_CHRISTMAS;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -2195,8 +2941,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
       // Update the Inner Cyclotron LEDs if required.
       cyclotronSwitchLEDUpdate();
-
-      serial1Send(A_CHRISTMAS_MODE, i_value);
     break;
 
     case W_SPECTRAL_CUSTOM_MODE:
@@ -2228,8 +2972,7 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
       STREAM_MODE = SPECTRAL_CUSTOM;
 
       if(b_settings) {
-        playEffect(S_CLICK);
-        b_settings = false;
+        wandSettingsExit();
       }
 
       if(b_cyclotron_colour_toggle == true) {
@@ -2373,8 +3116,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
           ms_cyclotron_auto_speed_timer.start(i_cyclotron_auto_speed_timer_length / i_wand_power_level);
         }
       }
-
-      serial1Send(A_POWER_LEVEL_1);
     break;
 
     case W_POWER_LEVEL_2:
@@ -2391,8 +3132,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
           ms_cyclotron_auto_speed_timer.start(i_cyclotron_auto_speed_timer_length / i_wand_power_level);
         }
       }
-
-      serial1Send(A_POWER_LEVEL_2);
     break;
 
     case W_POWER_LEVEL_3:
@@ -2409,8 +3148,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
           ms_cyclotron_auto_speed_timer.start(i_cyclotron_auto_speed_timer_length / i_wand_power_level);
         }
       }
-
-      serial1Send(A_POWER_LEVEL_3);
     break;
 
     case W_POWER_LEVEL_4:
@@ -2427,8 +3164,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
           ms_cyclotron_auto_speed_timer.start(i_cyclotron_auto_speed_timer_length / i_wand_power_level);
         }
       }
-
-      serial1Send(A_POWER_LEVEL_4);
     break;
 
     case W_POWER_LEVEL_5:
@@ -2446,8 +3181,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
           ms_cyclotron_auto_speed_timer.start(i_cyclotron_auto_speed_timer_length / i_wand_power_level);
         }
       }
-
-      serial1Send(A_POWER_LEVEL_5);
     break;
 
     case W_OVERHEAT_INCREASE_LEVEL_1:
@@ -3227,24 +3960,17 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
     case W_MUSIC_TRACK_LOOP_TOGGLE:
       toggleMusicLoop();
-      serial1Send(A_MUSIC_TRACK_LOOP_TOGGLE, b_repeat_track ? 2 : 1);
     break;
 
     case W_TOGGLE_MUTE:
       if(i_volume_master == i_volume_abs_min) {
         i_volume_master = i_volume_revert;
-
-        // Notify the Attenuator we are unmuted.
-        serial1Send(A_TOGGLE_MUTE, 1);
       }
       else {
         i_volume_revert = i_volume_master;
 
         // Set the master volume to minimum.
         i_volume_master = i_volume_abs_min;
-
-        // Notify the Attenuator we are muted.
-        serial1Send(A_TOGGLE_MUTE, 2);
       }
 
       updateMasterVolume();
@@ -3448,7 +4174,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
           packSerialSend(P_SOUND_SUPER_HERO);
           packSerialSend(P_MODE_SUPER_HERO);
-          serial1Send(A_MODE_SUPER_HERO);
         break;
 
         case MODE_SUPER_HERO:
@@ -3461,7 +4186,6 @@ void handleWandCommand(uint8_t i_command, uint16_t i_value) {
 
           packSerialSend(P_SOUND_MODE_ORIGINAL);
           packSerialSend(P_MODE_ORIGINAL);
-          serial1Send(A_MODE_ORIGINAL);
         break;
       }
     break;
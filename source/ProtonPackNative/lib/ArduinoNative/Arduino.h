@@ -0,0 +1,230 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native replacement for the Arduino AVR core.
+ * Provides just enough of the Mega 2560 environment (timing, GPIO, hardware serial ports and the few
+ * registers touched directly by the firmware) for the Proton Pack sketch to compile and run on a workstation.
+ * Time is simulated and only advances when the harness (or a call to delay()) says so, which keeps every
+ * run of the sketch deterministic. See SimHarness.h for the hooks used to drive the simulation.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+
+// Program memory is ordinary memory on the host.
+#define PROGMEM
+#define pgm_read_byte_near(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word_near(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword_near(addr) (*(const uint32_t *)(addr))
+#define pgm_read_byte(addr) pgm_read_byte_near(addr)
+#define pgm_read_word(addr) pgm_read_word_near(addr)
+#define pgm_read_dword(addr) pgm_read_dword_near(addr)
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+#define strcpy_P(dest, src) strcpy((dest), (src))
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// Binary constants (subset of binary.h) used by the sketches.
+#define B00000100 4
+#define B11111000 248
+
+#define _BV(bit) (1 << (bit))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define interrupts()
+#define noInterrupts()
+#define sei()
+#define cli()
+
+/*
+ * Timing
+ */
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+/*
+ * GPIO
+ */
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+int analogRead(uint8_t pin);
+
+/*
+ * Math helpers
+ */
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+/*
+ * ATmega2560 registers used directly by the firmware.
+ */
+#define REFS1 7
+#define REFS0 6
+#define ADLAR 5
+#define MUX4 4
+#define MUX3 3
+#define MUX2 2
+#define MUX1 1
+#define MUX0 0
+#define MUX5 3
+#define ADEN 7
+#define ADSC 6
+#define ADATE 5
+#define ADIF 4
+#define ADIE 3
+#define ADPS2 2
+#define ADPS1 1
+#define ADPS0 0
+#define ADTS2 2
+#define ADTS1 1
+#define ADTS0 0
+
+// Conversions complete instantly, so the start bit never reads back as set.
+struct SimAdcControlRegister {
+  uint8_t value = 0;
+  operator uint8_t() const { return value; }
+  SimAdcControlRegister& operator=(uint8_t v) { value = v & ~_BV(ADSC); return *this; }
+  SimAdcControlRegister& operator|=(uint8_t v) { return *this = (value | v); }
+  SimAdcControlRegister& operator&=(uint8_t v) { return *this = (value & v); }
+};
+
+extern uint8_t TCCR5B;
+extern uint8_t ADMUX;
+extern uint8_t ADCSRB;
+extern SimAdcControlRegister ADCSRA;
+extern uint16_t ADC;
+
+/*
+ * Interrupt handlers. A sketch's ISR(ADC_vect) is called once per Timer0 overflow (1024us of simulated time)
+ * while ADCSRA has auto-triggering and the conversion complete interrupt enabled.
+ */
+#define ISR(vector) void vector()
+void ADC_vect() __attribute__((weak));
+
+/*
+ * Print/Stream/HardwareSerial
+ */
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str) { return str == nullptr ? 0 : write((const uint8_t *) str, strlen(str)); }
+
+    size_t print(const __FlashStringHelper *ifsh) { return write(reinterpret_cast<const char *>(ifsh)); }
+    size_t print(const char str[]) { return write(str); }
+    size_t print(char c) { return write((uint8_t) c); }
+    size_t print(unsigned char n, int base = DEC) { return print((unsigned long) n, base); }
+    size_t print(int n, int base = DEC) { return print((long) n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long) n, base); }
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println() { return write("\r\n"); }
+    template<typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template<typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+};
+
+class HardwareSerial : public Stream {
+  public:
+    explicit HardwareSerial(uint8_t port) : port(port) {}
+
+    void begin(unsigned long baud);
+    void end();
+    unsigned long baudRate() const { return baud; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override {}
+    int availableForWrite() { return 64; }
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+    operator bool() const { return true; }
+
+    const uint8_t port;
+
+  private:
+    unsigned long baud = 0;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
+
+/*
+ * Entry points provided by the sketch.
+ */
+void setup();
+void loop();
@@ -0,0 +1,355 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+
+#include "SimHarness.h"
+
+/*
+ * Simulated clock
+ */
+static unsigned long long i_sim_us = 0;
+static double f_cpu_scale = 0;
+static unsigned long long i_host_sync_ns = 0;
+
+static void runAdcInterrupts();
+
+unsigned long long simHostNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Fold host execution time since the last sync into the simulated clock.
+static void syncHostTime() {
+  unsigned long long i_now = simHostNanos();
+
+  if(f_cpu_scale > 0 && i_host_sync_ns > 0) {
+    i_sim_us += (unsigned long long) (((i_now - i_host_sync_ns) * f_cpu_scale) / 1000.0);
+  }
+
+  i_host_sync_ns = i_now;
+}
+
+void simAdvanceMicros(unsigned long us) {
+  syncHostTime();
+  i_sim_us += us;
+  runAdcInterrupts();
+}
+
+void simSetCpuScale(double scale) {
+  f_cpu_scale = scale;
+  i_host_sync_ns = simHostNanos();
+}
+
+unsigned long millis() {
+  syncHostTime();
+  return (unsigned long) (i_sim_us / 1000);
+}
+
+unsigned long micros() {
+  syncHostTime();
+  return (unsigned long) i_sim_us;
+}
+
+void delay(unsigned long ms) {
+  simAdvanceMicros(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  simAdvanceMicros(us);
+}
+
+/*
+ * GPIO
+ */
+static uint8_t i_pin_input[SIM_PIN_COUNT];
+static uint8_t i_pin_output[SIM_PIN_COUNT];
+static int i_pin_analog[SIM_PIN_COUNT];
+static bool b_pins_ready = false;
+
+static void initPins() {
+  if(!b_pins_ready) {
+    memset(i_pin_input, HIGH, sizeof(i_pin_input));
+    memset(i_pin_output, LOW, sizeof(i_pin_output));
+    memset(i_pin_analog, 0, sizeof(i_pin_analog));
+    b_pins_ready = true;
+  }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void) pin;
+  (void) mode;
+  initPins();
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  initPins();
+
+  if(pin < SIM_PIN_COUNT) {
+    i_pin_output[pin] = val ? HIGH : LOW;
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  initPins();
+  return pin < SIM_PIN_COUNT ? i_pin_input[pin] : LOW;
+}
+
+void analogWrite(uint8_t pin, int val) {
+  initPins();
+
+  if(pin < SIM_PIN_COUNT) {
+    i_pin_analog[pin] = val;
+  }
+}
+
+int analogRead(uint8_t pin) {
+  (void) pin;
+  return 512;
+}
+
+void simSetPinInput(uint8_t pin, uint8_t value) {
+  initPins();
+
+  if(pin < SIM_PIN_COUNT) {
+    i_pin_input[pin] = value ? HIGH : LOW;
+  }
+}
+
+uint8_t simGetPinOutput(uint8_t pin) {
+  initPins();
+  return pin < SIM_PIN_COUNT ? i_pin_output[pin] : LOW;
+}
+
+int simGetPinAnalog(uint8_t pin) {
+  initPins();
+  return pin < SIM_PIN_COUNT ? i_pin_analog[pin] : 0;
+}
+
+/*
+ * Math helpers (fixed seed so every run is repeatable)
+ */
+static unsigned long i_random_state = 1;
+
+void randomSeed(unsigned long seed) {
+  if(seed != 0) {
+    i_random_state = seed;
+  }
+}
+
+long random(long howbig) {
+  if(howbig == 0) {
+    return 0;
+  }
+
+  i_random_state = i_random_state * 1103515245UL + 12345UL;
+  return (long) ((i_random_state >> 16) % (unsigned long) howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if(howsmall >= howbig) {
+    return howsmall;
+  }
+
+  return random(howbig - howsmall) + howsmall;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+/*
+ * Registers
+ */
+uint8_t TCCR5B = 0;
+uint8_t ADMUX = 0;
+uint8_t ADCSRB = 0;
+SimAdcControlRegister ADCSRA;
+uint16_t ADC = 228; // Bandgap reading equivalent to ~5.0V Vcc.
+
+static const unsigned long i_adc_trigger_us = 1024; // Timer0 overflow period on a 16MHz Mega.
+static unsigned long long i_adc_next_us = 0;
+
+static void runAdcInterrupts() {
+  const uint8_t i_auto = _BV(ADEN) | _BV(ADATE) | _BV(ADIE);
+
+  if(ADC_vect == nullptr || (ADCSRA & i_auto) != i_auto) {
+    i_adc_next_us = i_sim_us + i_adc_trigger_us;
+    return;
+  }
+
+  // After a long delay, only the most recent conversions matter.
+  if(i_sim_us > i_adc_next_us + 64 * i_adc_trigger_us) {
+    i_adc_next_us = i_sim_us - 64 * i_adc_trigger_us;
+  }
+
+  while(i_adc_next_us <= i_sim_us) {
+    ADC_vect();
+    i_adc_next_us += i_adc_trigger_us;
+  }
+}
+
+/*
+ * Print
+ */
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+
+  while(size--) {
+    n += write(*buffer++);
+  }
+
+  return n;
+}
+
+size_t Print::print(long n, int base) {
+  if(n < 0 && base == DEC) {
+    return print('-') + print((unsigned long) -n, base);
+  }
+
+  return print((unsigned long) n, base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  char buf[8 * sizeof(long) + 1];
+  char *str = &buf[sizeof(buf) - 1];
+
+  if(base < 2) {
+    base = 10;
+  }
+
+  *str = '\0';
+
+  do {
+    char c = n % base;
+    n /= base;
+    *--str = c < 10 ? c + '0' : c + 'A' - 10;
+  } while(n);
+
+  return write(str);
+}
+
+size_t Print::print(double n, int digits) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+/*
+ * Hardware serial ports
+ */
+struct SimSerialPort {
+  std::deque<uint8_t> rx;
+  std::deque<uint8_t> tx;
+  SimSerialStats stats;
+  bool echo = false;
+};
+
+static SimSerialPort sim_ports[SIM_SERIAL_PORTS];
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+HardwareSerial Serial3(3);
+
+void HardwareSerial::begin(unsigned long baud) {
+  this->baud = baud;
+
+  if(port == 0) {
+    sim_ports[port].echo = true;
+  }
+}
+
+void HardwareSerial::end() {
+  baud = 0;
+}
+
+int HardwareSerial::available() {
+  return (int) sim_ports[port].rx.size();
+}
+
+int HardwareSerial::read() {
+  SimSerialPort &p = sim_ports[port];
+
+  if(p.rx.empty()) {
+    return -1;
+  }
+
+  uint8_t c = p.rx.front();
+  p.rx.pop_front();
+  p.stats.bytesRead++;
+
+  return c;
+}
+
+int HardwareSerial::peek() {
+  SimSerialPort &p = sim_ports[port];
+  return p.rx.empty() ? -1 : p.rx.front();
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  SimSerialPort &p = sim_ports[port];
+
+  p.stats.bytesWritten++;
+
+  if(p.echo) {
+    fputc(c, stdout);
+  }
+  else {
+    p.tx.push_back(c);
+  }
+
+  return 1;
+}
+
+void simSerialInject(uint8_t port, const uint8_t *data, size_t len) {
+  if(port < SIM_SERIAL_PORTS) {
+    sim_ports[port].rx.insert(sim_ports[port].rx.end(), data, data + len);
+  }
+}
+
+size_t simSerialDrain(uint8_t port, uint8_t *data, size_t maxLen) {
+  size_t n = 0;
+
+  if(port < SIM_SERIAL_PORTS) {
+    SimSerialPort &p = sim_ports[port];
+
+    while(!p.tx.empty() && (data == nullptr || n < maxLen)) {
+      if(data != nullptr) {
+        data[n] = p.tx.front();
+      }
+
+      p.tx.pop_front();
+      n++;
+    }
+  }
+
+  return n;
+}
+
+void simSerialEcho(uint8_t port, bool echo) {
+  if(port < SIM_SERIAL_PORTS) {
+    sim_ports[port].echo = echo;
+  }
+}
+
+const SimSerialStats& simSerialStats(uint8_t port) {
+  return sim_ports[port < SIM_SERIAL_PORTS ? port : 0].stats;
+}
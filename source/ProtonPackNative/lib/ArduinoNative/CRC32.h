@@ -0,0 +1,54 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the CRC32 library by Christopher Baker (same polynomial and API).
+ */
+
+#include <Arduino.h>
+
+class CRC32 {
+  public:
+    CRC32() { reset(); }
+
+    void reset() { state = ~0L; }
+
+    void update(const uint8_t &data) {
+      state ^= data;
+
+      for(uint8_t i = 0; i < 8; i++) {
+        state = (state >> 1) ^ (-(int32_t) (state & 1) & 0xEDB88320);
+      }
+    }
+
+    template<typename Type> void update(const Type &data) {
+      const uint8_t *ptr = (const uint8_t *) &data;
+
+      for(size_t i = 0; i < sizeof(Type); i++) {
+        update(ptr[i]);
+      }
+    }
+
+    uint32_t finalize() const { return ~state; }
+
+  private:
+    uint32_t state;
+};
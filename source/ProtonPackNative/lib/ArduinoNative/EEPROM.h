@@ -0,0 +1,61 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the AVR EEPROM library, backed by a 4KB array which starts erased (0xFF).
+ */
+
+#include <Arduino.h>
+
+#define SIM_EEPROM_SIZE 4096
+
+class EEPROMClass {
+  public:
+    EEPROMClass() { memset(data, 0xFF, sizeof(data)); }
+
+    uint8_t read(int idx) { return data[idx % SIM_EEPROM_SIZE]; }
+    void write(int idx, uint8_t val) { data[idx % SIM_EEPROM_SIZE] = val; writes++; }
+    void update(int idx, uint8_t val) { if(read(idx) != val) { write(idx, val); } }
+    uint16_t length() { return SIM_EEPROM_SIZE; }
+    uint8_t& operator[](int idx) { return data[idx % SIM_EEPROM_SIZE]; }
+
+    template<typename T> T& get(int idx, T &t) {
+      memcpy((void *) &t, &data[idx], sizeof(T));
+      return t;
+    }
+
+    template<typename T> const T& put(int idx, const T &t) {
+      const uint8_t *ptr = (const uint8_t *) &t;
+
+      for(size_t i = 0; i < sizeof(T); i++) {
+        update(idx + i, ptr[i]);
+      }
+
+      return t;
+    }
+
+    unsigned long writes = 0; // Number of cells actually written (wear indicator).
+
+  private:
+    uint8_t data[SIM_EEPROM_SIZE];
+};
+
+extern EEPROMClass EEPROM;
@@ -0,0 +1,168 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the FastLED library.
+ * Colour maths (CRGB/CHSV, scale8, hsv2rgb_rainbow) follows the real library so the sketch produces the same
+ * pixel values. Writing out to the LED chain is simulated: show() just accounts for the pixels and the time
+ * the data line would hold interrupts off on a WS281x chain (~30us per LED).
+ */
+
+#include <Arduino.h>
+
+#define SIM_FASTLED_US_PER_LED 30
+
+typedef uint8_t fract8;
+
+inline uint8_t scale8(uint8_t i, fract8 scale) { return ((uint16_t) i * (1 + (uint16_t) scale)) >> 8; }
+inline uint8_t scale8_video(uint8_t i, fract8 scale) { return (((int) i * (int) scale) >> 8) + ((i && scale) ? 1 : 0); }
+inline uint8_t qadd8(uint8_t i, uint8_t j) { unsigned int t = i + j; return t > 255 ? 255 : t; }
+inline uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+
+struct CHSV {
+  union {
+    struct {
+      uint8_t hue;
+      uint8_t sat;
+      uint8_t val;
+    };
+    uint8_t raw[3];
+  };
+
+  CHSV() : hue(0), sat(0), val(0) {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : hue(ih), sat(is), val(iv) {}
+};
+
+struct CRGB {
+  union {
+    struct {
+      uint8_t r;
+      uint8_t g;
+      uint8_t b;
+    };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode { Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000, Blue = 0x0000FF };
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+  CRGB(HTMLColorCode colorcode) : CRGB((uint32_t) colorcode) {}
+  CRGB(const CHSV& rhs);
+
+  uint8_t& operator[](uint8_t x) { return raw[x]; }
+  const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+
+  CRGB& nscale8(uint8_t scaledown) {
+    r = scale8(r, scaledown);
+    g = scale8(g, scaledown);
+    b = scale8(b, scaledown);
+    return *this;
+  }
+
+  CRGB& fadeToBlackBy(uint8_t fadefactor) { return nscale8(255 - fadefactor); }
+
+  void maximizeBrightness(uint8_t limit = 255) {
+    uint8_t max = r;
+    if(g > max) max = g;
+    if(b > max) max = b;
+    if(max == 0) return;
+    uint16_t factor = ((uint16_t) limit * 256) / max;
+    r = (r * factor) / 256;
+    g = (g * factor) / 256;
+    b = (b * factor) / 256;
+  }
+
+  CRGB& operator+=(const CRGB& rhs) {
+    r = qadd8(r, rhs.r);
+    g = qadd8(g, rhs.g);
+    b = qadd8(b, rhs.b);
+    return *this;
+  }
+
+  explicit operator bool() const { return r || g || b; }
+};
+
+inline bool operator==(const CRGB& lhs, const CRGB& rhs) { return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b; }
+inline bool operator!=(const CRGB& lhs, const CRGB& rhs) { return !(lhs == rhs); }
+
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+inline CRGB::CRGB(const CHSV& rhs) { hsv2rgb_rainbow(rhs, *this); }
+
+void fill_solid(CRGB *leds, int numToFill, const CRGB& color);
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+
+// Chipset tags accepted by addLeds<>().
+template<uint8_t DATA_PIN> class NEOPIXEL {};
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812 {};
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812B {};
+
+class CLEDController {
+  public:
+    CLEDController(CRGB *data, int nLeds, uint8_t pin) : m_data(data), m_nLeds(nLeds), m_pin(pin) {}
+
+    void showLeds(uint8_t brightness = 255);
+    CRGB *leds() { return m_data; }
+    int size() const { return m_nLeds; }
+    uint8_t pin() const { return m_pin; }
+    CLEDController& setLeds(CRGB *data, int nLeds) { m_data = data; m_nLeds = nLeds; return *this; }
+
+  private:
+    CRGB *m_data;
+    int m_nLeds;
+    uint8_t m_pin;
+};
+
+#define SIM_FASTLED_MAX_CONTROLLERS 4
+
+class CFastLED {
+  public:
+    template<template<uint8_t DATA_PIN> class CHIPSET, uint8_t DATA_PIN>
+    CLEDController& addLeds(CRGB *data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+      return addController(data + (nLedsIfOffset > 0 ? nLedsOrOffset : 0), nLedsIfOffset > 0 ? nLedsIfOffset : nLedsOrOffset, DATA_PIN);
+    }
+
+    template<template<uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController& addLeds(CRGB *data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+      return addController(data + (nLedsIfOffset > 0 ? nLedsOrOffset : 0), nLedsIfOffset > 0 ? nLedsIfOffset : nLedsOrOffset, DATA_PIN);
+    }
+
+    void show() { show(m_scale); }
+    void show(uint8_t scale);
+    void clear(bool writeData = false);
+    void setBrightness(uint8_t scale) { m_scale = scale; }
+    uint8_t getBrightness() { return m_scale; }
+    void setDither(uint8_t ditherMode) { (void) ditherMode; }
+    void setMaxPowerInVoltsAndMilliamps(uint8_t volts, uint32_t milliamps) { (void) volts; (void) milliamps; }
+    int count() { return m_nControllers; }
+    CLEDController& operator[](int x) { return *m_controllers[x < m_nControllers ? x : 0]; }
+
+  private:
+    CLEDController& addController(CRGB *data, int nLeds, uint8_t pin);
+
+    CLEDController *m_controllers[SIM_FASTLED_MAX_CONTROLLERS] = {};
+    int m_nControllers = 0;
+    uint8_t m_scale = 255;
+};
+
+extern CFastLED FastLED;
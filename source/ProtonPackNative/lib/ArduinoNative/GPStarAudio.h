@@ -0,0 +1,171 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the GPStar Audio Serial Library.
+ * Behaves as a GPStar Audio Advanced board with a fixed number of tracks on its SD card. Every command is
+ * framed and written to the attached stream so the audio link traffic can be measured, and a simple track
+ * table is kept so playback status queries return sensible answers.
+ */
+
+#include <Arduino.h>
+
+#define VERSION_STRING_LEN 21
+#define SIM_AUDIO_TRACKS 1024
+#define SIM_AUDIO_NUM_TRACKS 520 // Effects plus a handful of music tracks.
+#define SIM_AUDIO_TRACK_MS 1000 // Every track runs this long unless it is looped.
+#define SIM_AUDIO_BOOT_MS 600 // The board ignores commands until it has booted.
+
+class gpstarAudio {
+  public:
+    void start(Stream &port) { serial = &port; }
+    // Tracks which are not looping finish after a fixed time, starting any track chained on to them.
+    void update() {
+      for(uint16_t i = 0; i < SIM_AUDIO_TRACKS; i++) {
+        if(playing[i] && !looping[i] && millis() - playStart[i] >= SIM_AUDIO_TRACK_MS) {
+          uint16_t trk2 = chained[i];
+
+          playing[i] = false;
+          chained[i] = 0;
+
+          if(trk2 > 0) {
+            setPlaying(trk2, true);
+            looping[trk2] = chainLoop[i];
+          }
+        }
+      }
+    }
+
+    void hello() {
+      if(millis() >= SIM_AUDIO_BOOT_MS) {
+        helloRcvd = true;
+      }
+
+      sendFrame(0x01, 0);
+    }
+
+    bool gpstarAudioHello() { return helloRcvd; }
+    uint16_t getVersionNumber() { return 100; }
+    bool getVersion(char *pDst) { (void) pDst; return false; } // Not a WAV Trigger.
+    void requestVersionString() { sendFrame(0x01, 0); }
+    void requestSystemInfo() { sendFrame(0x02, 0); }
+    bool wasSysInfoRcvd() { return true; }
+    int getNumTracks() { return SIM_AUDIO_NUM_TRACKS; }
+    void setReporting(bool enable) { reporting = enable; sendFrame(0x0D, 1); }
+    void setAmpPwr(bool enable) { (void) enable; sendFrame(0x09, 1); }
+    void samplerateOffset(int16_t offset) { (void) offset; sendFrame(0x0C, 2); }
+    void gpstarShortTrackOverload(bool enable) { (void) enable; sendFrame(0x11, 1); }
+    void masterGain(int16_t gain) { (void) gain; sendFrame(0x07, 2); }
+
+    void stopAllTracks() {
+      memset(playing, 0, sizeof(playing));
+      memset(chained, 0, sizeof(chained));
+      sendFrame(0x04, 0);
+    }
+
+    void trackPlayPoly(uint16_t trk, bool lock = false) {
+      setPlaying(trk, true);
+      sendFrame(0x03, 4);
+      (void) lock;
+    }
+
+    void trackPlayPoly(uint16_t trk, bool lock, uint16_t delay) {
+      setPlaying(trk, true);
+      sendFrame(0x03, 6);
+      (void) lock;
+      (void) delay;
+    }
+
+    void trackPlayPoly(uint16_t trk, bool lock, uint16_t delay, uint16_t trk2, bool loop2, uint16_t offset2) {
+      setPlaying(trk, true);
+      sendFrame(0x03, 11);
+      (void) lock;
+      (void) delay;
+      (void) offset2;
+
+      if(trk < SIM_AUDIO_TRACKS && trk2 < SIM_AUDIO_TRACKS) {
+        chained[trk] = trk2;
+        chainLoop[trk] = loop2;
+      }
+    }
+
+    void trackStop(uint16_t trk) { setPlaying(trk, false); sendFrame(0x03, 3); }
+    void trackPause(uint16_t trk) { (void) trk; sendFrame(0x03, 3); }
+    void trackResume(uint16_t trk) { (void) trk; sendFrame(0x03, 3); }
+    void trackLoop(uint16_t trk, bool enable) {
+      if(trk < SIM_AUDIO_TRACKS) {
+        looping[trk] = enable;
+      }
+
+      sendFrame(0x03, 3);
+    }
+    void trackGain(uint16_t trk, int16_t gain) { (void) trk; (void) gain; sendFrame(0x08, 4); }
+    void trackFade(uint16_t trk, int16_t gain, uint16_t time, bool stopFlag) {
+      (void) gain;
+      (void) time;
+
+      if(stopFlag) {
+        setPlaying(trk, false);
+      }
+
+      sendFrame(0x0A, 7);
+    }
+
+    void trackPlayingStatus(uint16_t trk) { (void) trk; sendFrame(0x0E, 2); }
+    bool currentTrackStatus(uint16_t trk) { return trk < SIM_AUDIO_TRACKS && playing[trk]; }
+    bool isTrackPlaying(uint16_t trk) { return reporting && trk < SIM_AUDIO_TRACKS && playing[trk]; } // Voice table kept from track reports.
+    bool isTrackCounterReset() { return trackCounterReset; }
+    void resetTrackCounter(bool resetCounter = false) { trackCounterReset = resetCounter; }
+
+    // Number of commands sent to the audio board since power-on (simulation only).
+    unsigned long commands = 0;
+
+  private:
+    Stream *serial = nullptr;
+    bool playing[SIM_AUDIO_TRACKS] = {};
+    bool looping[SIM_AUDIO_TRACKS] = {};
+    unsigned long playStart[SIM_AUDIO_TRACKS] = {};
+    uint16_t chained[SIM_AUDIO_TRACKS] = {}; // Track started by the board when this one ends.
+    bool chainLoop[SIM_AUDIO_TRACKS] = {};
+    bool reporting = false;
+    bool trackCounterReset = false;
+    bool helloRcvd = false;
+
+    void setPlaying(uint16_t trk, bool state) {
+      if(trk < SIM_AUDIO_TRACKS) {
+        playing[trk] = state;
+        looping[trk] = false;
+        chained[trk] = 0;
+        playStart[trk] = millis();
+      }
+    }
+
+    // All messages share the SOM1 SOM2 LEN CMD ... EOM framing used by the audio boards.
+    void sendFrame(uint8_t cmd, uint8_t dataLen) {
+      commands++;
+
+      if(serial != nullptr) {
+        uint8_t frame[5 + 16] = { 0xF0, 0xAA, (uint8_t) (5 + dataLen), cmd };
+        frame[4 + dataLen] = 0x55;
+        serial->write(frame, 5 + dataLen);
+      }
+    }
+};
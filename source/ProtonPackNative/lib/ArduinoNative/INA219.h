@@ -0,0 +1,65 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the ArduinoINA219 library by Flavius Bindea.
+ * No power meter is present on the simulated i2c bus, so begin() reports failure like a bare pack PCB.
+ */
+
+#include <Arduino.h>
+
+class INA219 {
+  public:
+    enum t_range { RANGE_16V = 0, RANGE_32V = 1 };
+    enum t_gain { GAIN_1_40MV = 0, GAIN_2_80MV = 1, GAIN_4_160MV = 2, GAIN_8_320MV = 3 };
+    enum t_adc { ADC_9BIT = 0, ADC_10BIT = 1, ADC_11BIT = 2, ADC_12BIT = 3, ADC_2SAMP = 9, ADC_4SAMP = 10, ADC_8SAMP = 11,
+                 ADC_16SAMP = 12, ADC_32SAMP = 13, ADC_64SAMP = 14, ADC_128SAMP = 15 };
+    enum t_mode { PWR_DOWN = 0, TRIG_SH = 1, TRIG_BUS = 2, TRIG_SH_BUS = 3, ADC_OFF = 4, CONT_SH = 5, CONT_BUS = 6, CONT_SH_BUS = 7 };
+
+    uint8_t begin(uint8_t addr = 0x40) { (void) addr; return 2; }
+    void configure(t_range range = RANGE_32V, t_gain gain = GAIN_8_320MV, t_adc bus_adc = ADC_12BIT, t_adc shunt_adc = ADC_12BIT, t_mode mode = CONT_SH_BUS) {
+      (void) range; (void) gain; (void) bus_adc; (void) shunt_adc; (void) mode;
+    }
+    void calibrate(float r_shunt, float v_shunt_max, float v_bus_max, float i_max_expected) {
+      (void) r_shunt; (void) v_shunt_max; (void) v_bus_max; (void) i_max_expected;
+    }
+    void recalibrate() {}
+    void reconfig() {}
+    void reset() {}
+
+    float shuntVoltage() { return 0; }
+    float shuntCurrent() { return 0; }
+    float busPower() { return 0; }
+
+    // Like the library, the conversion ready and overflow flags only change when the bus voltage register is read.
+    int16_t busVoltageRaw() {
+      _ready = true;
+      _overflow = false;
+      return 0x0002; // 0V with the conversion ready bit set.
+    }
+    float busVoltage() { return (busVoltageRaw() >> 3) * 0.004; }
+    bool ready() { return _ready; }
+    bool overflow() { return _overflow; }
+
+  private:
+    bool _ready = false;
+    bool _overflow = false;
+};
@@ -0,0 +1,274 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Implementations for the third-party library stand-ins.
+ */
+
+#include "SimHarness.h"
+#include <EEPROM.h>
+#include <FastLED.h>
+#include <Ramp.h>
+#include <Wire.h>
+
+TwoWire Wire;
+EEPROMClass EEPROM;
+CFastLED FastLED;
+
+/*
+ * FastLED
+ */
+static unsigned long i_fastled_updates = 0;
+static unsigned long i_fastled_pixels = 0;
+
+unsigned long simFastLEDUpdates() {
+  return i_fastled_updates;
+}
+
+unsigned long simFastLEDPixelsSent() {
+  return i_fastled_pixels;
+}
+
+// Same algorithm (and integer rounding) as FastLED's hsv2rgb_rainbow with the default yellow/green boost and
+// FASTLED_SCALE8_FIXED, under which scale8() needs no correction for nonzero channels.
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+  const uint8_t K255 = 255;
+  const uint8_t K171 = 171;
+  const uint8_t K170 = 170;
+  const uint8_t K85 = 85;
+
+  uint8_t hue = hsv.hue;
+  uint8_t sat = hsv.sat;
+  uint8_t val = hsv.val;
+
+  uint8_t offset = hue & 0x1F;
+  uint8_t offset8 = offset << 3;
+  uint8_t third = scale8(offset8, (256 / 3));
+  uint8_t r, g, b;
+
+  if(!(hue & 0x80)) {
+    if(!(hue & 0x40)) {
+      if(!(hue & 0x20)) {
+        r = K255 - third;
+        g = third;
+        b = 0;
+      }
+      else {
+        r = K171;
+        g = K85 + third;
+        b = 0;
+      }
+    }
+    else {
+      if(!(hue & 0x20)) {
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        r = K171 - twothirds;
+        g = K170 + third;
+        b = 0;
+      }
+      else {
+        r = 0;
+        g = K255 - third;
+        b = third;
+      }
+    }
+  }
+  else {
+    if(!(hue & 0x40)) {
+      if(!(hue & 0x20)) {
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        r = 0;
+        g = K171 - twothirds;
+        b = K85 + twothirds;
+      }
+      else {
+        r = third;
+        g = 0;
+        b = K255 - third;
+      }
+    }
+    else {
+      if(!(hue & 0x20)) {
+        r = K85 + third;
+        g = 0;
+        b = K171 - third;
+      }
+      else {
+        r = K170 + third;
+        g = 0;
+        b = K85 - third;
+      }
+    }
+  }
+
+  if(sat != 255) {
+    if(sat == 0) {
+      r = 255;
+      b = 255;
+      g = 255;
+    }
+    else {
+      uint8_t desat = 255 - sat;
+      desat = scale8_video(desat, desat);
+      uint8_t satscale = 255 - desat;
+
+      r = scale8(r, satscale);
+      g = scale8(g, satscale);
+      b = scale8(b, satscale);
+
+      r += desat;
+      g += desat;
+      b += desat;
+    }
+  }
+
+  if(val != 255) {
+    val = scale8_video(val, val);
+
+    if(val == 0) {
+      r = 0;
+      g = 0;
+      b = 0;
+    }
+    else {
+      r = scale8(r, val);
+      g = scale8(g, val);
+      b = scale8(b, val);
+    }
+  }
+
+  rgb.r = r;
+  rgb.g = g;
+  rgb.b = b;
+}
+
+void fill_solid(CRGB *leds, int numToFill, const CRGB& color) {
+  for(int i = 0; i < numToFill; i++) {
+    leds[i] = color;
+  }
+}
+
+void CLEDController::showLeds(uint8_t brightness) {
+  (void) brightness;
+
+  // The data line holds interrupts off for the whole chain, so simulated time advances accordingly.
+  i_fastled_updates++;
+  i_fastled_pixels += m_nLeds;
+  simAdvanceMicros((unsigned long) m_nLeds * SIM_FASTLED_US_PER_LED);
+}
+
+CLEDController& CFastLED::addController(CRGB *data, int nLeds, uint8_t pin) {
+  CLEDController *controller = new CLEDController(data, nLeds, pin);
+
+  if(m_nControllers < SIM_FASTLED_MAX_CONTROLLERS) {
+    m_controllers[m_nControllers++] = controller;
+  }
+
+  return *controller;
+}
+
+void CFastLED::show(uint8_t scale) {
+  for(int i = 0; i < m_nControllers; i++) {
+    m_controllers[i]->showLeds(scale);
+  }
+}
+
+void CFastLED::clear(bool writeData) {
+  for(int i = 0; i < m_nControllers; i++) {
+    fill_solid(m_controllers[i]->leds(), m_controllers[i]->size(), CRGB(0, 0, 0));
+  }
+
+  if(writeData) {
+    show();
+  }
+}
+
+/*
+ * Ramp easing functions
+ */
+float rampEase(ramp_mode mode, float k) {
+  switch(mode) {
+    case NONE:
+      return 1;
+    case LINEAR:
+    default:
+      return k;
+    case QUADRATIC_IN:
+      return k * k;
+    case QUADRATIC_OUT:
+      return k * (2 - k);
+    case QUADRATIC_INOUT:
+      return k < 0.5 ? 2 * k * k : -1 + (4 - 2 * k) * k;
+    case CUBIC_IN:
+      return k * k * k;
+    case CUBIC_OUT:
+      k -= 1;
+      return k * k * k + 1;
+    case CUBIC_INOUT:
+      return k < 0.5 ? 4 * k * k * k : (k - 1) * (2 * k - 2) * (2 * k - 2) + 1;
+    case QUARTIC_IN:
+      return k * k * k * k;
+    case QUARTIC_OUT:
+      k -= 1;
+      return 1 - k * k * k * k;
+    case QUARTIC_INOUT:
+      if(k < 0.5) {
+        return 8 * k * k * k * k;
+      }
+      k -= 1;
+      return 1 - 8 * k * k * k * k;
+    case QUINTIC_IN:
+      return k * k * k * k * k;
+    case QUINTIC_OUT:
+      k -= 1;
+      return 1 + k * k * k * k * k;
+    case QUINTIC_INOUT:
+      if(k < 0.5) {
+        return 16 * k * k * k * k * k;
+      }
+      k -= 1;
+      return 1 + 16 * k * k * k * k * k;
+    case SINUSOIDAL_IN:
+      return 1 - cos(k * PI / 2);
+    case SINUSOIDAL_OUT:
+      return sin(k * PI / 2);
+    case SINUSOIDAL_INOUT:
+      return -0.5 * (cos(PI * k) - 1);
+    case EXPONENTIAL_IN:
+      return k == 0 ? 0 : pow(2, 10 * (k - 1));
+    case EXPONENTIAL_OUT:
+      return k == 1 ? 1 : 1 - pow(2, -10 * k);
+    case EXPONENTIAL_INOUT:
+      if(k == 0 || k == 1) {
+        return k;
+      }
+      return k < 0.5 ? 0.5 * pow(2, 20 * k - 10) : 1 - 0.5 * pow(2, -20 * k + 10);
+    case CIRCULAR_IN:
+      return 1 - sqrt(1 - k * k);
+    case CIRCULAR_OUT:
+      k -= 1;
+      return sqrt(1 - k * k);
+    case CIRCULAR_INOUT:
+      if(k < 0.5) {
+        return 0.5 * (1 - sqrt(1 - 4 * k * k));
+      }
+      k = 2 * k - 2;
+      return 0.5 * (sqrt(1 - k * k) + 1);
+  }
+}
@@ -0,0 +1,118 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the Ramp library by Sylvain Garnavault.
+ * Only forward one-shot ramps are used by the firmware, so loop modes are accepted but treated as ONCEFORWARD.
+ */
+
+#include <Arduino.h>
+
+enum ramp_mode {
+  NONE, LINEAR,
+  QUADRATIC_IN, QUADRATIC_OUT, QUADRATIC_INOUT,
+  CUBIC_IN, CUBIC_OUT, CUBIC_INOUT,
+  QUARTIC_IN, QUARTIC_OUT, QUARTIC_INOUT,
+  QUINTIC_IN, QUINTIC_OUT, QUINTIC_INOUT,
+  SINUSOIDAL_IN, SINUSOIDAL_OUT, SINUSOIDAL_INOUT,
+  EXPONENTIAL_IN, EXPONENTIAL_OUT, EXPONENTIAL_INOUT,
+  CIRCULAR_IN, CIRCULAR_OUT, CIRCULAR_INOUT
+};
+
+enum loop_mode { ONCEFORWARD, LOOPFORWARD, FORTHANDBACK, ONCEBACKWARD, LOOPBACKWARD, BACKANDFORTH };
+
+float rampEase(ramp_mode mode, float k);
+
+template <class T> class _ramp {
+  public:
+    _ramp() {}
+    explicit _ramp(T v) : A(v), B(v), val(v) {}
+
+    T go(T _val, unsigned long _dur = 0, ramp_mode _mode = LINEAR, loop_mode _loop = ONCEFORWARD) {
+      (void) _loop;
+      A = val;
+      B = _val;
+      mode = _mode;
+      dur = _dur;
+      pos = 0;
+      paused = false;
+      lastUpdate = millis();
+
+      if(dur == 0 || mode == NONE) {
+        val = B;
+        pos = dur;
+      }
+
+      return val;
+    }
+
+    T update() {
+      if(paused || pos >= dur) {
+        return val;
+      }
+
+      unsigned long now = millis();
+      pos += now - lastUpdate;
+      lastUpdate = now;
+
+      if(pos >= dur) {
+        pos = dur;
+        val = B;
+      }
+      else {
+        float k = rampEase(mode, (float) pos / (float) dur);
+        val = (T) (A + ((float) B - (float) A) * k);
+      }
+
+      return val;
+    }
+
+    void pause() { paused = true; }
+    void resume() { paused = false; lastUpdate = millis(); }
+    T getValue() { return val; }
+    T getOrigin() { return A; }
+    T getTarget() { return B; }
+    unsigned long getDuration() { return dur; }
+    unsigned long getPosition() { return pos; }
+    float getCompletion() { return dur == 0 ? 100.0 : (100.0 * pos) / dur; }
+    bool isFinished() { return pos >= dur; }
+    bool isRunning() { return !paused && pos < dur; }
+    bool isPaused() { return paused; }
+
+  private:
+    T A = 0;
+    T B = 0;
+    T val = 0;
+    ramp_mode mode = LINEAR;
+    unsigned long dur = 0;
+    unsigned long pos = 0;
+    unsigned long lastUpdate = 0;
+    bool paused = false;
+};
+
+typedef _ramp<unsigned char> ramp;
+typedef _ramp<unsigned char> rampByte;
+typedef _ramp<int> rampInt;
+typedef _ramp<unsigned int> rampUnsignedInt;
+typedef _ramp<long> rampLong;
+typedef _ramp<unsigned long> rampUnsignedLong;
+typedef _ramp<float> rampFloat;
+typedef _ramp<double> rampDouble;
@@ -0,0 +1,321 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the SerialTransfer library by PowerBroker2.
+ * Uses the same wire format (start byte, packet ID, COBS overhead byte, length, payload, CRC8, stop byte)
+ * and the same status codes, so byte counts and error handling match what the Mega sees on its UARTs.
+ */
+
+#include <Arduino.h>
+
+#define START_BYTE 0x7E
+#define STOP_BYTE 0x81
+#define PREAMBLE_SIZE 4
+#define POSTAMBLE_SIZE 2
+#define MAX_PACKET_SIZE 0xFE
+
+const int8_t CONTINUE = 3;
+const int8_t NEW_DATA = 2;
+const int8_t NO_DATA = 1;
+const int8_t CRC_ERROR = 0;
+const int8_t PAYLOAD_ERROR = -1;
+const int8_t STOP_BYTE_ERROR = -2;
+const int8_t STALE_PACKET_ERROR = -3;
+
+class SerialTransferCRC {
+  public:
+    static uint8_t calculate(const uint8_t arr[], uint8_t len) {
+      uint8_t crc = 0;
+
+      for(uint16_t i = 0; i < len; i++) {
+        crc = next(crc ^ arr[i]);
+      }
+
+      return crc;
+    }
+
+  private:
+    static uint8_t next(uint8_t val) {
+      // Polynomial 0x9B, computed bitwise rather than from a lookup table.
+      for(uint8_t i = 0; i < 8; i++) {
+        val = (val & 0x80) ? (uint8_t) ((val << 1) ^ 0x9B) : (uint8_t) (val << 1);
+      }
+
+      return val;
+    }
+};
+
+class Packet {
+  public:
+    uint8_t txBuff[MAX_PACKET_SIZE];
+    uint8_t rxBuff[MAX_PACKET_SIZE];
+    uint8_t preamble[PREAMBLE_SIZE] = { START_BYTE, 0, 0, 0 };
+    uint8_t postamble[POSTAMBLE_SIZE] = { 0, STOP_BYTE };
+    uint8_t bytesRead = 0;
+    int8_t status = 0;
+
+    uint8_t constructPacket(uint16_t messageLen, uint8_t packetID) {
+      if(messageLen > MAX_PACKET_SIZE) {
+        messageLen = MAX_PACKET_SIZE;
+      }
+
+      calcOverhead(txBuff, (uint8_t) messageLen);
+      stuffPacket(txBuff, (uint8_t) messageLen);
+      uint8_t crcVal = SerialTransferCRC::calculate(txBuff, (uint8_t) messageLen);
+
+      preamble[1] = packetID;
+      preamble[2] = overheadByte;
+      preamble[3] = (uint8_t) messageLen;
+      postamble[0] = crcVal;
+
+      return (uint8_t) messageLen;
+    }
+
+    uint8_t parse(uint8_t recChar, bool valid = true) {
+      if(!valid) {
+        status = NO_DATA;
+        return 0;
+      }
+
+      switch(state) {
+        case find_start_byte:
+          if(recChar == START_BYTE) {
+            state = find_id_byte;
+          }
+        break;
+
+        case find_id_byte:
+          idByte = recChar;
+          state = find_overhead_byte;
+        break;
+
+        case find_overhead_byte:
+          recOverheadByte = recChar;
+          state = find_payload_len;
+        break;
+
+        case find_payload_len:
+          if(recChar > 0 && recChar <= MAX_PACKET_SIZE) {
+            bytesToRec = recChar;
+            payIndex = 0;
+            state = find_payload;
+          }
+          else {
+            bytesRead = 0;
+            state = find_start_byte;
+            status = PAYLOAD_ERROR;
+            return 0;
+          }
+        break;
+
+        case find_payload:
+          if(payIndex < bytesToRec) {
+            rxBuff[payIndex++] = recChar;
+
+            if(payIndex == bytesToRec) {
+              state = find_crc;
+            }
+          }
+        break;
+
+        case find_crc:
+          if(SerialTransferCRC::calculate(rxBuff, bytesToRec) == recChar) {
+            state = find_end_byte;
+          }
+          else {
+            bytesRead = 0;
+            state = find_start_byte;
+            status = CRC_ERROR;
+            return 0;
+          }
+        break;
+
+        case find_end_byte:
+          state = find_start_byte;
+
+          if(recChar == STOP_BYTE) {
+            unpackPacket(rxBuff);
+            bytesRead = bytesToRec;
+            status = NEW_DATA;
+            return bytesToRec;
+          }
+
+          bytesRead = 0;
+          status = STOP_BYTE_ERROR;
+          return 0;
+      }
+
+      status = CONTINUE;
+      return 0;
+    }
+
+    uint8_t currentPacketID() { return idByte; }
+    void reset() { state = find_start_byte; bytesRead = 0; }
+
+  private:
+    enum fsm { find_start_byte, find_id_byte, find_overhead_byte, find_payload_len, find_payload, find_crc, find_end_byte };
+    fsm state = find_start_byte;
+
+    uint8_t bytesToRec = 0;
+    uint8_t payIndex = 0;
+    uint8_t idByte = 0;
+    uint8_t overheadByte = 0;
+    uint8_t recOverheadByte = 0;
+
+    void calcOverhead(uint8_t arr[], uint8_t len) {
+      overheadByte = 0xFF;
+
+      for(uint8_t i = 0; i < len; i++) {
+        if(arr[i] == START_BYTE) {
+          overheadByte = i;
+          break;
+        }
+      }
+    }
+
+    int16_t findLast(uint8_t arr[], uint8_t len) {
+      for(uint8_t i = (len - 1); i != 0xFF; i--) {
+        if(arr[i] == START_BYTE) {
+          return i;
+        }
+      }
+
+      return -1;
+    }
+
+    void stuffPacket(uint8_t arr[], uint8_t len) {
+      int16_t refByte = findLast(arr, len);
+
+      if(refByte != -1) {
+        for(uint8_t i = (len - 1); i != 0xFF; i--) {
+          if(arr[i] == START_BYTE) {
+            arr[i] = refByte - i;
+            refByte = i;
+          }
+        }
+      }
+    }
+
+    void unpackPacket(uint8_t arr[]) {
+      uint8_t testIndex = recOverheadByte;
+      uint8_t delta = 0;
+
+      if(testIndex <= MAX_PACKET_SIZE) {
+        while(arr[testIndex]) {
+          delta = arr[testIndex];
+          arr[testIndex] = START_BYTE;
+          testIndex += delta;
+        }
+
+        arr[testIndex] = START_BYTE;
+      }
+    }
+};
+
+class SerialTransfer {
+  public:
+    Packet packet;
+    uint8_t bytesRead = 0;
+    int8_t status = 0;
+
+    void begin(Stream &_port, bool _debug = true, Stream &_debugPort = Serial, uint32_t _timeout = 50) {
+      (void) _debug;
+      (void) _debugPort;
+      (void) _timeout;
+      port = &_port;
+    }
+
+    uint8_t sendData(uint16_t messageLen, uint8_t packetID = 0) {
+      uint8_t numBytesIncl = packet.constructPacket(messageLen, packetID);
+
+      port->write(packet.preamble, sizeof(packet.preamble));
+      port->write(packet.txBuff, numBytesIncl);
+      port->write(packet.postamble, sizeof(packet.postamble));
+
+      return numBytesIncl;
+    }
+
+    uint8_t available() {
+      bool valid = false;
+      uint8_t recChar = 0xFF;
+
+      if(port->available()) {
+        valid = true;
+
+        while(port->available()) {
+          recChar = port->read();
+          bytesRead = packet.parse(recChar, valid);
+          status = packet.status;
+
+          if(status != CONTINUE) {
+            if(status < 0) {
+              packet.reset();
+            }
+
+            break;
+          }
+        }
+      }
+      else {
+        bytesRead = packet.parse(recChar, valid);
+        status = packet.status;
+      }
+
+      return bytesRead;
+    }
+
+    uint8_t currentPacketID() { return packet.currentPacketID(); }
+
+    void reset() {
+      while(port->available()) {
+        port->read();
+      }
+
+      packet.reset();
+      status = packet.status;
+    }
+
+    template <typename T> uint16_t txObj(const T &val, uint16_t index = 0, uint16_t len = sizeof(T)) {
+      const uint8_t *ptr = (const uint8_t *) &val;
+      uint16_t maxIndex = (len + index) > MAX_PACKET_SIZE ? MAX_PACKET_SIZE : (len + index);
+
+      for(uint16_t i = index; i < maxIndex; i++) {
+        packet.txBuff[i] = *ptr++;
+      }
+
+      return maxIndex;
+    }
+
+    template <typename T> uint16_t rxObj(const T &val, uint16_t index = 0, uint16_t len = sizeof(T)) {
+      uint8_t *ptr = (uint8_t *) &val;
+      uint16_t maxIndex = (len + index) > MAX_PACKET_SIZE ? MAX_PACKET_SIZE : (len + index);
+
+      for(uint16_t i = index; i < maxIndex; i++) {
+        *ptr++ = packet.rxBuff[i];
+      }
+
+      return maxIndex;
+    }
+
+  private:
+    Stream *port = nullptr;
+};
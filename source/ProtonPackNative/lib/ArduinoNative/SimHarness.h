@@ -0,0 +1,59 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Simulation hooks for the host-native build.
+ *
+ * The simulated clock is a plain microsecond counter. It advances when the harness calls simAdvanceMicros(),
+ * when the sketch calls delay()/delayMicroseconds(), and (optionally) by the measured host execution time
+ * multiplied by a CPU scale factor. The latter lets micros() inside loop() behave roughly like it would on a
+ * 16MHz Mega, so any timing code in the sketch sees plausible per-stage durations.
+ */
+
+#include <Arduino.h>
+
+#define SIM_PIN_COUNT 70
+#define SIM_SERIAL_PORTS 4
+
+struct SimSerialStats {
+  unsigned long bytesWritten = 0;
+  unsigned long bytesRead = 0;
+};
+
+// Clock control.
+void simAdvanceMicros(unsigned long us);
+void simSetCpuScale(double scale); // 0 disables host-time coupling (default).
+unsigned long long simHostNanos(); // Monotonic host clock for benchmarking.
+
+// GPIO control; inputs default to HIGH (pull-up, switch open).
+void simSetPinInput(uint8_t pin, uint8_t value);
+uint8_t simGetPinOutput(uint8_t pin);
+int simGetPinAnalog(uint8_t pin);
+
+// Serial port control (port 0 = Serial, 1 = Serial1, etc).
+void simSerialInject(uint8_t port, const uint8_t *data, size_t len);
+size_t simSerialDrain(uint8_t port, uint8_t *data, size_t maxLen);
+void simSerialEcho(uint8_t port, bool echo); // Copy port output to stdout (default on for Serial only).
+const SimSerialStats& simSerialStats(uint8_t port);
+
+// Counters reported by the library shims.
+unsigned long simFastLEDUpdates(); // Controller pushes, one per LED chain written.
+unsigned long simFastLEDPixelsSent();
@@ -0,0 +1,66 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for the ezButton library, reading from the simulated GPIO.
+ */
+
+#include <Arduino.h>
+
+class ezButton {
+  public:
+    explicit ezButton(int pin) : btnPin(pin) {
+      pinMode(btnPin, INPUT_PULLUP);
+      previousSteadyState = digitalRead(btnPin);
+      lastSteadyState = previousSteadyState;
+      lastFlickerableState = previousSteadyState;
+    }
+
+    void setDebounceTime(unsigned long time) { debounceTime = time; }
+    int getState() { return lastSteadyState; }
+    int getStateRaw() { return digitalRead(btnPin); }
+    bool isPressed() { return previousSteadyState == HIGH && lastSteadyState == LOW; }
+    bool isReleased() { return previousSteadyState == LOW && lastSteadyState == HIGH; }
+
+    void loop() {
+      int currentState = digitalRead(btnPin);
+      unsigned long currentTime = millis();
+
+      if(currentState != lastFlickerableState) {
+        lastDebounceTime = currentTime;
+        lastFlickerableState = currentState;
+      }
+
+      previousSteadyState = lastSteadyState;
+
+      if((currentTime - lastDebounceTime) >= debounceTime) {
+        lastSteadyState = currentState;
+      }
+    }
+
+  private:
+    int btnPin;
+    unsigned long debounceTime = 0;
+    unsigned long lastDebounceTime = 0;
+    int previousSteadyState;
+    int lastSteadyState;
+    int lastFlickerableState;
+};
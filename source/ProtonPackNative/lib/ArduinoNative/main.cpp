@@ -0,0 +1,141 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Entry point for the host-native build.
+ *
+ * Runs setup() once and then loop() for a fixed number of iterations, advancing the simulated clock between
+ * passes, and reports how long each pass took on the host along with the simulated I/O counters.
+ *
+ * Options:
+ *   --loops N        Number of loop() iterations to run (default 100000).
+ *   --step-us N      Simulated microseconds added between iterations (default 100).
+ *   --cpu-scale X    Couple the simulated clock to host time, scaled by X (default 0 = off).
+ *   --pack-on        Hold the ion arm switch closed so the pack powers up.
+ *   --quiet          Do not echo the debug serial port to stdout.
+ *   --console TEXT   Type TEXT into the Serial console after the run, then call loop() once more.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "SimHarness.h"
+
+// Ion arm switch (ION_ARM_SWITCH in ProtonPack.ino).
+#define SIM_ION_ARM_SWITCH_PIN 31
+
+int main(int argc, char **argv) {
+  unsigned long i_loops = 100000;
+  unsigned long i_step_us = 100;
+  double f_cpu_scale = 0;
+  bool b_pack_on = false;
+  bool b_quiet = false;
+  const char *s_console = nullptr;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+      i_loops = strtoul(argv[++i], nullptr, 10);
+    }
+    else if(strcmp(argv[i], "--step-us") == 0 && i + 1 < argc) {
+      i_step_us = strtoul(argv[++i], nullptr, 10);
+    }
+    else if(strcmp(argv[i], "--cpu-scale") == 0 && i + 1 < argc) {
+      f_cpu_scale = strtod(argv[++i], nullptr);
+    }
+    else if(strcmp(argv[i], "--pack-on") == 0) {
+      b_pack_on = true;
+    }
+    else if(strcmp(argv[i], "--quiet") == 0) {
+      b_quiet = true;
+    }
+    else if(strcmp(argv[i], "--console") == 0 && i + 1 < argc) {
+      s_console = argv[++i];
+    }
+    else {
+      fprintf(stderr, "Usage: %s [--loops N] [--step-us N] [--cpu-scale X] [--pack-on] [--quiet] [--console TEXT]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  setup();
+
+  if(b_quiet) {
+    simSerialEcho(0, false);
+  }
+
+  simSetCpuScale(f_cpu_scale);
+
+  if(b_pack_on) {
+    simSetPinInput(SIM_ION_ARM_SWITCH_PIN, LOW);
+  }
+
+  unsigned long long i_min_ns = ~0ULL;
+  unsigned long long i_max_ns = 0;
+  unsigned long long i_total_ns = 0;
+
+  for(unsigned long i = 0; i < i_loops; i++) {
+    unsigned long long i_start = simHostNanos();
+    loop();
+    unsigned long long i_elapsed = simHostNanos() - i_start;
+
+    i_total_ns += i_elapsed;
+
+    if(i_elapsed < i_min_ns) {
+      i_min_ns = i_elapsed;
+    }
+
+    if(i_elapsed > i_max_ns) {
+      i_max_ns = i_elapsed;
+    }
+
+    simAdvanceMicros(i_step_us);
+
+    // Nothing is attached to the other end of the serial ports, so discard whatever the sketch sent.
+    for(uint8_t port = 1; port < SIM_SERIAL_PORTS; port++) {
+      simSerialDrain(port, nullptr, 0);
+    }
+  }
+
+  if(s_console != nullptr) {
+    simSerialEcho(0, true);
+    simSerialInject(0, (const uint8_t *) s_console, strlen(s_console));
+
+    for(size_t i = strlen(s_console); i > 0; i--) {
+      loop();
+    }
+  }
+
+  fflush(stdout);
+
+  fprintf(stderr, "\nloops: %lu, simulated time: %lu ms\n", i_loops, millis());
+
+  if(i_loops > 0) {
+    fprintf(stderr, "loop() host ns: min %llu, avg %llu, max %llu\n", i_min_ns, i_total_ns / i_loops, i_max_ns);
+  }
+
+  fprintf(stderr, "FastLED: %lu chain updates, %lu pixels sent\n", simFastLEDUpdates(), simFastLEDPixelsSent());
+
+  for(uint8_t port = 0; port < SIM_SERIAL_PORTS; port++) {
+    const SimSerialStats &stats = simSerialStats(port);
+    fprintf(stderr, "Serial%u: %lu bytes out, %lu bytes in\n", port, stats.bytesWritten, stats.bytesRead);
+  }
+
+  return 0;
+}
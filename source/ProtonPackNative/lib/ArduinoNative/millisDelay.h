@@ -0,0 +1,68 @@
+/**
+ *   GPStar Proton Pack - Ghostbusters Proton Pack & Neutrona Wand.
+ *   Copyright (C) 2023-2025 Michael Rajotte <michael.rajotte@gpstartechnologies.com>
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * Host-native stand-in for millisDelay from the SafeString library (same API and semantics).
+ */
+
+#include <Arduino.h>
+
+class millisDelay {
+  public:
+    void start(unsigned long delay) {
+      ms_delay = delay;
+      startTime = millis();
+      running = true;
+      finishNow = false;
+    }
+
+    void stop() { running = false; finishNow = false; }
+    void restart() { start(ms_delay); }
+    void repeat() { startTime += ms_delay; running = true; finishNow = false; }
+    void finish() { finishNow = true; }
+    bool isRunning() { return running; }
+    unsigned long delay() { return ms_delay; }
+    unsigned long getStartTime() { return startTime; }
+
+    unsigned long remaining() {
+      if(!running) {
+        return 0;
+      }
+
+      unsigned long elapsed = millis() - startTime;
+      return elapsed >= ms_delay ? 0 : ms_delay - elapsed;
+    }
+
+    bool justFinished() {
+      if(running && (finishNow || (millis() - startTime) >= ms_delay)) {
+        stop();
+        return true;
+      }
+
+      return false;
+    }
+
+  private:
+    unsigned long ms_delay = 0;
+    unsigned long startTime = 0;
+    bool running = false;
+    bool finishNow = false;
+};
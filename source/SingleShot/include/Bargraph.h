@@ -79,10 +79,9 @@ struct Bargraph {
     const uint8_t Bar_5[Bargraph::Elements] = {1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0};
 
   public:
-    HT16K33 device; // Singular bargraph object instance using the HT16K33 matrix driver.
+    BargraphDriver device; // Singular bargraph object instance using the HT16K33 matrix driver (only changed RAM is sent).
     uint8_t simulate = Bargraph::Elements; // Simulated maximum for patterns which may be dependent on other factors.
-    uint8_t steps = Bargraph::Elements / 2; // Steps for patterns (1/2 max) which are bilateral/mirrored.
-    uint8_t step = 0; // Indicates current step for bilateral/mirrored patterns.
+    BargraphSequencer sequencer; // Plays the keyframe tracks for patterns which are bilateral/mirrored.
     int element = 0; // Indicates current LED element for adjustment.
     bool inverted = false; // Whether the order of the device elements should be considered inverted.
     bool present = false; // Denotes that i2c bus found the bargraph device.
@@ -190,6 +189,20 @@ struct Bargraph {
       }
     }
 
+    void drawFrame() {
+      // This sets or clears the elements changed by the latest sequencer frame, then commits them to the bargraph.
+      uint32_t i_changed = sequencer.changed();
+      uint32_t i_mask = sequencer.mask();
+
+      for(uint8_t i = 0; i < Bargraph::Elements; i++) {
+        if((i_changed >> i) & 0x01) {
+          setElement(i, (i_mask >> i) & 0x01);
+        }
+      }
+
+      commit();
+    }
+
     void commit() {
       // This commits any changes created by bargraph.setElement to the bargraph.
       if(present) {
@@ -202,6 +215,7 @@ struct Bargraph {
       if(present) {
         device.clearAll();
       }
+      sequencer.stop(); // Any track must start over on the now empty display.
       element = 0;
       STATE = BG_EMPTY; // Mark last known state.
     }
@@ -209,7 +223,6 @@ struct Bargraph {
     void reset() {
       // Sets the bargraph into a state where it can begin running.
       element = 0;
-      step = 0;
       STATE = BG_ON;
       ms_bargraph.stop();
     }
@@ -230,6 +243,60 @@ struct Bargraph {
     }
 } bargraph;
 
+/*
+ * Keyframe tracks for the bilateral/mirrored patterns, played by the bargraph sequencer (see BargraphSequencer.h).
+ * Both step between the ends and the middle of the display; each hold time is added to the base delay.
+ * - Outer-Inner: A pair of single elements.
+ * - Inner Pulse: Every element between the pair, beginning from the middle (BARGRAPH_TRACK_INNER_PULSE_START).
+ * The frames are built from the number of elements, so the tracks follow any change to Bargraph::Elements.
+ */
+static_assert(Bargraph::Elements % 2 == 0 && Bargraph::Elements >= 6 && Bargraph::Elements <= 32, "Bargraph tracks need an even number of elements, from 6 to 32.");
+
+const uint8_t BARGRAPH_TRACK_FRAMES = Bargraph::Elements - 2;
+const uint8_t BARGRAPH_TRACK_MIDDLE = Bargraph::Elements / 2 - 1; // Frame with the middle elements lit.
+const uint8_t BARGRAPH_TRACK_INNER_PULSE_START = BARGRAPH_TRACK_MIDDLE;
+const uint8_t BARGRAPH_TRACK_FRAMES_MAX = 30; // Frames for the longest bargraph (32 elements); later entries are not played.
+
+// Distance of the lit pair from the ends: inward up to the middle frame, then back out.
+constexpr uint8_t bargraphTrackStep(uint8_t i_frame) {
+  return i_frame >= BARGRAPH_TRACK_FRAMES ? 0 : (i_frame <= BARGRAPH_TRACK_MIDDLE ? i_frame : BARGRAPH_TRACK_FRAMES - i_frame);
+}
+
+// Holds grow towards the middle and shrink on the way back out.
+constexpr uint8_t bargraphTrackHold(uint8_t i_frame) {
+  return i_frame >= BARGRAPH_TRACK_FRAMES ? 0 : (i_frame < BARGRAPH_TRACK_MIDDLE ? i_frame + 1 : BARGRAPH_TRACK_FRAMES - 1 - i_frame);
+}
+
+constexpr uint32_t bargraphTrackPair(uint8_t i_step) {
+  return (1UL << i_step) | (1UL << (Bargraph::Elements - 1 - i_step));
+}
+
+constexpr uint32_t bargraphTrackSpan(uint8_t i_step) {
+  return (0xFFFFFFFFUL >> (32 - (Bargraph::Elements - i_step))) & (0xFFFFFFFFUL << i_step);
+}
+
+#define BARGRAPH_TRACK_PAIR(f) {bargraphTrackPair(bargraphTrackStep(f)), bargraphTrackHold(f), 0}
+#define BARGRAPH_TRACK_SPAN(f) {bargraphTrackSpan(bargraphTrackStep(f)), bargraphTrackHold(f), 0}
+
+const BargraphKeyframe bargraphTrackOuterInner[BARGRAPH_TRACK_FRAMES_MAX] PROGMEM = {
+  BARGRAPH_TRACK_PAIR(0), BARGRAPH_TRACK_PAIR(1), BARGRAPH_TRACK_PAIR(2), BARGRAPH_TRACK_PAIR(3), BARGRAPH_TRACK_PAIR(4), BARGRAPH_TRACK_PAIR(5),
+  BARGRAPH_TRACK_PAIR(6), BARGRAPH_TRACK_PAIR(7), BARGRAPH_TRACK_PAIR(8), BARGRAPH_TRACK_PAIR(9), BARGRAPH_TRACK_PAIR(10), BARGRAPH_TRACK_PAIR(11),
+  BARGRAPH_TRACK_PAIR(12), BARGRAPH_TRACK_PAIR(13), BARGRAPH_TRACK_PAIR(14), BARGRAPH_TRACK_PAIR(15), BARGRAPH_TRACK_PAIR(16), BARGRAPH_TRACK_PAIR(17),
+  BARGRAPH_TRACK_PAIR(18), BARGRAPH_TRACK_PAIR(19), BARGRAPH_TRACK_PAIR(20), BARGRAPH_TRACK_PAIR(21), BARGRAPH_TRACK_PAIR(22), BARGRAPH_TRACK_PAIR(23),
+  BARGRAPH_TRACK_PAIR(24), BARGRAPH_TRACK_PAIR(25), BARGRAPH_TRACK_PAIR(26), BARGRAPH_TRACK_PAIR(27), BARGRAPH_TRACK_PAIR(28), BARGRAPH_TRACK_PAIR(29)
+};
+
+const BargraphKeyframe bargraphTrackInnerPulse[BARGRAPH_TRACK_FRAMES_MAX] PROGMEM = {
+  BARGRAPH_TRACK_SPAN(0), BARGRAPH_TRACK_SPAN(1), BARGRAPH_TRACK_SPAN(2), BARGRAPH_TRACK_SPAN(3), BARGRAPH_TRACK_SPAN(4), BARGRAPH_TRACK_SPAN(5),
+  BARGRAPH_TRACK_SPAN(6), BARGRAPH_TRACK_SPAN(7), BARGRAPH_TRACK_SPAN(8), BARGRAPH_TRACK_SPAN(9), BARGRAPH_TRACK_SPAN(10), BARGRAPH_TRACK_SPAN(11),
+  BARGRAPH_TRACK_SPAN(12), BARGRAPH_TRACK_SPAN(13), BARGRAPH_TRACK_SPAN(14), BARGRAPH_TRACK_SPAN(15), BARGRAPH_TRACK_SPAN(16), BARGRAPH_TRACK_SPAN(17),
+  BARGRAPH_TRACK_SPAN(18), BARGRAPH_TRACK_SPAN(19), BARGRAPH_TRACK_SPAN(20), BARGRAPH_TRACK_SPAN(21), BARGRAPH_TRACK_SPAN(22), BARGRAPH_TRACK_SPAN(23),
+  BARGRAPH_TRACK_SPAN(24), BARGRAPH_TRACK_SPAN(25), BARGRAPH_TRACK_SPAN(26), BARGRAPH_TRACK_SPAN(27), BARGRAPH_TRACK_SPAN(28), BARGRAPH_TRACK_SPAN(29)
+};
+
+#undef BARGRAPH_TRACK_PAIR
+#undef BARGRAPH_TRACK_SPAN
+
 /***** Core Setup - Declared after helper functions *****/
 
 void setupBargraph() {
@@ -267,6 +334,9 @@ void bargraphUpdate(uint8_t i_delay_divisor = 1) {
     i_delay_divisor = 1; // Avoid divide by zero.
   }
 
+  // Keyframe tracks play faster by the same divisor.
+  bargraph.sequencer.setSpeed(i_delay_divisor);
+
   if(bargraph.PATTERN == BG_POWER_RAMP ||
      bargraph.PATTERN == BG_POWER_DOWN ||
      bargraph.PATTERN == BG_POWER_UP) {
@@ -399,86 +469,37 @@ void bargraphUpdate(uint8_t i_delay_divisor = 1) {
 
       case BG_INNER_PULSE:
       case BG_OUTER_INNER:
-        if(bargraph.STATE != BG_EMPTY && bargraph.STATE != BG_MID) {
+        const BargraphKeyframe *p_track = bargraphTrackOuterInner;
+        uint8_t i_start_frame = 0;
+
+        if(bargraph.PATTERN == BG_INNER_PULSE) {
+          // This pattern begins at the midpoint and steps outward first.
+          p_track = bargraphTrackInnerPulse;
+          i_start_frame = BARGRAPH_TRACK_INNER_PULSE_START;
+        }
+
+        if(bargraph.sequencer.isPlaying(p_track)) {
+          bargraph.sequencer.next();
+        }
+        else {
           // Make sure bargraph is empty before starting the pattern.
           bargraph.clear();
-
-          // Prepare to begin on appropriate step for the pattern.
-          if(bargraph.PATTERN == BG_INNER_PULSE) {
-            // This pattern begins at the ends and so it must step backwards once it reaches the midpoint.
-            bargraph.step = bargraph.steps - 1;
-          }
-          else {
-            // All other patterns (read: BG_INNER_PULSE) starts and ends its steps at the midpoint.
-            bargraph.step = 0;
-          }
+          bargraph.sequencer.play(p_track, BARGRAPH_TRACK_FRAMES, i_start_frame);
         }
 
-        uint8_t i_element_max = Bargraph::Elements - 1;
-        uint8_t i_step_mid = bargraph.steps - 1;
+        bargraph.drawFrame();
 
-        // Set special values when at either end of the bargraph.
-        if(bargraph.step == 0) {
-          // Denote that the bargraph is now empty, meaning it likely has not yet begun or just completed.
+        if(bargraph.sequencer.frame() == 0) {
+          // Denote that the bargraph is now at either end, meaning the pattern likely has not yet begun or just completed.
           bargraph.STATE = BG_EMPTY;
-
-          // Illuminate the first and last elements.
-          bargraph.setElement(bargraph.step, 1);
-          bargraph.setElement(i_element_max, 1);
-
-          if(bargraph.PATTERN == BG_OUTER_INNER) {
-            // Clear the next inner elements.
-            bargraph.setElement(bargraph.step + 1, 0);
-            bargraph.setElement(i_element_max - 1, 0);
-          }
-
-          bargraph.commit();
         }
-        else if(bargraph.step == i_step_mid) {
+        else if(bargraph.sequencer.frame() == BARGRAPH_TRACK_MIDDLE) {
           // Denote that we are at the midpoint step, which is technically the endpoint for these patterns.
           bargraph.STATE = BG_MID;
-
-          // Illuminate the middle elements.
-          bargraph.setElement(i_step_mid, 1);
-          bargraph.setElement(i_step_mid + 1, 1);
-
-          // Clear the next middle elements.
-          bargraph.setElement(i_step_mid - 1, 0);
-          bargraph.setElement(i_step_mid + 2, 0);
-
-          bargraph.commit();
-        }
-        else {
-          // This covers all steps between the starting point and endpoint for the patterns.
-
-          // Illuminate elements N steps from each end of the device.
-          bargraph.setElement(bargraph.step, 1);
-          bargraph.setElement(i_element_max - bargraph.step, 1);
-
-          // Clear the next outer elements at N-1 steps.
-          bargraph.setElement(bargraph.step - 1, 0);
-          bargraph.setElement(i_element_max - (bargraph.step - 1), 0);
-
-          // Clear the next inner elements at N+1 steps.
-          if(bargraph.PATTERN == BG_OUTER_INNER) {
-            bargraph.setElement(bargraph.step + 1, 0);
-            bargraph.setElement(i_element_max - (bargraph.step + 1), 0);
-          }
-
-          bargraph.commit();
-        }
-
-        if(bargraph.STATE != BG_MID) {
-          // Continue the pattern until it reaches the midpoint.
-          bargraph.step++;
-        }
-        else {
-          // Reverse direction at the midpoint state.
-          bargraph.step--;
         }
 
         // Reset timer for next iteration, with slight delay as the steps increase.
-        bargraph.ms_bargraph.start(i_current_delay + bargraph.step);
+        bargraph.ms_bargraph.start(bargraph.sequencer.hold(Bargraph::UpdateDelay) + (Bargraph::Elements - bargraph.simulate));
       break;
     }
   }
@@ -141,10 +141,21 @@ void checkRotaryEncoder() {
   checkEncoderAction(); // Take action specifically from interaction by the user.
 }
 
+// Hold the POST light test for a while, still looking for the audio device so the test sound can play.
+void postDelay(uint16_t i_delay) {
+  millisDelay ms_post;
+  ms_post.start(i_delay);
+
+  while(!ms_post.justFinished()) {
+    updateAudio();
+    flushAudio();
+  }
+}
+
 void systemPOST() {
   uint8_t i_delay = 100;
 
-  // Play a sound to test the audio system.
+  // Play a sound to test the audio system. This is sent during the light test below, which holds up the main loop.
   playEffect(S_DEVICE_READY);
 
   // Turn on all bargraph elements and force an update
@@ -154,41 +165,41 @@ void systemPOST() {
 
   // These go HIGH to turn on.
   led_SloBlo.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
   led_Clippard.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
   led_Hat2.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
 
   // These go LOW to turn on.
   led_Vent.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
   led_TopWhite.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
 
   // Optional barrel tip (could be alternate for the GPStar jewel)
   led_Tip.turnOn();
-  delay(i_delay);
+  postDelay(i_delay);
 
   // Sequentially turn on all LEDs in the barrel.
   for(uint8_t i = 0; i < i_num_barrel_leds; i++) {
     system_leds[i] = getHueAsRGB(C_BLUE);
     FastLED.show();
-    delay(i_delay);
+    postDelay(i_delay);
   }
 
   // Sequentially turn on all LEDs in the cyclotron.
   for(uint8_t i = 0; i < i_num_cyclotron_leds; i++) {
     system_leds[i_cyclotron_led_start + i] = getHueAsRGB(C_RED);
     FastLED.show();
-    delay(i_delay);
+    postDelay(i_delay);
   }
 
   // Turn on the front barrel.
   system_leds[i_barrel_led] = getHueAsRGB(C_WHITE);
   FastLED.show();
 
-  delay(i_delay * 8);
+  postDelay(i_delay * 8);
 
   allLightsOff(); // Turn off all lights, including the bargraph.
 
@@ -57,8 +57,11 @@
 #include "MusicSounds.h"
 #include "Header.h"
 #include "Colours.h"
+#include "BargraphDriver.h"
+#include "BargraphSequencer.h"
 #include "Bargraph.h"
 #include "Cyclotron.h"
+#include "AudioQueue.h"
 #include "Audio.h"
 #include "Preferences.h"
 #include "System.h"
@@ -75,7 +78,7 @@ millisDelay ms_fast_led; // Timer for all updates to addressable LEDs across the
 void setup() {
   Serial.begin(9600); // Standard serial (USB) console.
 
-  // Setup the audio device for this controller.
+  // Start looking for the audio device for this controller; this carries on from the main loop.
   setupAudioDevice();
 
   // Change PWM frequency of pin 3 and 11 for the vibration motor, we do not want it high pitched.
@@ -189,4 +192,7 @@ void loop() {
 
   // Animate all LEDs
   animate();
+
+  // Send the sound effect commands queued during this loop.
+  flushAudio();
 }